@@ -19,9 +19,22 @@ GRANT UPDATE ON ALL TABLES IN SCHEMA public TO tournament_admin;
 GRANT INSERT ON ALL TABLES IN SCHEMA public TO tournament_admin;
 GRANT CREATE ON SCHEMA public TO tournament_admin;
 
+-- Plans of slow statements are logged by auto_explain from the execution that was slow, instead of the
+-- services re-running it with EXPLAIN ANALYZE on the request path. Keep log_min_duration in step with
+-- databaseConfig.slowQueries.thresholdMillis; sample_rate bounds the instrumentation overhead.
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET session_preload_libraries = 'auto_explain';
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.log_min_duration = '100ms';
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.sample_rate = 0.1;
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.log_analyze = on;
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.log_buffers = on;
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.log_timing = off;
+ALTER ROLE tournament_svc IN DATABASE tournament_db SET auto_explain.log_format = 'json';
+
 \connect tournament_db tournament_admin
 
 CREATE EXTENSION IF NOT EXISTS "uuid-ossp";
+-- trigram indexes behind the ?q= name search
+CREATE EXTENSION IF NOT EXISTS pg_trgm;
 
 CREATE TABLE TEAMS (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
@@ -30,6 +43,7 @@ CREATE TABLE TEAMS (
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 CREATE UNIQUE INDEX team_unique_name_idx ON teams ((document->>'name'));
+CREATE INDEX team_name_trgm_idx ON TEAMS USING gin ((document->>'name') gin_trgm_ops);
 
 CREATE TABLE TOURNAMENTS (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
@@ -38,6 +52,7 @@ CREATE TABLE TOURNAMENTS (
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 CREATE UNIQUE INDEX tournament_unique_name_idx ON TOURNAMENTS ((document->>'name'));
+CREATE INDEX tournament_name_trgm_idx ON TOURNAMENTS USING gin ((document->>'name') gin_trgm_ops);
 
 CREATE TABLE GROUPS (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
@@ -47,6 +62,7 @@ CREATE TABLE GROUPS (
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
 CREATE UNIQUE INDEX tournament_group_unique_name_idx ON GROUPS (tournament_id,(document->>'name'));
+CREATE INDEX group_last_update_idx ON GROUPS (last_update_date);
 
 CREATE TABLE MATCHES (
     id UUID DEFAULT uuid_generate_v4() PRIMARY KEY,
@@ -55,6 +71,46 @@ CREATE TABLE MATCHES (
     last_update_date TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
     created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
 );
+-- bracket lookups by match name; the reconciliation scans only read rows touched since their last run
+CREATE INDEX match_tournament_name_idx ON MATCHES (tournament_id, (document->>'name'));
+CREATE INDEX match_last_update_idx ON MATCHES (last_update_date);
+-- venue occupancy of every tournament from a scheduling origin on
+CREATE INDEX match_schedule_idx ON MATCHES (((document->'schedule'->>'startsAt')::bigint)) WHERE document ? 'schedule';
+
+-- Broker-less transport ("messaging": {"transport": "postgres"}). Producers insert and NOTIFY. The consumer
+-- owning a queue (session advisory lock) claims rows in id order and deletes each once it is processed.
+CREATE TABLE MESSAGE_QUEUE (
+    id BIGINT GENERATED ALWAYS AS IDENTITY PRIMARY KEY,
+    queue TEXT NOT NULL,
+    body TEXT NOT NULL,
+    deliveries INTEGER NOT NULL DEFAULT 0,
+    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP
+);
+CREATE INDEX message_queue_claim_idx ON MESSAGE_QUEUE (queue, id);
+
+-- Responses recorded per Idempotency-Key so retried POST/PATCH calls are answered without re-executing.
+-- A row without status is a reservation held by the request still running.
+CREATE TABLE IDEMPOTENCY_KEYS (
+    idempotency_key TEXT NOT NULL,
+    scope TEXT NOT NULL,
+    fingerprint TEXT NOT NULL,
+    status INTEGER,
+    headers JSONB,
+    body TEXT,
+    created_at TIMESTAMP DEFAULT CURRENT_TIMESTAMP,
+    completed_at TIMESTAMP,
+    PRIMARY KEY (idempotency_key, scope)
+);
+CREATE INDEX idempotency_keys_created_idx ON IDEMPOTENCY_KEYS (created_at);
+
+-- Bulk import landing table, rows only live for the duration of one import transaction
+CREATE UNLOGGED TABLE IMPORT_STAGING (
+    batch_id UUID NOT NULL,
+    line_number BIGINT NOT NULL,
+    kind TEXT NOT NULL,
+    document JSONB NOT NULL
+);
+CREATE INDEX import_staging_batch_idx ON IMPORT_STAGING (batch_id, kind);
 
 GRANT SELECT ON ALL TABLES IN SCHEMA public TO tournament_svc;
 GRANT DELETE ON ALL TABLES IN SCHEMA public TO tournament_svc;
@@ -21,8 +21,8 @@ public:
 
     [[nodiscard]] std::shared_ptr<cms::Connection> Connection() const { return connection; }
 
-    [[nodiscard]] std::shared_ptr<cms::Session> CreateSession() const {
-        return std::shared_ptr<cms::Session>(connection->createSession(cms::Session::AUTO_ACKNOWLEDGE));
+    [[nodiscard]] std::shared_ptr<cms::Session> CreateSession(cms::Session::AcknowledgeMode mode = cms::Session::AUTO_ACKNOWLEDGE) const {
+        return std::shared_ptr<cms::Session>(connection->createSession(mode));
     }
 
 private:
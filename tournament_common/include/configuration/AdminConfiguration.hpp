@@ -0,0 +1,43 @@
+#ifndef ADMIN_CONFIGURATION_HPP
+#define ADMIN_CONFIGURATION_HPP
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace config {
+    // Access to the operational endpoints. The ADMIN_TOKEN environment variable wins over the file so
+    // the secret does not have to be baked into the image; with no token at all they are closed.
+    struct AdminConfiguration {
+        std::string token;
+        // port of the consumer's admin listener, the services expose their admin routes on the API port
+        int port = 0;
+
+        [[nodiscard]] bool Authorizes(std::string_view authorization) const {
+            constexpr std::string_view scheme = "Bearer ";
+            if (token.empty() || !authorization.starts_with(scheme)) {
+                return false;
+            }
+            const auto presented = authorization.substr(scheme.size());
+            if (presented.size() != token.size()) {
+                return false;
+            }
+            // compared without early exit so the response time does not leak the matching prefix
+            unsigned char difference = 0;
+            for (size_t index = 0; index < token.size(); ++index) {
+                difference |= static_cast<unsigned char>(presented[index] ^ token[index]);
+            }
+            return difference == 0;
+        }
+    };
+
+    inline void from_json(const nlohmann::json& json, AdminConfiguration& adminConfiguration) {
+        adminConfiguration.token = json.value("token", std::string{});
+        adminConfiguration.port = json.value("port", 0);
+        if (const char* token = std::getenv("ADMIN_TOKEN"); token != nullptr) {
+            adminConfiguration.token = token;
+        }
+    }
+}
+#endif
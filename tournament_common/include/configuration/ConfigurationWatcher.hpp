@@ -0,0 +1,237 @@
+#ifndef COMMON_CONFIGURATION_WATCHER_HPP
+#define COMMON_CONFIGURATION_WATCHER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace config {
+    // configuration.json as an immutable snapshot that is swapped atomically when the file changes.
+    // Readers take the current snapshot without locking. Components with tunables that are safe to
+    // change live subscribe to their section and are called with the new value after each reload;
+    // everything else (ports, thread counts, connection strings, broker url) is read once at startup.
+    class ConfigurationWatcher {
+    public:
+        using Snapshot = std::shared_ptr<const nlohmann::json>;
+        using Listener = std::function<void(const nlohmann::json&)>;
+
+    private:
+        struct Subscription {
+            nlohmann::json::json_pointer section;
+            Listener listener;
+            // passed instead when the section is removed
+            nlohmann::json fallback;
+        };
+
+        std::filesystem::path path;
+        std::chrono::milliseconds interval;
+        std::atomic<Snapshot> current;
+        // serializes reloads, listeners run with it held so they see the generations in order
+        std::mutex reloadMutex;
+        // guards the fields below, never held while a listener runs: a pool resize opening connections
+        // must not stall Status or the poll for changes
+        std::mutex mutex;
+        std::vector<Subscription> subscriptions;
+        std::filesystem::file_time_type modified;
+        uint64_t generation = 1;
+        std::chrono::system_clock::time_point loadedAt;
+        std::string lastError;
+        std::jthread thread;
+
+        static nlohmann::json read(const std::filesystem::path& path) {
+            std::ifstream file(path);
+            if (!file) {
+                throw std::runtime_error("Cannot open " + path.string());
+            }
+            return nlohmann::json::parse(file);
+        }
+
+        static nlohmann::json section(const nlohmann::json& snapshot, const nlohmann::json::json_pointer& pointer) {
+            return snapshot.contains(pointer) ? snapshot.at(pointer) : nlohmann::json();
+        }
+
+    public:
+        // Reads the file once, a missing or malformed file at startup is fatal as before
+        explicit ConfigurationWatcher(std::filesystem::path path, std::chrono::milliseconds interval = std::chrono::seconds{2})
+            : path(std::move(path)), interval(interval), current(std::make_shared<const nlohmann::json>(read(this->path))),
+              loadedAt(std::chrono::system_clock::now()) {
+            std::error_code ignored;
+            modified = std::filesystem::last_write_time(this->path, ignored);
+        }
+
+        ~ConfigurationWatcher() {
+            Stop();
+        }
+
+        [[nodiscard]] Snapshot Current() const {
+            return current.load(std::memory_order_acquire);
+        }
+
+        // `section` is a JSON pointer such as "/admission". The listener runs on every reload that changes
+        // the value there. When the section is removed it gets `fallback` instead, by default an empty
+        // object so from_json puts the defaults back; a null fallback keeps the last value in place.
+        // A listener that throws leaves the others running.
+        void Subscribe(std::string_view section, Listener listener, nlohmann::json fallback = nlohmann::json::object()) {
+            std::lock_guard lock(mutex);
+            subscriptions.push_back({nlohmann::json::json_pointer(std::string(section)), std::move(listener), std::move(fallback)});
+        }
+
+        // Re-reads the file; true when a changed configuration was installed. A file that does not parse
+        // keeps the running snapshot.
+        std::expected<bool, std::string> Reload() {
+            std::lock_guard reloading(reloadMutex);
+            std::error_code ignored;
+            const auto lastWrite = std::filesystem::last_write_time(path, ignored);
+
+            Snapshot next;
+            try {
+                next = std::make_shared<const nlohmann::json>(read(path));
+            } catch (const std::exception& e) {
+                std::lock_guard lock(mutex);
+                modified = lastWrite;
+                lastError = e.what();
+                std::cout << "[ConfigurationWatcher] ERROR keeping the running configuration: " << lastError << std::endl;
+                return std::unexpected(lastError);
+            }
+            const auto previous = current.load(std::memory_order_acquire);
+            // copied out, so a Subscribe while the listeners run cannot move them
+            struct Change {
+                std::string section;
+                Listener listener;
+                nlohmann::json value;
+            };
+            std::vector<Change> changes;
+            uint64_t installed;
+            {
+                std::lock_guard lock(mutex);
+                modified = lastWrite;
+                if (*next == *previous) {
+                    return false;
+                }
+                current.store(next, std::memory_order_release);
+                installed = ++generation;
+                loadedAt = std::chrono::system_clock::now();
+                lastError.clear();
+
+                for (const auto& subscription : subscriptions) {
+                    auto value = section(*next, subscription.section);
+                    const auto before = section(*previous, subscription.section);
+                    if (value == before) {
+                        continue;
+                    }
+                    if (value.is_null()) {
+                        if (subscription.fallback.is_null()) {
+                            continue;
+                        }
+                        value = subscription.fallback;
+                    }
+                    changes.push_back({subscription.section.to_string(), subscription.listener, std::move(value)});
+                }
+            }
+
+            for (const auto& [name, listener, value] : changes) {
+                try {
+                    listener(value);
+                } catch (const std::exception& e) {
+                    std::lock_guard lock(mutex);
+                    lastError = name + ": " + e.what();
+                    std::cout << "[ConfigurationWatcher] ERROR applying " << lastError << std::endl;
+                }
+            }
+            std::cout << "[ConfigurationWatcher] configuration generation " << installed << " active" << std::endl;
+            return true;
+        }
+
+        // Polls the modification time of the file every interval on a background thread
+        void Start() {
+            if (thread.joinable()) {
+                return;
+            }
+            thread = std::jthread([this](std::stop_token stop) {
+                std::mutex sleepMutex;
+                std::condition_variable_any wakeUp;
+                while (!stop.stop_requested()) {
+                    {
+                        std::unique_lock lock(sleepMutex);
+                        wakeUp.wait_for(lock, stop, interval, [] { return false; });
+                    }
+                    if (stop.stop_requested()) {
+                        return;
+                    }
+                    std::error_code error;
+                    const auto lastWrite = std::filesystem::last_write_time(path, error);
+                    bool changed;
+                    {
+                        std::lock_guard lock(mutex);
+                        changed = !error && lastWrite != modified;
+                    }
+                    if (changed) {
+                        (void) Reload();
+                    }
+                }
+            });
+        }
+
+        void Stop() {
+            if (thread.joinable()) {
+                thread.request_stop();
+                thread.join();
+            }
+        }
+
+        // Active configuration with secrets masked, plus reload bookkeeping
+        [[nodiscard]] nlohmann::json Status() {
+            const auto snapshot = Current();
+            std::lock_guard lock(mutex);
+            return {
+                {"generation", generation},
+                {"loadedAt", std::chrono::duration_cast<std::chrono::milliseconds>(loadedAt.time_since_epoch()).count()},
+                {"lastError", lastError.empty() ? nlohmann::json() : nlohmann::json(lastError)},
+                {"configuration", Redacted(*snapshot)},
+            };
+        }
+
+        static nlohmann::json Redacted(const nlohmann::json& json) {
+            static const std::regex CREDENTIALS(R"(://([^:/@]+):[^@]*@)");
+            if (json.is_object()) {
+                nlohmann::json redacted = nlohmann::json::object();
+                for (const auto& [key, value] : json.items()) {
+                    if ((key == "token" || key == "password") && value.is_string()) {
+                        redacted[key] = value.get<std::string>().empty() ? "" : "***";
+                    } else if (value.is_string()) {
+                        redacted[key] = std::regex_replace(value.get<std::string>(), CREDENTIALS, "://$1:***@");
+                    } else {
+                        redacted[key] = Redacted(value);
+                    }
+                }
+                return redacted;
+            }
+            if (json.is_array()) {
+                nlohmann::json redacted = nlohmann::json::array();
+                for (const auto& value : json) {
+                    redacted.push_back(Redacted(value));
+                }
+                return redacted;
+            }
+            return json;
+        }
+    };
+}
+
+#endif //COMMON_CONFIGURATION_WATCHER_HPP
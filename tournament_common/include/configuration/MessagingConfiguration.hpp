@@ -0,0 +1,38 @@
+#ifndef MESSAGING_CONFIGURATION_HPP
+#define MESSAGING_CONFIGURATION_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace config {
+    enum class Transport {
+        // queues on the broker configured under "activemq"
+        ACTIVEMQ,
+        // MESSAGE_QUEUE table woken up by LISTEN/NOTIFY, no broker needed
+        POSTGRES
+    };
+
+    struct MessagingConfiguration {
+        Transport transport = Transport::ACTIVEMQ;
+        // messages a Postgres consumer claims per round trip
+        size_t claimBatch = 64;
+        // a Postgres message that failed this many times is dropped, so it cannot hold up its queue
+        int maxDeliveries = 10;
+    };
+
+    inline void from_json(const nlohmann::json& json, MessagingConfiguration& messagingConfiguration) {
+        const auto transport = json.value("transport", std::string{"activemq"});
+        if (transport == "activemq") {
+            messagingConfiguration.transport = Transport::ACTIVEMQ;
+        } else if (transport == "postgres") {
+            messagingConfiguration.transport = Transport::POSTGRES;
+        } else {
+            throw std::invalid_argument("Unknown messaging transport: " + transport);
+        }
+        messagingConfiguration.claimBatch = std::max<size_t>(json.value("claimBatch", messagingConfiguration.claimBatch), 1);
+        messagingConfiguration.maxDeliveries = std::max(json.value("maxDeliveries", messagingConfiguration.maxDeliveries), 1);
+    }
+}
+#endif
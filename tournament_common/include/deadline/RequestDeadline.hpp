@@ -0,0 +1,55 @@
+#ifndef COMMON_REQUEST_DEADLINE_HPP
+#define COMMON_REQUEST_DEADLINE_HPP
+
+#include <chrono>
+#include <optional>
+
+namespace deadline {
+    using Clock = std::chrono::steady_clock;
+
+    // Time budget of the request being served on this thread. The routing layer opens the scope and
+    // delegates and repositories read it back without it being threaded through every signature.
+    // Scopes do not nest: an inner scope keeps the outer (tighter or equal) deadline.
+    class RequestDeadline {
+        static std::optional<Clock::time_point>& current() {
+            thread_local std::optional<Clock::time_point> deadline;
+            return deadline;
+        }
+
+        bool owner = false;
+    public:
+        explicit RequestDeadline(std::chrono::milliseconds budget) {
+            if (!current().has_value()) {
+                current() = Clock::now() + budget;
+                owner = true;
+            }
+        }
+
+        ~RequestDeadline() {
+            if (owner) {
+                current().reset();
+            }
+        }
+
+        RequestDeadline(const RequestDeadline&) = delete;
+        RequestDeadline& operator=(const RequestDeadline&) = delete;
+
+        // Outside of a request (consumer, CLI, tests) there is no deadline
+        static std::optional<Clock::time_point> Current() {
+            return current();
+        }
+
+        static std::optional<std::chrono::milliseconds> Remaining() {
+            if (!current().has_value()) {
+                return std::nullopt;
+            }
+            return std::chrono::duration_cast<std::chrono::milliseconds>(*current() - Clock::now());
+        }
+
+        static bool Expired() {
+            return current().has_value() && Clock::now() >= *current();
+        }
+    };
+}
+
+#endif /* COMMON_REQUEST_DEADLINE_HPP */
@@ -1,9 +1,31 @@
 #ifndef TOURNAMENT_COMMON_CONSTANTS_HPP
 #define TOURNAMENT_COMMON_CONSTANTS_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <regex>
+#include <string_view>
 
 // UUID validation regex constant used throughout the project
 static const std::regex ID_VALUE(R"(^[0-9a-fA-F]{8}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{4}\b-[0-9a-fA-F]{12}$)");
 
+// Matches in place, so ids coming from the URL or a string_view are not copied just to be checked
+inline bool IsValidId(std::string_view id) {
+    return std::regex_match(id.begin(), id.end(), ID_VALUE);
+}
+
+// Name search (?q=): queries longer than this are rejected, results are capped at MAX_SEARCH_LIMIT.
+// A query needs one trigram to be answered from the index, shorter ones would scan the table.
+constexpr size_t MIN_SEARCH_QUERY_LENGTH = 3;
+constexpr size_t MAX_SEARCH_QUERY_LENGTH = 100;
+constexpr size_t DEFAULT_SEARCH_LIMIT = 10;
+constexpr size_t MAX_SEARCH_LIMIT = 50;
+
+inline bool IsValidSearch(std::string_view query, size_t limit) {
+    // characters, not bytes: UTF-8 continuation bytes are not counted
+    const auto characters = std::ranges::count_if(query, [](char byte) { return (static_cast<unsigned char>(byte) & 0xC0) != 0x80; });
+    return static_cast<size_t>(characters) >= MIN_SEARCH_QUERY_LENGTH && query.size() <= MAX_SEARCH_QUERY_LENGTH
+        && limit >= 1 && limit <= MAX_SEARCH_LIMIT;
+}
+
 #endif // TOURNAMENT_COMMON_CONSTANTS_HPP
\ No newline at end of file
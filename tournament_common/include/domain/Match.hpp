@@ -1,7 +1,11 @@
 #ifndef DOMAIN_MATCH_HPP
 #define DOMAIN_MATCH_HPP
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
+#include <vector>
+
 namespace domain {
     enum class Winner { HOME, VISITOR  };
     
@@ -16,6 +20,12 @@ namespace domain {
         }
     };
     
+    // Where and when a match is played, empty venue until the scheduler placed it
+    struct Schedule {
+        std::string venue;
+        int64_t startsAt = 0; // seconds since epoch, UTC
+    };
+
     class Match {
         /* data */
         std::string id;
@@ -23,7 +33,10 @@ namespace domain {
         std::string tournamentId;
         std::string homeTeamId;
         std::string visitorTeamId;
+        // set on group stage matches only, knockout matches belong to the tournament
+        std::string groupId;
         Score score;
+        Schedule schedule;
 
     public:
         Match(/* args */){}
@@ -67,6 +80,14 @@ namespace domain {
             return visitorTeamId;
         }
 
+        [[nodiscard]] std::string GroupId() const {
+            return groupId;
+        }
+
+        std::string & GroupId() {
+            return groupId;
+        }
+
         Score & MatchScore() {
             return score;
         }
@@ -74,7 +95,31 @@ namespace domain {
         [[nodiscard]] Score MatchScore() const {
             return score;
         }
+
+        Schedule & MatchSchedule() {
+            return schedule;
+        }
+
+        [[nodiscard]] Schedule MatchSchedule() const {
+            return schedule;
+        }
     };
+
+    // Brackets do not allow ties and an unplayed match is 0-0, so a match is decided once the scores differ
+    inline bool IsDecided(const Match& match) {
+        return !match.HomeTeamId().empty() && !match.VisitorTeamId().empty()
+            && match.MatchScore().homeTeamScore != match.MatchScore().visitorTeamScore;
+    }
+
+    // Over once the final (F0) is decided and the reset final (F1), when it got both teams, is decided too
+    inline bool IsBracketFinished(const std::vector<Match>& matches) {
+        const auto final = std::ranges::find(matches, std::string("F0"), [](const Match& match) { return match.Name(); });
+        if (final == matches.end() || !IsDecided(*final)) {
+            return false;
+        }
+        const auto reset = std::ranges::find(matches, std::string("F1"), [](const Match& match) { return match.Name(); });
+        return reset == matches.end() || reset->HomeTeamId().empty() || reset->VisitorTeamId().empty() || IsDecided(*reset);
+    }
     
 }
 #endif
\ No newline at end of file
@@ -9,18 +9,25 @@
 
 namespace domain {
     enum class TournamentType {
-        DOUBLE_ELIMINATION
+        DOUBLE_ELIMINATION,
+        // round robin inside every group, the best of each group are seeded into a double elimination bracket
+        GROUP_STAGE_KNOCKOUT
     };
 
+    // The knockout stage is always the 32 team double elimination bracket
+    constexpr int KNOCKOUT_TEAMS = 32;
+
 
     class TournamentFormat {
         int numberOfGroups;
         int maxTeamsPerGroup;
+        int qualifiersPerGroup;
         TournamentType type;
     public:
-        TournamentFormat(int numberOfGroups = 1, int maxTeamsPerGroup = 16, TournamentType tournamentType = TournamentType::DOUBLE_ELIMINATION) {
+        TournamentFormat(int numberOfGroups = 1, int maxTeamsPerGroup = 16, TournamentType tournamentType = TournamentType::DOUBLE_ELIMINATION, int qualifiersPerGroup = 2) {
             this->numberOfGroups = numberOfGroups;
             this->maxTeamsPerGroup = maxTeamsPerGroup;
+            this->qualifiersPerGroup = qualifiersPerGroup;
             this->type = tournamentType;
         }
 
@@ -39,6 +46,14 @@ namespace domain {
             return this->maxTeamsPerGroup;
         }
 
+        int QualifiersPerGroup() const {
+            return this->qualifiersPerGroup;
+        }
+
+        int & QualifiersPerGroup() {
+            return this->qualifiersPerGroup;
+        }
+
         TournamentType Type() const {
             return this->type;
         }
@@ -48,6 +63,21 @@ namespace domain {
         }
     };
 
+    // A group stage has to fill the knockout bracket exactly
+    inline bool IsValidFormat(const TournamentFormat& format) {
+        if (format.Type() != TournamentType::GROUP_STAGE_KNOCKOUT) {
+            return true;
+        }
+        return format.QualifiersPerGroup() >= 1
+            && format.QualifiersPerGroup() <= format.MaxTeamsPerGroup()
+            && format.NumberOfGroups() * format.QualifiersPerGroup() == KNOCKOUT_TEAMS;
+    }
+
+    // Teams a group takes before its matches are generated
+    inline int GroupCapacity(const TournamentFormat& format) {
+        return format.Type() == TournamentType::GROUP_STAGE_KNOCKOUT ? format.MaxTeamsPerGroup() : KNOCKOUT_TEAMS;
+    }
+
     class Tournament
     {
         std::string id;
@@ -45,6 +45,8 @@ namespace domain {
     inline TournamentType fromString(std::string_view type) {
         if (type == "DOUBLE_ELIMINATION")
             return TournamentType::DOUBLE_ELIMINATION;
+        if (type == "GROUP_STAGE_KNOCKOUT")
+            return TournamentType::GROUP_STAGE_KNOCKOUT;
 
         return TournamentType::DOUBLE_ELIMINATION;
     }
@@ -54,6 +56,8 @@ namespace domain {
             json.at("maxTeamsPerGroup").get_to(format.MaxTeamsPerGroup());
         if(json.contains("numberOfGroups"))
             json.at("numberOfGroups").get_to(format.NumberOfGroups());
+        if(json.contains("qualifiersPerGroup"))
+            json.at("qualifiersPerGroup").get_to(format.QualifiersPerGroup());
         if(json.contains("type"))
             format.Type() = fromString(json["type"].get<std::string>());
     }
@@ -64,6 +68,10 @@ namespace domain {
             case TournamentType::DOUBLE_ELIMINATION:
                 json["type"] = "DOUBLE_ELIMINATION";
                 break;
+            case TournamentType::GROUP_STAGE_KNOCKOUT:
+                json["type"] = "GROUP_STAGE_KNOCKOUT";
+                json["qualifiersPerGroup"] = format.QualifiersPerGroup();
+                break;
             default:
                 json["type"] = "DOUBLE_ELIMINATION";
         }
@@ -148,6 +156,18 @@ namespace domain {
         json["teams"] = group.Teams();
     }
 
+    // Stored form of a group: teams are referenced by id only, names are resolved at read time
+    inline nlohmann::json GroupDocument(const Group& group) {
+        nlohmann::json json;
+        json["name"] = group.Name();
+        json["tournamentId"] = group.TournamentId();
+        json["teams"] = nlohmann::json::array();
+        for (const auto& team : group.Teams()) {
+            json["teams"].push_back({{"id", team.Id}});
+        }
+        return json;
+    }
+
     // inline std::string bracketTypeToString(BracketType type) {
     //     switch (type) {
     //         case BracketType::WINNERS: return "WINNERS";
@@ -178,6 +198,17 @@ namespace domain {
             json.at("visitorTeamScore").get_to(score.visitorTeamScore);
     }
 
+    inline void to_json(nlohmann::json& json, const Schedule& schedule) {
+        json = {{"venue", schedule.venue}, {"startsAt", schedule.startsAt}};
+    }
+
+    inline void from_json(const nlohmann::json& json, Schedule& schedule) {
+        if (json.contains("venue"))
+            json.at("venue").get_to(schedule.venue);
+        if (json.contains("startsAt"))
+            json.at("startsAt").get_to(schedule.startsAt);
+    }
+
     inline void to_json(nlohmann::json& json, const Match& match) {
         json = nlohmann::json::object();
         if (!match.Id().empty()) {
@@ -195,6 +226,12 @@ namespace domain {
         if (!match.VisitorTeamId().empty()) {
             json["visitorTeamId"] = match.VisitorTeamId();
         }
+        if (!match.GroupId().empty()) {
+            json["groupId"] = match.GroupId();
+        }
+        if (!match.MatchSchedule().venue.empty()) {
+            json["schedule"] = match.MatchSchedule();
+        }
         json["score"] = match.MatchScore();
     }
 
@@ -214,6 +251,12 @@ namespace domain {
         if (json.contains("visitorTeamId")) {
             match.VisitorTeamId() = json["visitorTeamId"].get<std::string>();
         }
+        if (json.contains("groupId")) {
+            match.GroupId() = json["groupId"].get<std::string>();
+        }
+        if (json.contains("schedule") && json["schedule"].is_object()) {
+            json.at("schedule").get_to(match.MatchSchedule());
+        }
         if (json.contains("score")) {
             json.at("score").get_to(match.MatchScore());
         }
@@ -236,6 +279,12 @@ namespace domain {
         if (!match->VisitorTeamId().empty()) {
             json["visitorTeamId"] = match->VisitorTeamId();
         }
+        if (!match->GroupId().empty()) {
+            json["groupId"] = match->GroupId();
+        }
+        if (!match->MatchSchedule().venue.empty()) {
+            json["schedule"] = match->MatchSchedule();
+        }
         json["score"] = match->MatchScore();
     }
 
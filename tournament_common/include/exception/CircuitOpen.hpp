@@ -0,0 +1,12 @@
+#ifndef TOURNAMENTS_CIRCUITOPEN_HPP
+#define TOURNAMENTS_CIRCUITOPEN_HPP
+
+#include <stdexcept>
+
+class CircuitOpenException : public std::runtime_error {
+public:
+    explicit CircuitOpenException(const std::string& msg)
+        : std::runtime_error(msg) {}
+};
+
+#endif //TOURNAMENTS_CIRCUITOPEN_HPP
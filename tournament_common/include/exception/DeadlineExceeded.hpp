@@ -0,0 +1,12 @@
+#ifndef TOURNAMENTS_DEADLINEEXCEEDED_HPP
+#define TOURNAMENTS_DEADLINEEXCEEDED_HPP
+
+#include <stdexcept>
+
+class DeadlineExceededException : public std::runtime_error {
+public:
+    explicit DeadlineExceededException(const std::string& msg)
+        : std::runtime_error(msg) {}
+};
+
+#endif //TOURNAMENTS_DEADLINEEXCEEDED_HPP
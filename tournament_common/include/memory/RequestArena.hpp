@@ -0,0 +1,62 @@
+#ifndef COMMON_REQUEST_ARENA_HPP
+#define COMMON_REQUEST_ARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+
+namespace memory {
+
+    // Monotonic arena for everything allocated while serving one request. The first block lives in
+    // thread-local storage so a request that fits in it never reaches malloc, and the whole arena is
+    // released in one go when the scope closes. Arenas do not nest: an inner scope reuses the outer one.
+    class RequestArena {
+        static constexpr size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+
+        static std::pmr::memory_resource*& current() {
+            thread_local std::pmr::memory_resource* resource = nullptr;
+            return resource;
+        }
+
+        static std::byte* initialBlock() {
+            alignas(std::max_align_t) thread_local std::array<std::byte, INITIAL_BLOCK_SIZE> block;
+            return block.data();
+        }
+
+        std::optional<std::pmr::monotonic_buffer_resource> resource;
+    public:
+        RequestArena() {
+            if (current() == nullptr) {
+                resource.emplace(initialBlock(), INITIAL_BLOCK_SIZE, std::pmr::new_delete_resource());
+                current() = &*resource;
+            }
+        }
+
+        ~RequestArena() {
+            if (resource.has_value()) {
+                current() = nullptr;
+            }
+        }
+
+        RequestArena(const RequestArena&) = delete;
+        RequestArena& operator=(const RequestArena&) = delete;
+
+        // Outside of a request (consumer, CLI, tests) allocations go to the regular heap
+        static std::pmr::memory_resource* Resource() {
+            auto resource = current();
+            return resource != nullptr ? resource : std::pmr::new_delete_resource();
+        }
+    };
+
+    // make_shared counterpart that places the object and its control block in the request arena.
+    // The pointer must not outlive the request, nothing request-scoped is cached across requests.
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_request_shared(Args&&... args) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(RequestArena::Resource()), std::forward<Args>(args)...);
+    }
+}
+
+#endif /* COMMON_REQUEST_ARENA_HPP */
@@ -0,0 +1,53 @@
+#ifndef TOURNAMENTS_BULKHEADCONNECTIONPROVIDER_HPP
+#define TOURNAMENTS_BULKHEADCONNECTIONPROVIDER_HPP
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include "IDbConnectionProvider.hpp"
+
+// Routes each workload to its own pool. A workload without a dedicated pool shares the interactive one.
+class BulkheadConnectionProvider : public IDbConnectionProvider {
+    std::array<std::shared_ptr<IDbConnectionProvider>, 3> pools;
+public:
+    explicit BulkheadConnectionProvider(const std::map<Workload, std::shared_ptr<IDbConnectionProvider>>& configured) {
+        const auto interactive = configured.find(Workload::INTERACTIVE);
+        if (interactive == configured.end()) {
+            throw std::invalid_argument("The interactive connection pool is required");
+        }
+        pools.fill(interactive->second);
+        for (const auto& [workload, pool] : configured) {
+            pools[static_cast<size_t>(workload)] = pool;
+        }
+    }
+
+    PooledConnection Connection() override {
+        return Connection(Workload::INTERACTIVE);
+    }
+
+    PooledConnection Connection(Workload workload) override {
+        return pools[static_cast<size_t>(workload)]->Connection();
+    }
+
+    // A workload sharing the interactive pool has nothing of its own to resize
+    void Resize(Workload workload, size_t size) override {
+        const auto& pool = pools[static_cast<size_t>(workload)];
+        if (workload == Workload::INTERACTIVE || pool != pools[static_cast<size_t>(Workload::INTERACTIVE)]) {
+            pool->Resize(workload, size);
+        }
+    }
+
+    // The most saturated pool
+    std::chrono::microseconds CheckoutWait() override {
+        std::chrono::microseconds wait{0};
+        for (const auto& pool : pools) {
+            wait = std::max(wait, pool->CheckoutWait());
+        }
+        return wait;
+    }
+};
+
+#endif //TOURNAMENTS_BULKHEADCONNECTIONPROVIDER_HPP
@@ -0,0 +1,58 @@
+#ifndef TOURNAMENTS_CIRCUITBREAKINGCONNECTIONPROVIDER_HPP
+#define TOURNAMENTS_CIRCUITBREAKINGCONNECTIONPROVIDER_HPP
+
+#include <memory>
+
+#include "IDbConnectionProvider.hpp"
+#include "resilience/CircuitBreaker.hpp"
+
+// Fails fast while Postgres is down or its pool saturated instead of queueing every request for the
+// pool. Wraps a single pool, so a saturated bulk pool does not fail fast for score writes. A checkout
+// counts as failed when it throws (broken link, pool wait past the deadline) or when the connection
+// comes back broken. A request that merely ran out of its own deadline while holding the connection
+// says nothing about the database and is not counted.
+class CircuitBreakingConnectionProvider : public IDbConnectionProvider {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<resilience::CircuitBreaker> circuitBreaker;
+public:
+    CircuitBreakingConnectionProvider(std::shared_ptr<IDbConnectionProvider> connectionProvider, std::shared_ptr<resilience::CircuitBreaker> circuitBreaker)
+        : connectionProvider(std::move(connectionProvider)), circuitBreaker(std::move(circuitBreaker)) {}
+
+    PooledConnection Connection() override {
+        return Connection(Workload::INTERACTIVE);
+    }
+
+    void Resize(Workload workload, size_t size) override {
+        connectionProvider->Resize(workload, size);
+    }
+
+    std::chrono::microseconds CheckoutWait() override {
+        return connectionProvider->CheckoutWait();
+    }
+
+    PooledConnection Connection(Workload workload) override {
+        const auto admission = circuitBreaker->Acquire();
+        std::shared_ptr<PooledConnection> pooled;
+        try {
+            pooled = std::make_shared<PooledConnection>(connectionProvider->Connection(workload));
+        } catch (...) {
+            circuitBreaker->RecordFailure(admission);
+            throw;
+        }
+
+        // Same connection object, the inner pooled handle goes back to the pool once the outcome is recorded
+        return PooledConnection(
+            &**pooled,
+            [pooled, breaker = circuitBreaker, admission](IDbConnection* dbc) mutable {
+                if (dbc->IsHealthy()) {
+                    breaker->RecordSuccess(admission);
+                } else {
+                    breaker->RecordFailure(admission);
+                }
+                pooled.reset();
+            }
+        );
+    }
+};
+
+#endif //TOURNAMENTS_CIRCUITBREAKINGCONNECTIONPROVIDER_HPP
@@ -0,0 +1,84 @@
+#ifndef COMMON_CONNECTIONPROVIDERS_HPP
+#define COMMON_CONNECTIONPROVIDERS_HPP
+
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/BulkheadConnectionProvider.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/SlowQueryLog.hpp"
+
+namespace config {
+    inline Workload poolWorkload(const std::string& name) {
+        static const std::map<std::string, Workload> WORKLOADS = {
+            {"interactive", Workload::INTERACTIVE},
+            {"write", Workload::WRITE},
+            {"bulk", Workload::BULK},
+        };
+        const auto workload = WORKLOADS.find(name);
+        if (workload == WORKLOADS.end()) {
+            throw std::invalid_argument("Unknown connection pool: " + name);
+        }
+        return workload->second;
+    }
+
+    // Wraps a single pool, called with the pool's name ("interactive", "write", "bulk") or "" for the
+    // single pool of poolSize
+    using PoolDecorator = std::function<std::shared_ptr<IDbConnectionProvider>(const std::string&, std::shared_ptr<IDbConnectionProvider>)>;
+
+    // Builds the connection pools from databaseConfig. With "pools", e.g. {"interactive": 2, "write": 2,
+    // "bulk": 1}, every workload gets its own pool; otherwise a single pool of poolSize serves them all.
+    // All pools report statement timings to the same slow query log when one is given. The decorator
+    // wraps each pool before the bulkhead routes between them, so what it counts stays per pool.
+    inline std::shared_ptr<IDbConnectionProvider> connectionProvider(const nlohmann::json& databaseConfig,
+                                                                     const std::shared_ptr<SlowQueryLog>& slowQueries = nullptr,
+                                                                     const PoolDecorator& decorate = nullptr) {
+        const auto connectionString = databaseConfig["connectionString"].get<std::string>();
+        if (!databaseConfig.contains("pools")) {
+            std::shared_ptr<IDbConnectionProvider> pool =
+                std::make_shared<PostgresConnectionProvider>(connectionString, databaseConfig["poolSize"].get<size_t>(), slowQueries);
+            return decorate ? decorate("", pool) : pool;
+        }
+
+        // the pools connect at the same time too
+        std::vector<std::pair<Workload, std::future<std::shared_ptr<IDbConnectionProvider>>>> pending;
+        for (const auto& [name, size] : databaseConfig["pools"].items()) {
+            pending.emplace_back(poolWorkload(name), std::async(std::launch::async, [connectionString, size = size.get<size_t>(), slowQueries, lockName = "postgres.pool." + name] {
+                return std::static_pointer_cast<IDbConnectionProvider>(std::make_shared<PostgresConnectionProvider>(connectionString, size, slowQueries, lockName));
+            }));
+        }
+        std::map<Workload, std::shared_ptr<IDbConnectionProvider>> pools;
+        for (auto& [workload, pool] : pending) {
+            pools.emplace(workload, pool.get());
+        }
+        if (decorate) {
+            for (const auto& [name, size] : databaseConfig["pools"].items()) {
+                auto& pool = pools.at(poolWorkload(name));
+                pool = decorate(name, pool);
+            }
+        }
+        return std::make_shared<BulkheadConnectionProvider>(pools);
+    }
+
+    // Applies new pool bounds from databaseConfig to pools built by connectionProvider. Adding or
+    // removing a dedicated pool changes the routing and still needs a restart.
+    inline void resizePools(IDbConnectionProvider& provider, const nlohmann::json& databaseConfig) {
+        if (!databaseConfig.contains("pools")) {
+            provider.Resize(Workload::INTERACTIVE, databaseConfig["poolSize"].get<size_t>());
+            return;
+        }
+        for (const auto& [name, size] : databaseConfig["pools"].items()) {
+            provider.Resize(poolWorkload(name), size.get<size_t>());
+        }
+    }
+}
+
+#endif //COMMON_CONNECTIONPROVIDERS_HPP
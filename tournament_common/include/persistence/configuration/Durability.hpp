@@ -0,0 +1,19 @@
+#ifndef TOURNAMENTS_DURABILITY_HPP
+#define TOURNAMENTS_DURABILITY_HPP
+
+#include <pqxx/pqxx>
+
+// How much a write must survive. DURABLE waits for the WAL flush on commit (scores, registrations).
+// RECOMPUTABLE is for rows that can be derived again from durable ones, such as bracket advancements
+// recomputed from the scores: the commit returns before the flush and a crash may lose the last few
+// hundred milliseconds of them, never corrupt them. A later durable commit flushes earlier ones too.
+enum class Durability { DURABLE, RECOMPUTABLE };
+
+// SET LOCAL ends with the transaction, the pooled connection keeps the server default
+inline void ApplyDurability(pqxx::transaction_base& tx, Durability durability) {
+    if (durability == Durability::RECOMPUTABLE) {
+        tx.exec("SET LOCAL synchronous_commit = off");
+    }
+}
+
+#endif //TOURNAMENTS_DURABILITY_HPP
@@ -5,12 +5,15 @@
 #ifndef TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
 
+#include <chrono>
 #include <memory>
 #include <functional>
 
 class IDbConnection {
 public:
     virtual ~IDbConnection() = default;
+    // False once the link to the database is lost, the connection must not be handed out again
+    [[nodiscard]] virtual bool IsHealthy() const { return true; }
 };
 
 
@@ -33,9 +36,24 @@ public:
 };
 
 
+// Operation class a connection is borrowed for, each one can be given its own pool (bulkhead) so
+// long exports or imports never take the connections interactive reads and score writes need
+enum class Workload {
+    INTERACTIVE,
+    WRITE,
+    BULK
+};
+
 class IDbConnectionProvider {
 public:
     virtual ~IDbConnectionProvider() = default;
     virtual PooledConnection Connection() = 0;
+    // Providers with a single pool serve every workload from it
+    virtual PooledConnection Connection(Workload) { return Connection(); }
+    // Live pool bound change; providers without a pool of their own ignore it
+    virtual void Resize(Workload, size_t) {}
+    // How long a checkout currently waits for a free connection, averaged over the last second.
+    // Providers without a pool of their own never make anyone wait.
+    virtual std::chrono::microseconds CheckoutWait() { return {}; }
 };
 #endif //TOURNAMENTS_IDBCONNECTIONPROVIDER_HPP
\ No newline at end of file
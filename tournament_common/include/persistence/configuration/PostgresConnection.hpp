@@ -5,13 +5,40 @@
 #ifndef TOURNAMENTS_POSTGRES_CONNECTION_HPP
 #define TOURNAMENTS_POSTGRES_CONNECTION_HPP
 #include <memory>
+#include <string>
 #include <pqxx/pqxx>
 #include "IDbConnectionProvider.hpp"
+#include "SlowQueryLog.hpp"
 
 
 struct PostgresConnection final : IDbConnection{
     std::unique_ptr<pqxx::connection> connection;
-    explicit PostgresConnection(std::unique_ptr<pqxx::connection> connection) : connection(std::move(connection)) {
+    // null when the pool was built without a slow query log
+    std::shared_ptr<SlowQueryLog> slowQueries;
+
+    explicit PostgresConnection(std::unique_ptr<pqxx::connection> connection, std::shared_ptr<SlowQueryLog> slowQueries = nullptr)
+        : connection(std::move(connection)), slowQueries(std::move(slowQueries)) {
+    }
+
+    // Runs a prepared statement and times it. Nothing else runs on the request path, plans of slow
+    // executions come from auto_explain in the server log.
+    template<typename... Args>
+    pqxx::result Exec(pqxx::dbtransaction& tx, pqxx::zview statement, const Args&... args) {
+        const auto start = SlowQueryLog::Clock::now();
+        pqxx::result result = tx.exec(pqxx::prepped{statement}, pqxx::params{args...});
+        if (slowQueries == nullptr) {
+            return result;
+        }
+
+        const auto elapsed = SlowQueryLog::Clock::now() - start;
+        if (slowQueries->Observe(statement, elapsed) == SlowQueryLog::Verdict::SLOW) {
+            slowQueries->Record(statement, elapsed);
+        }
+        return result;
+    }
+
+    [[nodiscard]] bool IsHealthy() const override {
+        return connection != nullptr && connection->is_open();
     }
 };
 
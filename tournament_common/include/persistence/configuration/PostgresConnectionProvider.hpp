@@ -4,88 +4,437 @@
 
 #ifndef TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
 #define TOURNAMENTS_POSTGRESCONNECTIONPROVIDER_HPP
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
+#include <exception>
+#include <future>
+#include <optional>
 #include <queue>
+#include <string>
+#include <vector>
 #include <pqxx/pqxx>
 
 #include "IDbConnectionProvider.hpp"
 #include "PostgresConnection.hpp"
+#include "QueryWatchdog.hpp"
+#include "deadline/RequestDeadline.hpp"
+#include "profiling/LockProfiler.hpp"
+#include "exception/DeadlineExceeded.hpp"
 
 class PostgresConnectionProvider : public IDbConnectionProvider{
-    std::string_view connectionString;
+    // owned: it is read again whenever a dropped connection is reopened
+    std::string connectionString;
     size_t poolSize = 1;
+    // connections that exist, idle or borrowed; above poolSize after a shrink until the surplus comes back
+    size_t open = 0;
+    std::shared_ptr<SlowQueryLog> slowQueries;
     std::queue<std::unique_ptr<pqxx::connection>> connectionPool;
-    std::mutex connectionPoolMutex;
-    std::condition_variable connectionPoolCondition;
+    // named after the pool's workload, so the lock profile tells the pools apart
+    profiling::ProfiledMutex connectionPoolMutex;
+    std::condition_variable_any connectionPoolCondition;
+    QueryWatchdog watchdog;
+
+    // checkout wait accounting in one second windows, guarded by connectionPoolMutex
+    static constexpr std::chrono::seconds WAIT_WINDOW{1};
+    std::chrono::steady_clock::time_point windowStart = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration windowWait{0};
+    size_t windowCheckouts = 0;
+    size_t waiting = 0;
+    std::chrono::microseconds averageWait{0};
+
+    // Closes the current window once it is over. A window without checkouts reports no wait unless
+    // callers are still blocked in it, then the last average stands.
+    void RollWaitWindow(std::chrono::steady_clock::time_point now) {
+        if (now - windowStart < WAIT_WINDOW) {
+            return;
+        }
+        if (windowCheckouts > 0 && now - windowStart < 2 * WAIT_WINDOW) {
+            averageWait = std::chrono::duration_cast<std::chrono::microseconds>(windowWait / windowCheckouts);
+        } else if (waiting == 0) {
+            averageWait = std::chrono::microseconds{0};
+        }
+        windowStart = now;
+        windowWait = std::chrono::steady_clock::duration{0};
+        windowCheckouts = 0;
+    }
+
+    void RecordCheckout(std::chrono::steady_clock::time_point requested) {
+        const auto now = std::chrono::steady_clock::now();
+        RollWaitWindow(now);
+        windowWait += now - requested;
+        ++windowCheckouts;
+    }
+
+    // Opens one pooled connection with every prepared statement the repositories use
+    std::unique_ptr<pqxx::connection> Open() const {
+        auto connection = std::make_unique<pqxx::connection>(connectionString);
+        connection->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) on conflict ((document->>'name')) do nothing RETURNING id");
+        connection->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
+        connection->prepare("update_tournament", "UPDATE TOURNAMENTS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
+        connection->prepare("delete_tournament", "DELETE FROM TOURNAMENTS WHERE id = $1");
+        // $2 seconds back; the window keeps the MATCHES scan on match_last_update_idx
+        connection->prepare("select_recent_tournament_ids", R"(
+            with touched as (
+                select tournament_id as id, last_update_date from matches
+                where last_update_date >= localtimestamp - make_interval(secs => $2)
+                union all
+                select id, last_update_date from tournaments
+                where last_update_date >= localtimestamp - make_interval(secs => $2)
+            )
+            select id::text as id from touched
+            group by id
+            order by max(last_update_date) desc
+            limit $1
+        )");
+        // Typeahead: substring or fuzzy word match, both answered by the trigram GIN index on the name.
+        // $1 is the raw query, $2 the same text escaped for ILIKE. Prefix matches rank first.
+        connection->prepare("search_tournaments_by_name", R"(
+            select id, document from TOURNAMENTS
+            where document->>'name' ilike '%' || $2 || '%' or $1 <% (document->>'name')
+            order by document->>'name' ilike $2 || '%' desc, word_similarity($1, document->>'name') desc, document->>'name'
+            limit $3
+        )");
+        connection->prepare("search_teams_by_name", R"(
+            select id, document->>'name' as name from TEAMS
+            where document->>'name' ilike '%' || $2 || '%' or $1 <% (document->>'name')
+            order by document->>'name' ilike $2 || '%' desc, word_similarity($1, document->>'name') desc, document->>'name'
+            limit $3
+        )");
+        connection->prepare("insert_team", "insert into TEAMS (document) values($1) on conflict ((document->>'name')) do nothing RETURNING id");
+        connection->prepare("select_team_by_id", "select * from TEAMS where id = $1");
+        connection->prepare("update_team", "UPDATE TEAMS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
+        connection->prepare("delete_team", "DELETE FROM TEAMS WHERE id = $1");
+        connection->prepare("select_team_names", "select id::text as id, document->>'name' as name from TEAMS where id = any($1::uuid[])");
+        connection->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) on conflict (tournament_id, (document->>'name')) do nothing RETURNING id");
+        connection->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
+        connection->prepare("select_group_in_tournament", R"(
+            select * from groups
+            where  tournament_id = $1
+            and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
+        )");
+
+        connection->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
+        connection->prepare("select_group_by_group_id_team_id", R"(
+            select * from groups
+            where id = $1
+            and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
+        )");
+        connection->prepare("update_group", "UPDATE GROUPS SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
+        connection->prepare("update_group_add_team", R"(
+            update groups
+                set document = jsonb_insert(
+                        document, '{teams,-1}', $2
+                               ),
+                last_update_date = CURRENT_TIMESTAMP
+            where id = $1
+        )");
+        connection->prepare("delete_group", "DELETE FROM GROUPS WHERE id = $1 RETURNING id");
+        connection->prepare("insert_match", "insert into MATCHES (tournament_id, document) values($1, $2) RETURNING id");
+        connection->prepare("select_matches_by_tournament", "select * from MATCHES where tournament_id = $1");
+        connection->prepare("select_match_by_tournamentid_matchid", "select * from MATCHES where tournament_id = $1 and id = $2");
+        connection->prepare("select_match_by_tournamentid_name", "select * from MATCHES where tournament_id = $1 and document->>'name' = $2");
+        // group matches can end 0-0, the played flag tells a result from a match that is still pending
+        connection->prepare("update_match_score", R"(UPDATE MATCHES SET document = jsonb_set(document, '{score}', $2::jsonb) || '{"played": true}', last_update_date = CURRENT_TIMESTAMP WHERE id = $1)");
+        connection->prepare("update_match_schedules", R"(
+            update matches m set document = jsonb_set(m.document, '{schedule}', s.schedule), last_update_date = CURRENT_TIMESTAMP
+            from jsonb_to_recordset($1::jsonb) as s(id uuid, schedule jsonb)
+            where m.id = s.id
+        )");
+        // venues are shared, another tournament's matches keep their slots; the expression is match_schedule_idx
+        connection->prepare("select_venue_bookings", R"(
+            select document->'schedule'->>'venue' as venue, (document->'schedule'->>'startsAt')::bigint as starts_at
+            from MATCHES
+            where document ? 'schedule' and (document->'schedule'->>'startsAt')::bigint >= $2 and tournament_id <> $1
+        )");
+        connection->prepare("select_match_exists", "select 1 from MATCHES where tournament_id = $1 limit 1");
+        connection->prepare("select_group_match_exists", "select 1 from MATCHES where tournament_id = $1 and document->>'groupId' = $2 limit 1");
+        connection->prepare("lock_tournament_stage", "select pg_advisory_xact_lock(hashtextextended($1, 0))");
+        // Taken after lock_tournament_stage: the existence checks see whatever the previous holder committed
+        connection->prepare("insert_bracket", R"(
+            insert into matches (tournament_id, document)
+            select $1, bracket.document from jsonb_array_elements($2::jsonb) as bracket(document)
+            where not exists (select 1 from matches where tournament_id = $1)
+            returning id
+        )");
+        connection->prepare("insert_group_matches", R"(
+            insert into matches (tournament_id, document)
+            select $1, stage.document from jsonb_array_elements($3::jsonb) as stage(document)
+            where not exists (select 1 from matches where tournament_id = $1 and document->>'groupId' = $2)
+            returning id
+        )");
+        // Standings (3 points a win, 1 a draw; then goal difference, goals scored) ranked per group, the best
+        // $2 of every group seeded across groups by position first. Inserts the bracket in $3 with seed
+        // numbers replaced by team ids, only when every group match was played, no knockout match exists
+        // yet and exactly $4 teams qualified.
+        connection->prepare("insert_seeded_knockout", R"(
+            with results as (
+                select document->>'groupId' as group_id, document->>'homeTeamId' as team_id,
+                       (document->'score'->>'homeTeamScore')::int as scored, (document->'score'->>'visitorTeamScore')::int as conceded
+                from matches where tournament_id = $1 and document ? 'groupId'
+                union all
+                select document->>'groupId', document->>'visitorTeamId',
+                       (document->'score'->>'visitorTeamScore')::int, (document->'score'->>'homeTeamScore')::int
+                from matches where tournament_id = $1 and document ? 'groupId'
+            ), standings as (
+                select group_id, team_id,
+                       sum(case when scored > conceded then 3 when scored = conceded then 1 else 0 end) as points,
+                       sum(scored - conceded) as difference, sum(scored) as scored
+                from results group by group_id, team_id
+            ), ranked as (
+                select *, row_number() over (partition by group_id order by points desc, difference desc, scored desc, team_id) as position
+                from standings
+            ), seeds as (
+                select team_id, row_number() over (order by position, points desc, difference desc, scored desc, team_id) as seed
+                from ranked where position <= $2
+            ), ready as (
+                select exists (select 1 from matches where tournament_id = $1 and document ? 'groupId')
+                   and not exists (select 1 from matches where tournament_id = $1 and document ? 'groupId' and not document ? 'played')
+                   and not exists (select 1 from matches where tournament_id = $1 and not document ? 'groupId')
+                   and (select count(*) from seeds) = $4 as ok
+            )
+            insert into matches (tournament_id, document)
+            select $1, case when home.team_id is null then bracket.document
+                       else bracket.document || jsonb_build_object('homeTeamId', home.team_id, 'visitorTeamId', visitor.team_id) end
+            from jsonb_array_elements($3::jsonb) as bracket(document)
+            left join seeds home on home.seed::text = bracket.document->>'homeTeamId'
+            left join seeds visitor on visitor.seed::text = bracket.document->>'visitorTeamId'
+            where (select ok from ready)
+            returning id
+        )");
+        // Broker-less transport: the NOTIFY is delivered on commit and only wakes the listeners, they claim
+        // the rows themselves. One channel for every queue, the payload names the queue.
+        connection->prepare("enqueue_message", R"(
+            with enqueued as (insert into message_queue (queue, body) values ($1, $2))
+            select pg_notify('message_queue', $1)
+        )");
+        // Reconciliation scans, both only look at rows touched in ($1, $2] (epoch seconds) and return at most $3,
+        // in (last_update_date, id) order after the position the previous page ended at (the last two
+        // parameters, null on the first page).
+        // Full groups missing the matches their last team addition creates:
+        connection->prepare("select_stalled_groups", R"(
+            select g.tournament_id::text as tournament_id, g.id::text as group_id,
+                   g.last_update_date::text as last_update_date, g.id::text as position_id
+            from groups g join tournaments t on t.id = g.tournament_id
+            where g.last_update_date > to_timestamp($1)::timestamp and g.last_update_date <= to_timestamp($2)::timestamp
+              and ($4::timestamp is null or (g.last_update_date, g.id) > ($4::timestamp, $5::uuid))
+              and case when t.document->'format'->>'type' = 'GROUP_STAGE_KNOCKOUT'
+                       then jsonb_array_length(g.document->'teams') >= (t.document->'format'->>'maxTeamsPerGroup')::int
+                            and not exists (select 1 from matches m where m.tournament_id = g.tournament_id and m.document->>'groupId' = g.id::text)
+                       else jsonb_array_length(g.document->'teams') = 32
+                            and not exists (select 1 from matches m where m.tournament_id = g.tournament_id)
+                  end
+            order by g.last_update_date, g.id
+            limit $3
+        )");
+        // Played matches whose result never reached the bracket: a decided knockout match whose winner or loser
+        // is missing from its next match while that one still has a free slot ($4 maps match names to
+        // [winner next, loser next]), and one group match per finished group stage without knockout matches.
+        // That one is the stage's first touched match of the whole window, so later pages do not repeat it.
+        connection->prepare("select_unadvanced_results", R"(
+            with touched as (
+                select id, tournament_id, document, last_update_date from matches
+                where last_update_date > to_timestamp($1)::timestamp and last_update_date <= to_timestamp($2)::timestamp
+                  and document ? 'played'
+            ), knockout as (
+                select r.tournament_id, r.id, r.document->'score' as score, r.last_update_date
+                from touched r
+                join jsonb_each($4::jsonb) as successor(name, next) on successor.name = r.document->>'name'
+                cross join lateral (
+                    select (r.document->'score'->>'homeTeamScore')::int as home, (r.document->'score'->>'visitorTeamScore')::int as visitor
+                ) result
+                where not r.document ? 'groupId' and result.home <> result.visitor
+                  and ($5::timestamp is null or (r.last_update_date, r.id) > ($5::timestamp, $6::uuid))
+                  and exists (
+                      select 1 from (values
+                          (successor.next->>0, case when result.home > result.visitor then r.document->>'homeTeamId' else r.document->>'visitorTeamId' end),
+                          (successor.next->>1, case when result.home > result.visitor then r.document->>'visitorTeamId' else r.document->>'homeTeamId' end)
+                      ) as advance(name, team_id)
+                      join matches n on n.tournament_id = r.tournament_id and n.document->>'name' = advance.name
+                      where advance.team_id not in (coalesce(n.document->>'homeTeamId', ''), coalesce(n.document->>'visitorTeamId', ''))
+                        and (coalesce(n.document->>'homeTeamId', '') = '' or coalesce(n.document->>'visitorTeamId', '') = '')
+                  )
+            ), stage as (
+                select distinct on (g.tournament_id) g.tournament_id, g.id, g.document->'score' as score, g.last_update_date
+                from touched g
+                where g.document ? 'groupId'
+                  and not exists (select 1 from matches p where p.tournament_id = g.tournament_id and p.document ? 'groupId' and not p.document ? 'played')
+                  and not exists (select 1 from matches k where k.tournament_id = g.tournament_id and not k.document ? 'groupId')
+                order by g.tournament_id, g.last_update_date, g.id
+            )
+            select tournament_id::text as tournament_id, id::text as match_id, score::text as score,
+                   last_update_date::text as last_update_date, id::text as position_id
+            from (
+                select * from knockout
+                union all
+                select * from stage where $5::timestamp is null or (last_update_date, id) > ($5::timestamp, $6::uuid)
+            ) found
+            order by found.last_update_date, found.id
+            limit $3
+        )");
+        connection->prepare("update_match", "UPDATE MATCHES SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
+        // The slot is picked by the update itself: a concurrent one waits on the row lock and then sees
+        // this one's team, so two advancements into the same match never pick the same slot
+        connection->prepare("advance_team", R"(
+            update matches set document = case when coalesce(document->>'homeTeamId', '') = ''
+                                               then jsonb_set(document, '{homeTeamId}', to_jsonb($3::text))
+                                               else jsonb_set(document, '{visitorTeamId}', to_jsonb($3::text)) end,
+                               last_update_date = CURRENT_TIMESTAMP
+            where tournament_id = $1 and document->>'name' = $2
+              and $3 not in (coalesce(document->>'homeTeamId', ''), coalesce(document->>'visitorTeamId', ''))
+              and (coalesce(document->>'homeTeamId', '') = '' or coalesce(document->>'visitorTeamId', '') = '')
+            returning id
+        )");
+        connection->prepare("delete_match", "DELETE FROM MATCHES WHERE id = $1");
+        return connection;
+    }
+
+    // Connection setup is round trips (TCP, TLS, auth, one per prepared statement), so the connections
+    // are opened side by side and a pool is ready in the time of its slowest connection, not the sum
+    std::vector<std::unique_ptr<pqxx::connection>> OpenConcurrently(size_t count) const {
+        std::vector<std::future<std::unique_ptr<pqxx::connection>>> pending;
+        pending.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            pending.push_back(std::async(std::launch::async, [this] { return Open(); }));
+        }
+        std::vector<std::unique_ptr<pqxx::connection>> connections;
+        connections.reserve(count);
+        std::exception_ptr failure;
+        for (auto& connection : pending) {
+            try {
+                connections.push_back(connection.get());
+            } catch (...) {
+                failure = failure ? failure : std::current_exception();
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        return connections;
+    }
 
 public:
-    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize) : connectionString(connectionString), poolSize(poolSize) {
-        for (size_t i = 0; i < poolSize; i++) {
-            connectionPool.push(std::make_unique<pqxx::connection>(connectionString.data()));
-            connectionPool.back()->prepare("insert_tournament", "insert into TOURNAMENTS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_tournament_by_id", "select * from TOURNAMENTS where id = $1");
-            connectionPool.back()->prepare("update_tournament", "UPDATE TOURNAMENTS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
-            connectionPool.back()->prepare("delete_tournament", "DELETE FROM TOURNAMENTS WHERE id = $1");
-            connectionPool.back()->prepare("insert_team", "insert into TEAMS (document) values($1) RETURNING id");
-            connectionPool.back()->prepare("select_team_by_id", "select * from TEAMS where id = $1");
-            connectionPool.back()->prepare("update_team", "UPDATE TEAMS SET document = document || $1::jsonb WHERE id = $2 RETURNING document");
-            connectionPool.back()->prepare("delete_team", "DELETE FROM TEAMS WHERE id = $1");
-            connectionPool.back()->prepare("insert_group", "insert into GROUPS (tournament_id, document) values($1, $2) RETURNING id");
-            connectionPool.back()->prepare("select_groups_by_tournament", "select * from GROUPS where tournament_id = $1");
-            connectionPool.back()->prepare("select_group_in_tournament", R"(
-                select * from groups
-                where  tournament_id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
-            )");
-
-            connectionPool.back()->prepare("select_group_by_tournamentid_groupid", "select * from GROUPS where tournament_id = $1 and id = $2");
-            connectionPool.back()->prepare("select_group_by_group_id_team_id", R"(
-                select * from groups
-                where id = $1
-                and document @> jsonb_build_object('teams', jsonb_build_array(jsonb_build_object('id', $2::text)))
-            )");
-            connectionPool.back()->prepare("update_group", "UPDATE GROUPS SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
-            connectionPool.back()->prepare("update_group_add_team", R"(
-                update groups
-                    set document = jsonb_insert(
-                            document, '{teams,-1}', $2
-                                   ),
-                    last_update_date = CURRENT_TIMESTAMP
-                where id = $1
-            )");
-            connectionPool.back()->prepare("delete_group", "DELETE FROM GROUPS WHERE id = $1 RETURNING id");
-            connectionPool.back()->prepare("insert_match", "insert into MATCHES (tournament_id, document) values($1, $2) RETURNING id");
-            connectionPool.back()->prepare("select_matches_by_tournament", "select * from MATCHES where tournament_id = $1");
-            connectionPool.back()->prepare("select_match_by_tournamentid_matchid", "select * from MATCHES where tournament_id = $1 and id = $2");
-            connectionPool.back()->prepare("select_match_by_tournamentid_name", "select * from MATCHES where tournament_id = $1 and document->>'name' = $2");
-            connectionPool.back()->prepare("update_match_score", "UPDATE MATCHES SET document = jsonb_set(document, '{score}', $2::jsonb), last_update_date = CURRENT_TIMESTAMP WHERE id = $1");
-            connectionPool.back()->prepare("update_match", "UPDATE MATCHES SET document = $2, last_update_date = CURRENT_TIMESTAMP WHERE id = $1 RETURNING document");
-            connectionPool.back()->prepare("delete_match", "DELETE FROM MATCHES WHERE id = $1");
+    PostgresConnectionProvider(std::string_view connectionString, size_t poolSize, std::shared_ptr<SlowQueryLog> slowQueries = nullptr,
+                               std::string_view lockName = "postgres.pool")
+        : connectionString(connectionString), poolSize(poolSize), slowQueries(std::move(slowQueries)), connectionPoolMutex(lockName) {
+        for (auto& connection : OpenConcurrently(poolSize)) {
+            connectionPool.push(std::move(connection));
         }
+        open = poolSize;
     }
 
+    // Grows by opening the missing connections outside the lock, shrinks by closing idle connections
+    // now and borrowed ones as they come back
+    void Resize(Workload, size_t size) override {
+        size = std::max<size_t>(size, 1);
+        std::vector<std::unique_ptr<pqxx::connection>> surplus;
+        size_t missing = 0;
+        {
+            std::lock_guard lock(connectionPoolMutex);
+            poolSize = size;
+            while (open > poolSize && !connectionPool.empty()) {
+                surplus.push_back(std::move(connectionPool.front()));
+                connectionPool.pop();
+                --open;
+            }
+            if (poolSize > open) {
+                missing = poolSize - open;
+                open = poolSize;
+            }
+        }
+        if (missing == 0) {
+            return;
+        }
+        std::vector<std::unique_ptr<pqxx::connection>> added;
+        try {
+            added = OpenConcurrently(missing);
+        } catch (...) {
+            std::lock_guard lock(connectionPoolMutex);
+            open -= missing;
+            throw;
+        }
+        {
+            std::lock_guard lock(connectionPoolMutex);
+            for (auto& connection : added) {
+                connectionPool.push(std::move(connection));
+            }
+        }
+        connectionPoolCondition.notify_all();
+    }
+
+    std::chrono::microseconds CheckoutWait() override {
+        std::lock_guard lock(connectionPoolMutex);
+        RollWaitWindow(std::chrono::steady_clock::now());
+        return averageWait;
+    }
+
+    using IDbConnectionProvider::Connection;
+
     PooledConnection Connection() override {
+        const auto deadline = deadline::RequestDeadline::Current();
+        const auto requested = std::chrono::steady_clock::now();
         std::unique_lock lock(connectionPoolMutex);
 
-        // wait until a connection is available
-        connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+        // wait until a connection is available, a request gives up when its deadline passes
+        ++waiting;
+        if (deadline.has_value()) {
+            if (!connectionPoolCondition.wait_until(lock, *deadline, [this] { return !connectionPool.empty(); })) {
+                --waiting;
+                RecordCheckout(requested);
+                throw DeadlineExceededException("Request deadline exceeded waiting for a connection");
+            }
+        } else {
+            connectionPoolCondition.wait(lock, [this] { return !connectionPool.empty(); });
+        }
+        --waiting;
+        RecordCheckout(requested);
 
         // take one out
         auto conn = std::move(connectionPool.front());
         connectionPool.pop();
+        lock.unlock();
+
+        // a connection dropped by the server is replaced; if that fails too it goes back for a later retry
+        if (!conn->is_open()) {
+            try {
+                conn = Open();
+            } catch (...) {
+                {
+                    std::lock_guard guard(connectionPoolMutex);
+                    connectionPool.push(std::move(conn));
+                }
+                connectionPoolCondition.notify_one();
+                throw;
+            }
+        }
 
         // build PostgresConnection wrapper (adapts pqxx::connection -> IDbConnection)
-        auto dbc = new PostgresConnection(std::move(conn));
+        auto dbc = new PostgresConnection(std::move(conn), slowQueries);
+
+        std::optional<QueryWatchdog::Ticket> ticket;
+        if (deadline.has_value()) {
+            ticket = watchdog.Watch(*dbc->connection, *deadline);
+        }
 
         // return a RAII PooledConnection
         return PooledConnection(
             dbc,
-            [this](IDbConnection* dbc) {
+            [this, ticket](IDbConnection* dbc) {
                 auto pc = dynamic_cast<PostgresConnection*>(dbc);
+                if (ticket.has_value()) {
+                    watchdog.Release(*ticket);
+                }
 
+                std::unique_ptr<pqxx::connection> surplus;
                 {
-                    std::lock_guard<std::mutex> lock(connectionPoolMutex);
-                    connectionPool.push(std::move(pc->connection));
+                    std::lock_guard lock(connectionPoolMutex);
+                    if (open > poolSize) {
+                        // closed outside the lock when the pool was shrunk meanwhile
+                        surplus = std::move(pc->connection);
+                        --open;
+                    } else {
+                        connectionPool.push(std::move(pc->connection));
+                    }
                 }
 
                 delete pc;
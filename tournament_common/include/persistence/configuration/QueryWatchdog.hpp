@@ -0,0 +1,90 @@
+#ifndef TOURNAMENTS_QUERYWATCHDOG_HPP
+#define TOURNAMENTS_QUERYWATCHDOG_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <pqxx/pqxx>
+
+#include "deadline/RequestDeadline.hpp"
+
+// Sends a libpq cancel to connections still checked out past their request deadline. statement_timeout
+// already bounds each statement on the server; this covers the time between statements and a server
+// that stopped answering, so the connection comes back to the pool instead of pinning a worker.
+class QueryWatchdog {
+    struct Watched {
+        deadline::Clock::time_point deadline;
+        pqxx::connection* connection;
+        bool cancelled = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::map<uint64_t, Watched> watched;
+    uint64_t nextTicket = 0;
+    bool stopping = false;
+    std::thread worker;
+
+    void Run() {
+        std::unique_lock lock(mutex);
+        while (!stopping) {
+            auto next = deadline::Clock::time_point::max();
+            for (const auto& [ticket, entry] : watched) {
+                if (!entry.cancelled && entry.deadline < next) {
+                    next = entry.deadline;
+                }
+            }
+            if (next == deadline::Clock::time_point::max()) {
+                condition.wait(lock);
+                continue;
+            }
+            condition.wait_until(lock, next);
+
+            const auto now = deadline::Clock::now();
+            for (auto& [ticket, entry] : watched) {
+                if (!entry.cancelled && entry.deadline <= now) {
+                    // Release() blocks on the mutex, so the connection cannot go back to the pool mid-cancel
+                    try {
+                        entry.connection->cancel_query();
+                    } catch (const std::exception&) {
+                    }
+                    entry.cancelled = true;
+                }
+            }
+        }
+    }
+
+public:
+    using Ticket = uint64_t;
+
+    QueryWatchdog() : worker([this] { Run(); }) {}
+
+    ~QueryWatchdog() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        worker.join();
+    }
+
+    QueryWatchdog(const QueryWatchdog&) = delete;
+    QueryWatchdog& operator=(const QueryWatchdog&) = delete;
+
+    Ticket Watch(pqxx::connection& connection, deadline::Clock::time_point deadline) {
+        std::lock_guard lock(mutex);
+        const auto ticket = nextTicket++;
+        watched.emplace(ticket, Watched{deadline, &connection});
+        condition.notify_all();
+        return ticket;
+    }
+
+    void Release(Ticket ticket) {
+        std::lock_guard lock(mutex);
+        watched.erase(ticket);
+    }
+};
+
+#endif //TOURNAMENTS_QUERYWATCHDOG_HPP
@@ -0,0 +1,127 @@
+#ifndef COMMON_SLOW_QUERY_LOG_HPP
+#define COMMON_SLOW_QUERY_LOG_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// Plans are not captured here: auto_explain logs them inside the server from the slow execution itself
+// (see db_script.sql), keep its log_min_duration in step with threshold
+struct SlowQueryConfiguration {
+    std::chrono::milliseconds threshold{100};
+    size_t capacity = 64;
+};
+
+inline void from_json(const nlohmann::json& json, SlowQueryConfiguration& configuration) {
+    configuration.threshold = std::chrono::milliseconds(json.value("thresholdMillis", configuration.threshold.count()));
+    configuration.capacity = json.value("capacity", configuration.capacity);
+}
+
+struct StatementStatistics {
+    uint64_t calls = 0;
+    uint64_t slow = 0;
+    double totalMillis = 0;
+    double maxMillis = 0;
+};
+
+inline void to_json(nlohmann::json& json, const StatementStatistics& statistics) {
+    json = {
+        {"calls", statistics.calls},
+        {"slow", statistics.slow},
+        {"totalMillis", statistics.totalMillis},
+        {"meanMillis", statistics.calls == 0 ? 0.0 : statistics.totalMillis / statistics.calls},
+        {"maxMillis", statistics.maxMillis},
+    };
+}
+
+struct SlowQuery {
+    std::string statement;
+    double millis = 0;
+    std::chrono::system_clock::time_point at;
+};
+
+inline void to_json(nlohmann::json& json, const SlowQuery& query) {
+    json = {
+        {"statement", query.statement},
+        {"millis", query.millis},
+        {"at", std::chrono::duration_cast<std::chrono::milliseconds>(query.at.time_since_epoch()).count()},
+    };
+}
+
+// Per prepared statement timings plus a bounded buffer of the most recent slow executions. Every slow
+// execution is also written to stderr as one JSON line so the log shipper picks it up.
+class SlowQueryLog {
+public:
+    using Clock = std::chrono::steady_clock;
+    enum class Verdict { FAST, SLOW };
+
+private:
+    SlowQueryConfiguration configuration;
+    mutable std::mutex mutex;
+    std::map<std::string, StatementStatistics, std::less<>> statements;
+    std::deque<SlowQuery> recent;
+
+    static double millis(Clock::duration elapsed) {
+        return std::chrono::duration<double, std::milli>(elapsed).count();
+    }
+
+public:
+    explicit SlowQueryLog(SlowQueryConfiguration configuration = {}) : configuration(configuration) {}
+
+    void Reconfigure(const SlowQueryConfiguration& settings) {
+        std::lock_guard lock(mutex);
+        configuration = settings;
+        while (recent.size() > configuration.capacity) {
+            recent.pop_front();
+        }
+    }
+
+    [[nodiscard]] Verdict Observe(std::string_view statement, Clock::duration elapsed) {
+        std::lock_guard lock(mutex);
+        auto entry = statements.find(statement);
+        if (entry == statements.end()) {
+            entry = statements.emplace(std::string(statement), StatementStatistics{}).first;
+        }
+        auto& statistics = entry->second;
+        statistics.calls++;
+        statistics.totalMillis += millis(elapsed);
+        statistics.maxMillis = std::max(statistics.maxMillis, millis(elapsed));
+        if (elapsed < configuration.threshold) {
+            return Verdict::FAST;
+        }
+        statistics.slow++;
+        return Verdict::SLOW;
+    }
+
+    void Record(std::string_view statement, Clock::duration elapsed) {
+        SlowQuery query{std::string(statement), millis(elapsed), std::chrono::system_clock::now()};
+        nlohmann::json line = query;
+        line["event"] = "slow_query";
+        std::clog << line.dump() << '\n';
+
+        std::lock_guard lock(mutex);
+        recent.push_back(std::move(query));
+        while (recent.size() > configuration.capacity) {
+            recent.pop_front();
+        }
+    }
+
+    [[nodiscard]] std::vector<SlowQuery> Recent() const {
+        std::lock_guard lock(mutex);
+        return {recent.rbegin(), recent.rend()};
+    }
+
+    [[nodiscard]] std::map<std::string, StatementStatistics, std::less<>> Statements() const {
+        std::lock_guard lock(mutex);
+        return statements;
+    }
+};
+
+#endif //COMMON_SLOW_QUERY_LOG_HPP
@@ -0,0 +1,24 @@
+#ifndef TOURNAMENTS_STATEMENTTIMEOUT_HPP
+#define TOURNAMENTS_STATEMENTTIMEOUT_HPP
+
+#include <format>
+#include <pqxx/pqxx>
+
+#include "deadline/RequestDeadline.hpp"
+#include "exception/DeadlineExceeded.hpp"
+
+// Bounds every statement of the transaction by what is left of the request deadline. SET LOCAL ends
+// with the transaction, so the pooled connection goes back without a timeout for the next borrower.
+inline void ApplyStatementTimeout(pqxx::transaction_base& tx) {
+    const auto remaining = deadline::RequestDeadline::Remaining();
+    if (!remaining.has_value()) {
+        return;
+    }
+    // statement_timeout = 0 disables the timeout, an exhausted budget must fail instead
+    if (remaining->count() <= 0) {
+        throw DeadlineExceededException("Request deadline exceeded");
+    }
+    tx.exec(std::format("SET LOCAL statement_timeout = {}", remaining->count()));
+}
+
+#endif //TOURNAMENTS_STATEMENTTIMEOUT_HPP
@@ -0,0 +1,31 @@
+#ifndef COMMON_DOCUMENTDECODERS_HPP
+#define COMMON_DOCUMENTDECODERS_HPP
+
+#include <memory>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "persistence/decoder/IDocumentDecoder.hpp"
+#include "persistence/decoder/JsonDocumentDecoder.hpp"
+#include "persistence/decoder/SimdDocumentDecoder.hpp"
+
+namespace config {
+    // Resolves the decoder of a repository from databaseConfig.documentDecoder, e.g.
+    // {"default": "simdjson", "teams": "nlohmann"}. Anything unset keeps the nlohmann decoder.
+    inline std::shared_ptr<IDocumentDecoder> documentDecoder(const nlohmann::json& databaseConfig, const std::string& repository) {
+        static const auto json = std::make_shared<JsonDocumentDecoder>();
+        static const auto simd = std::make_shared<SimdDocumentDecoder>();
+
+        std::string name = "nlohmann";
+        if (databaseConfig.contains("documentDecoder")) {
+            const auto& decoders = databaseConfig["documentDecoder"];
+            name = decoders.value(repository, decoders.value("default", name));
+        }
+        if (name == "simdjson") {
+            return simd;
+        }
+        return json;
+    }
+}
+
+#endif //COMMON_DOCUMENTDECODERS_HPP
@@ -0,0 +1,21 @@
+#ifndef COMMON_IDOCUMENTDECODER_HPP
+#define COMMON_IDOCUMENTDECODER_HPP
+
+#include <string_view>
+
+#include "domain/Team.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Tournament.hpp"
+
+// Turns the JSONB document column of a row into its domain object, ids come from the id column
+class IDocumentDecoder {
+public:
+    virtual ~IDocumentDecoder() = default;
+    virtual void Decode(std::string_view document, domain::Team& team) = 0;
+    virtual void Decode(std::string_view document, domain::Tournament& tournament) = 0;
+    virtual void Decode(std::string_view document, domain::Group& group) = 0;
+    virtual void Decode(std::string_view document, domain::Match& match) = 0;
+};
+
+#endif //COMMON_IDOCUMENTDECODER_HPP
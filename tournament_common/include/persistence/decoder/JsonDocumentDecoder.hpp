@@ -0,0 +1,22 @@
+#ifndef COMMON_JSONDOCUMENTDECODER_HPP
+#define COMMON_JSONDOCUMENTDECODER_HPP
+
+#include <nlohmann/json.hpp>
+
+#include "persistence/decoder/IDocumentDecoder.hpp"
+#include "domain/Utilities.hpp"
+
+// Builds a nlohmann DOM and goes through the from_json converters in domain/Utilities.hpp
+class JsonDocumentDecoder : public IDocumentDecoder {
+    template<typename Type>
+    static void decode(std::string_view document, Type& entity) {
+        nlohmann::json::parse(document).get_to(entity);
+    }
+public:
+    void Decode(std::string_view document, domain::Team& team) override { decode(document, team); }
+    void Decode(std::string_view document, domain::Tournament& tournament) override { decode(document, tournament); }
+    void Decode(std::string_view document, domain::Group& group) override { decode(document, group); }
+    void Decode(std::string_view document, domain::Match& match) override { decode(document, match); }
+};
+
+#endif //COMMON_JSONDOCUMENTDECODER_HPP
@@ -0,0 +1,16 @@
+#ifndef COMMON_SIMDDOCUMENTDECODER_HPP
+#define COMMON_SIMDDOCUMENTDECODER_HPP
+
+#include "persistence/decoder/IDocumentDecoder.hpp"
+
+// simdjson on-demand decoding straight into the domain objects, no intermediate DOM.
+// Parser and padded buffer are thread local, so one instance can be shared by every repository.
+class SimdDocumentDecoder : public IDocumentDecoder {
+public:
+    void Decode(std::string_view document, domain::Team& team) override;
+    void Decode(std::string_view document, domain::Tournament& tournament) override;
+    void Decode(std::string_view document, domain::Group& group) override;
+    void Decode(std::string_view document, domain::Match& match) override;
+};
+
+#endif //COMMON_SIMDDOCUMENTDECODER_HPP
@@ -0,0 +1,23 @@
+#ifndef TOURNAMENTS_EXPORTREPOSITORY_HPP
+#define TOURNAMENTS_EXPORTREPOSITORY_HPP
+
+#include <memory>
+#include <string>
+
+#include "IExportRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+// Streams tournaments, groups and matches straight out of a COPY ... TO STDOUT,
+// one row at a time, so the export never holds a full pqxx::result in memory.
+class ExportRepository : public IExportRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+
+    void Stream(const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink);
+public:
+    explicit ExportRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    void ExportTournament(const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink) override;
+    void ExportAll(ExportFormat format, const ExportSink& sink) override;
+};
+
+#endif //TOURNAMENTS_EXPORTREPOSITORY_HPP
@@ -11,19 +11,21 @@
 #include "IGroupRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/decoder/IDocumentDecoder.hpp"
 #include "domain/Group.hpp"
 #include "domain/Utilities.hpp"
 
 class GroupRepository : public IGroupRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<IDocumentDecoder> documentDecoder;
 public:
-    explicit GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, const std::shared_ptr<IDocumentDecoder>& documentDecoder);
     std::shared_ptr<domain::Group> ReadById(std::string id) override;
-    std::string Create (const domain::Group & entity) override;
+    std::expected<std::string, Error> Create (const domain::Group & entity) override;
     std::string Update (const domain::Group & entity) override;
     void Delete(std::string id) override;
-    std::vector<std::shared_ptr<domain::Group>> ReadAll() override;
-    std::vector<std::shared_ptr<domain::Group>> FindByTournamentId(const std::string_view& tournamentId) override;
+    std::vector<domain::Group> ReadAll() override;
+    std::vector<domain::Group> FindByTournamentId(const std::string_view& tournamentId) override;
     std::shared_ptr<domain::Group> FindByTournamentIdAndGroupId(const std::string_view& tournamentId, const std::string_view& groupId) override;
     std::shared_ptr<domain::Group> FindByTournamentIdAndTeamId(const std::string_view& tournamentId, const std::string_view& teamId) override;
     std::shared_ptr<domain::Group> FindByGroupIdAndTeamId(const std::string_view& groupId, const std::string_view& teamId) override;
@@ -0,0 +1,22 @@
+#ifndef TOURNAMENTS_IEXPORTREPOSITORY_HPP
+#define TOURNAMENTS_IEXPORTREPOSITORY_HPP
+
+#include <functional>
+#include <string_view>
+
+enum class ExportFormat {
+    NDJSON,
+    CSV
+};
+
+// Receives one serialized line (terminator included) per exported row
+using ExportSink = std::function<void(std::string_view)>;
+
+class IExportRepository {
+public:
+    virtual ~IExportRepository() = default;
+    virtual void ExportTournament(const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink) = 0;
+    virtual void ExportAll(ExportFormat format, const ExportSink& sink) = 0;
+};
+
+#endif //TOURNAMENTS_IEXPORTREPOSITORY_HPP
@@ -0,0 +1,35 @@
+#ifndef TOURNAMENTS_IIDEMPOTENCYREPOSITORY_HPP
+#define TOURNAMENTS_IIDEMPOTENCYREPOSITORY_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Response recorded for an Idempotency-Key, replayed verbatim to retries
+struct StoredResponse {
+    int status = 0;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+};
+
+struct IdempotencyRecord {
+    std::string fingerprint;
+    // empty while the first request with the key is still executing
+    std::optional<StoredResponse> response;
+};
+
+class IIdempotencyRepository {
+public:
+    virtual ~IIdempotencyRepository() = default;
+    // True when this request now owns the key and has to execute; false when another request already does
+    virtual bool Reserve(std::string_view key, std::string_view scope, std::string_view fingerprint) = 0;
+    virtual std::optional<IdempotencyRecord> Find(std::string_view key, std::string_view scope) = 0;
+    virtual void Complete(std::string_view key, std::string_view scope, const StoredResponse& response) = 0;
+    // Drops a reservation whose execution failed, so a retry runs it again
+    virtual void Release(std::string_view key, std::string_view scope) = 0;
+    virtual void PurgeExpired() = 0;
+};
+
+#endif //TOURNAMENTS_IIDEMPOTENCYREPOSITORY_HPP
@@ -0,0 +1,41 @@
+#ifndef TOURNAMENTS_IIMPORTREPOSITORY_HPP
+#define TOURNAMENTS_IIMPORTREPOSITORY_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+struct ImportSummary {
+    size_t lines = 0;
+    size_t staged = 0;
+    size_t rejected = 0;
+    size_t teamsCreated = 0;
+    size_t tournamentsCreated = 0;
+    size_t groupsCreated = 0;
+    std::vector<std::string> errors; // first rejections only, see ImportRepository
+};
+
+inline void to_json(nlohmann::json& json, const ImportSummary& summary) {
+    json = {
+        {"lines", summary.lines},
+        {"staged", summary.staged},
+        {"rejected", summary.rejected},
+        {"teamsCreated", summary.teamsCreated},
+        {"tournamentsCreated", summary.tournamentsCreated},
+        {"groupsCreated", summary.groupsCreated},
+        {"errors", summary.errors}
+    };
+}
+
+// Fills the next NDJSON line (without terminator), returns false once the input is exhausted
+using ImportSource = std::function<bool(std::string& line)>;
+
+class IImportRepository {
+public:
+    virtual ~IImportRepository() = default;
+    virtual ImportSummary Import(const ImportSource& source) = 0;
+};
+
+#endif //TOURNAMENTS_IIMPORTREPOSITORY_HPP
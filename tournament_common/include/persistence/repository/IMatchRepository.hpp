@@ -5,22 +5,45 @@
 #ifndef TOURNAMENTS_IMATCHREPOSITORY_HPP
 #define TOURNAMENTS_IMATCHREPOSITORY_HPP
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 #include <memory>
 
 #include "domain/Match.hpp"
 #include "IRepository.hpp"
+#include "persistence/configuration/Durability.hpp"
 
 class IMatchRepository {
 public:
     virtual ~IMatchRepository() = default;
-    virtual std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(const std::string_view& tournamentId) = 0;
+    virtual std::vector<domain::Match> FindByTournamentId(const std::string_view& tournamentId) = 0;
     virtual std::shared_ptr<domain::Match> FindByTournamentIdAndMatchId(const std::string_view& tournamentId, const std::string_view& matchId) = 0;
     virtual std::shared_ptr<domain::Match> FindByTournamentIdAndName(const std::string_view& tournamentId, const std::string_view& name) = 0;
     virtual void UpdateMatchScore(const std::string_view& matchId, const domain::Score& score) = 0;
-    virtual void Update(const std::string_view& matchId, const domain::Match& match) = 0;
+    virtual void Update(const std::string_view& matchId, const domain::Match& match, Durability durability = Durability::DURABLE) = 0;
+    // Puts teamId into the first free slot of the tournament's match `matchName` (home, then visitor) in one
+    // conditional statement, so a live event and a replay advancing into the same match cannot overwrite
+    // each other. False when the team is already there or no slot is free. Advancement can be recomputed
+    // from the scores, callers may pass RECOMPUTABLE.
+    virtual bool AdvanceTeam(const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId,
+                             Durability durability = Durability::DURABLE) = 0;
     virtual std::vector<std::string> CreateBulk(const std::vector<domain::Match>& matches) = 0; //agregar todos los matches de una vez
+    // Insert `matches` under the tournament's stage lock unless the tournament already has matches, or the
+    // group has its matches, so a live team addition and its replay create them once. Return the created
+    // ids, empty when the matches existed already.
+    virtual std::vector<std::string> CreateBracket(const std::string_view& tournamentId, const std::vector<domain::Match>& matches) = 0;
+    virtual std::vector<std::string> CreateGroupMatches(const std::string_view& tournamentId, const std::string_view& groupId,
+                                                        const std::vector<domain::Match>& matches) = 0;
+    // Writes only the schedule of each match, in one statement
+    virtual void UpdateSchedules(const std::vector<domain::Match>& matches) = 0;
+    // Venue and start of every match of the other tournaments starting at or after `from` (seconds since epoch)
+    virtual std::vector<domain::Schedule> FindVenueBookings(const std::string_view& tournamentId, int64_t from) = 0;
     virtual bool MatchesExistForTournament(const std::string_view& tournamentId) = 0;
+    virtual bool MatchesExistForGroup(const std::string_view& tournamentId, const std::string_view& groupId) = 0;
+    // Seeds the qualifiers of a finished group stage into `bracket`, whose first round holds seed numbers
+    // instead of team ids. Returns the created ids, empty while group matches are pending or once the
+    // knockout stage exists.
+    virtual std::vector<std::string> StartKnockoutStage(const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket) = 0;
 };
 #endif //TOURNAMENTS_IMATCHREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,30 @@
+#ifndef COMMON_INAMESEARCH_HPP
+#define COMMON_INAMESEARCH_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Partial name lookup for typeahead, served by the pg_trgm index on document->>'name'
+template<typename Type>
+class INameSearch {
+public:
+    virtual ~INameSearch() = default;
+    // At most `limit` entities whose name contains `query` or resembles it, best matches first
+    virtual std::vector<Type> SearchByName(std::string_view query, size_t limit) = 0;
+};
+
+// `query` as a literal inside an ILIKE pattern
+inline std::string EscapeLikePattern(std::string_view query) {
+    std::string escaped;
+    escaped.reserve(query.size());
+    for (const char character : query) {
+        if (character == '%' || character == '_' || character == '\\') {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(character);
+    }
+    return escaped;
+}
+
+#endif //COMMON_INAMESEARCH_HPP
@@ -0,0 +1,49 @@
+#ifndef TOURNAMENTS_IRECONCILIATIONREPOSITORY_HPP
+#define TOURNAMENTS_IRECONCILIATIONREPOSITORY_HPP
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "domain/Match.hpp"
+
+// Where a scan stopped: last_update_date and id of the last row it returned, empty before the first page
+struct ScanPosition {
+    std::string lastUpdate;
+    std::string id;
+};
+
+// A full group whose team-add event never created its matches
+struct StalledGroup {
+    std::string tournamentId;
+    std::string groupId;
+    ScanPosition position;
+};
+
+// A played match whose score-update event never advanced the bracket
+struct StalledResult {
+    std::string tournamentId;
+    std::string matchId;
+    domain::Score score;
+    ScanPosition position;
+};
+
+// Set based scans for bracket state a lost event left behind. Both only read rows last touched in
+// (since, until], so a periodic run costs what changed since the previous one. Pages come in
+// (last_update_date, id) order and start after `after`, so rows a repair could not fix do not come
+// back and crowd out the ones behind them.
+class IReconciliationRepository {
+public:
+    using Clock = std::chrono::system_clock;
+    // knockout match name -> (next match of the winner, next match of the loser), empty when there is none
+    using Successors = std::map<std::string, std::pair<std::string, std::string>>;
+
+    virtual ~IReconciliationRepository() = default;
+    virtual std::vector<StalledGroup> FindStalledGroups(Clock::time_point since, Clock::time_point until, size_t limit, const ScanPosition& after) = 0;
+    virtual std::vector<StalledResult> FindUnadvancedResults(Clock::time_point since, Clock::time_point until, size_t limit,
+                                                             const Successors& successors, const ScanPosition& after) = 0;
+};
+
+#endif //TOURNAMENTS_IRECONCILIATIONREPOSITORY_HPP
@@ -4,17 +4,22 @@
 
 #ifndef RESTAPI_IREPOSITORY_HPP
 #define RESTAPI_IREPOSITORY_HPP
+#include <expected>
+#include <string>
 #include <vector>
 #include <memory>
 
+#include "exception/Error.hpp"
+
 template<typename Type, typename Id>
 class IRepository {
 public:
     virtual ~IRepository() = default;
     virtual std::shared_ptr<Type> ReadById(Id id) = 0;
-    virtual Id Create (const Type & entity) = 0;
+    // Returns the generated id, or Error::DUPLICATE when the entity's unique key is already taken
+    virtual std::expected<std::string, Error> Create (const Type & entity) = 0;
     virtual Id Update (const Type & entity) = 0;
     virtual void Delete(Id id) = 0;
-    virtual std::vector<std::shared_ptr<Type>> ReadAll() = 0;
+    virtual std::vector<Type> ReadAll() = 0;
 };
 #endif //RESTAPI_IREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef COMMON_ITEAMDICTIONARY_HPP
+#define COMMON_ITEAMDICTIONARY_HPP
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "domain/Group.hpp"
+
+// Team id to name lookup. Group documents only store team ids, names are resolved through this at read time.
+class ITeamDictionary {
+public:
+    virtual ~ITeamDictionary() = default;
+    // Names of the given ids, unknown ids are absent from the result
+    virtual std::unordered_map<std::string, std::string> Names(const std::vector<std::string>& teamIds) = 0;
+    virtual void Invalidate(std::string_view teamId) = 0;
+};
+
+// Fills the team names of every group with a single dictionary lookup
+inline void ResolveTeamNames(ITeamDictionary& dictionary, std::vector<domain::Group>& groups) {
+    std::vector<std::string> teamIds;
+    for (const auto& group : groups) {
+        for (const auto& team : group.Teams()) {
+            teamIds.push_back(team.Id);
+        }
+    }
+    if (teamIds.empty()) {
+        return;
+    }
+    const auto names = dictionary.Names(teamIds);
+    for (auto& group : groups) {
+        for (auto& team : group.Teams()) {
+            if (const auto name = names.find(team.Id); name != names.end()) {
+                team.Name = name->second;
+            }
+        }
+    }
+}
+
+inline void ResolveTeamNames(ITeamDictionary& dictionary, domain::Group& group) {
+    if (group.Teams().empty()) {
+        return;
+    }
+    std::vector<std::string> teamIds;
+    teamIds.reserve(group.Teams().size());
+    for (const auto& team : group.Teams()) {
+        teamIds.push_back(team.Id);
+    }
+    const auto names = dictionary.Names(teamIds);
+    for (auto& team : group.Teams()) {
+        if (const auto name = names.find(team.Id); name != names.end()) {
+            team.Name = name->second;
+        }
+    }
+}
+
+#endif //COMMON_ITEAMDICTIONARY_HPP
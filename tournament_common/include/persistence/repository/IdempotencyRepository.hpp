@@ -0,0 +1,23 @@
+#ifndef TOURNAMENTS_IDEMPOTENCYREPOSITORY_HPP
+#define TOURNAMENTS_IDEMPOTENCYREPOSITORY_HPP
+
+#include <memory>
+
+#include "IIdempotencyRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+// Keys live in IDEMPOTENCY_KEYS for 24 hours. A reservation that never completed (replica died
+// mid-request) can be taken over after 10 minutes, longer than any route deadline.
+class IdempotencyRepository : public IIdempotencyRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit IdempotencyRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    bool Reserve(std::string_view key, std::string_view scope, std::string_view fingerprint) override;
+    std::optional<IdempotencyRecord> Find(std::string_view key, std::string_view scope) override;
+    void Complete(std::string_view key, std::string_view scope, const StoredResponse& response) override;
+    void Release(std::string_view key, std::string_view scope) override;
+    void PurgeExpired() override;
+};
+
+#endif //TOURNAMENTS_IDEMPOTENCYREPOSITORY_HPP
@@ -0,0 +1,25 @@
+#ifndef TOURNAMENTS_IMPORTREPOSITORY_HPP
+#define TOURNAMENTS_IMPORTREPOSITORY_HPP
+
+#include <memory>
+
+#include "IImportRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+// Parses NDJSON one line at a time, COPYs accepted lines into IMPORT_STAGING and merges the
+// batch into TEAMS, TOURNAMENTS and GROUPS with set based inserts deduplicated on the unique name indexes.
+// A group whose tournament or teams do not resolve by name is rejected like an invalid line.
+//
+// Line shapes:
+//   {"type":"team","name":"Team A"}
+//   {"type":"tournament","name":"Cup","format":{"numberOfGroups":1,"maxTeamsPerGroup":32}}
+//   {"type":"group","tournament":"Cup","name":"Group A","teams":["Team A","Team B"]}
+class ImportRepository : public IImportRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit ImportRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    ImportSummary Import(const ImportSource& source) override;
+};
+
+#endif //TOURNAMENTS_IMPORTREPOSITORY_HPP
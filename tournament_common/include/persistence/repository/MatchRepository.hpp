@@ -7,20 +7,30 @@
 #include "IMatchRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/decoder/IDocumentDecoder.hpp"
 #include "domain/Match.hpp"
 #include "domain/Utilities.hpp"
 
 class MatchRepository : public IMatchRepository {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<IDocumentDecoder> documentDecoder;
 public:
-    explicit MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
-    std::vector<std::shared_ptr<domain::Match>> FindByTournamentId(const std::string_view& tournamentId) override;
+    MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, const std::shared_ptr<IDocumentDecoder>& documentDecoder);
+    std::vector<domain::Match> FindByTournamentId(const std::string_view& tournamentId) override;
     std::shared_ptr<domain::Match> FindByTournamentIdAndMatchId(const std::string_view& tournamentId, const std::string_view& matchId) override;
     std::shared_ptr<domain::Match> FindByTournamentIdAndName(const std::string_view& tournamentId, const std::string_view& name) override;
     void UpdateMatchScore(const std::string_view& matchId, const domain::Score& score) override;
-    void Update(const std::string_view& matchId, const domain::Match& match) override;
+    void Update(const std::string_view& matchId, const domain::Match& match, Durability durability) override;
+    bool AdvanceTeam(const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId, Durability durability) override;
     std::vector<std::string> CreateBulk(const std::vector<domain::Match>& matches) override;
+    std::vector<std::string> CreateBracket(const std::string_view& tournamentId, const std::vector<domain::Match>& matches) override;
+    std::vector<std::string> CreateGroupMatches(const std::string_view& tournamentId, const std::string_view& groupId,
+                                                const std::vector<domain::Match>& matches) override;
+    void UpdateSchedules(const std::vector<domain::Match>& matches) override;
+    std::vector<domain::Schedule> FindVenueBookings(const std::string_view& tournamentId, int64_t from) override;
     bool MatchesExistForTournament(const std::string_view& tournamentId) override;
+    bool MatchesExistForGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
+    std::vector<std::string> StartKnockoutStage(const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket) override;
 };
 
 #endif //TOURNAMENTS_MATCHREPOSITORY_HPP
\ No newline at end of file
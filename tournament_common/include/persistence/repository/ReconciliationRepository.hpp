@@ -0,0 +1,19 @@
+#ifndef TOURNAMENTS_RECONCILIATIONREPOSITORY_HPP
+#define TOURNAMENTS_RECONCILIATIONREPOSITORY_HPP
+
+#include <memory>
+
+#include "IReconciliationRepository.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+
+class ReconciliationRepository : public IReconciliationRepository {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit ReconciliationRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider);
+    std::vector<StalledGroup> FindStalledGroups(Clock::time_point since, Clock::time_point until, size_t limit, const ScanPosition& after) override;
+    std::vector<StalledResult> FindUnadvancedResults(Clock::time_point since, Clock::time_point until, size_t limit,
+                                                     const Successors& successors, const ScanPosition& after) override;
+};
+
+#endif //TOURNAMENTS_RECONCILIATIONREPOSITORY_HPP
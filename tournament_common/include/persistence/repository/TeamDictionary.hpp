@@ -0,0 +1,102 @@
+#ifndef COMMON_TEAMDICTIONARY_HPP
+#define COMMON_TEAMDICTIONARY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "ITeamDictionary.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+struct TeamDictionaryConfiguration {
+    // renames done through another replica show up after at most this long
+    std::chrono::seconds ttl{30};
+    size_t capacity = 16384;
+};
+
+inline void from_json(const nlohmann::json& json, TeamDictionaryConfiguration& configuration) {
+    configuration.ttl = std::chrono::seconds(json.value("ttlSeconds", configuration.ttl.count()));
+    configuration.capacity = json.value("capacity", configuration.capacity);
+}
+
+// Process wide team name cache. Misses of one lookup are fetched from the teams table in one query.
+class TeamDictionary : public ITeamDictionary {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Entry {
+        std::string name;
+        Clock::time_point expiresAt;
+    };
+
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    TeamDictionaryConfiguration configuration;
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+
+protected:
+    // One round trip for every id in teamIds
+    virtual std::unordered_map<std::string, std::string> Fetch(const std::vector<std::string>& teamIds);
+
+public:
+    TeamDictionary(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, TeamDictionaryConfiguration configuration = {})
+        : connectionProvider(connectionProvider), configuration(configuration) {}
+
+    std::unordered_map<std::string, std::string> Names(const std::vector<std::string>& teamIds) override {
+        std::unordered_map<std::string, std::string> names;
+        std::vector<std::string> missing;
+        const auto now = Clock::now();
+        {
+            std::lock_guard lock(mutex);
+            for (const auto& teamId : teamIds) {
+                if (const auto entry = entries.find(teamId); entry != entries.end() && entry->second.expiresAt > now) {
+                    names.emplace(teamId, entry->second.name);
+                } else if (!names.contains(teamId)) {
+                    missing.push_back(teamId);
+                }
+            }
+        }
+        if (missing.empty()) {
+            return names;
+        }
+        std::ranges::sort(missing);
+        missing.erase(std::ranges::unique(missing).begin(), missing.end());
+
+        auto fetched = Fetch(missing);
+        std::lock_guard lock(mutex);
+        if (entries.size() + fetched.size() > configuration.capacity) {
+            std::erase_if(entries, [now](const auto& entry) { return entry.second.expiresAt <= now; });
+            if (entries.size() + fetched.size() > configuration.capacity) {
+                entries.clear();
+            }
+        }
+        for (auto& [teamId, name] : fetched) {
+            entries.insert_or_assign(teamId, Entry{name, now + configuration.ttl});
+            names.emplace(teamId, std::move(name));
+        }
+        return names;
+    }
+
+    // Entries already cached keep the expiry they were fetched with
+    void Reconfigure(const TeamDictionaryConfiguration& settings) {
+        std::lock_guard lock(mutex);
+        configuration = settings;
+        if (entries.size() > configuration.capacity) {
+            entries.clear();
+        }
+    }
+
+    void Invalidate(std::string_view teamId) override {
+        std::lock_guard lock(mutex);
+        entries.erase(std::string(teamId));
+    }
+};
+
+#endif //COMMON_TEAMDICTIONARY_HPP
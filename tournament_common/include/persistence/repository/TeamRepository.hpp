@@ -8,26 +8,31 @@
 
 
 #include "IRepository.hpp"
+#include "INameSearch.hpp"
 #include "domain/Team.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/decoder/IDocumentDecoder.hpp"
 
 
-class TeamRepository : public IRepository<domain::Team, std::string_view> {
+class TeamRepository : public IRepository<domain::Team, std::string_view>, public INameSearch<domain::Team> {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<IDocumentDecoder> documentDecoder;
 public:
 
 
-    explicit TeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+    TeamRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider, std::shared_ptr<IDocumentDecoder> documentDecoder);
 
-    std::vector<std::shared_ptr<domain::Team>> ReadAll() override;
+    std::vector<domain::Team> ReadAll() override;
 
     std::shared_ptr<domain::Team> ReadById(std::string_view id) override;
 
-    std::string_view Create(const domain::Team &entity) override;
+    std::expected<std::string, Error> Create(const domain::Team &entity) override;
 
     std::string_view Update(const domain::Team &entity) override;
 
     void Delete(std::string_view id) override;
+
+    std::vector<domain::Team> SearchByName(std::string_view query, size_t limit) override;
 };
 
 
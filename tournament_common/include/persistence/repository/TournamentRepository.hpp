@@ -4,22 +4,30 @@
 
 #ifndef TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
 #define TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
+#include <chrono>
 #include <string>
 
 #include "IRepository.hpp"
+#include "INameSearch.hpp"
 #include "domain/Tournament.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/decoder/IDocumentDecoder.hpp"
 
 
-class TournamentRepository : public IRepository<domain::Tournament, std::string> {
+class TournamentRepository : public IRepository<domain::Tournament, std::string>, public INameSearch<domain::Tournament> {
     std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::shared_ptr<IDocumentDecoder> documentDecoder;
 public:
-    explicit TournamentRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider);
+    TournamentRepository(std::shared_ptr<IDbConnectionProvider> connectionProvider, std::shared_ptr<IDocumentDecoder> documentDecoder);
     std::shared_ptr<domain::Tournament> ReadById(std::string id) override;
-    std::string Create(const domain::Tournament& entity) override;
+    std::expected<std::string, Error> Create(const domain::Tournament& entity) override;
     std::string Update(const domain::Tournament& entity) override;
     void Delete(std::string id) override;
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override;
+    std::vector<domain::Tournament> ReadAll() override;
+    std::vector<domain::Tournament> SearchByName(std::string_view query, size_t limit) override;
+    // Ids of the tournaments whose document or matches changed most recently, newest first
+    // Tournaments with the latest changes to themselves or their matches in the last `within`, newest first
+    std::vector<std::string> FindRecentlyActiveIds(size_t limit, std::chrono::seconds within);
 };
 
 #endif //TOURNAMENTS_TOURNAMENTREPOSITORY_HPP
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef COMMON_CAPTURE_DURATION_HPP
+#define COMMON_CAPTURE_DURATION_HPP
+
+#include <charconv>
+#include <chrono>
+#include <expected>
+#include <string>
+#include <string_view>
+
+namespace profiling {
+    inline constexpr std::chrono::seconds DEFAULT_CAPTURE{10};
+    inline constexpr std::chrono::seconds MAX_CAPTURE{60};
+
+    // Reads the ?seconds= parameter of a capture request, absent means the default
+    inline std::expected<std::chrono::seconds, std::string> CaptureDuration(const char* seconds) {
+        if (seconds == nullptr) {
+            return DEFAULT_CAPTURE;
+        }
+        const std::string_view text(seconds);
+        int value = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc{} || end != text.data() + text.size() || value < 1 || value > MAX_CAPTURE.count()) {
+            return std::unexpected("seconds must be between 1 and " + std::to_string(MAX_CAPTURE.count()));
+        }
+        return std::chrono::seconds{value};
+    }
+}
+
+#endif //COMMON_CAPTURE_DURATION_HPP
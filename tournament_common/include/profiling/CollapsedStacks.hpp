@@ -0,0 +1,81 @@
+#ifndef COMMON_COLLAPSED_STACKS_HPP
+#define COMMON_COLLAPSED_STACKS_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace profiling {
+    // "root;caller;leaf weight" per distinct stack: the input of flamegraph.pl, speedscope and inferno
+    using CollapsedStacks = std::map<std::string, uint64_t>;
+
+    inline std::string Render(const CollapsedStacks& stacks) {
+        std::string body;
+        for (const auto& [stack, weight] : stacks) {
+            body += stack;
+            body += ' ';
+            body += std::to_string(weight);
+            body += '\n';
+        }
+        return body;
+    }
+
+    // Resolves a return address to its demangled function name. Names come from the dynamic symbol
+    // table, so the binaries are linked with -rdynamic; anything unexported shows as module+offset.
+    inline std::string Symbolize(void* address) {
+        static std::mutex mutex;
+        static std::unordered_map<void*, std::string> cache;
+        std::lock_guard lock(mutex);
+        if (const auto cached = cache.find(address); cached != cache.end()) {
+            return cached->second;
+        }
+
+        std::string name;
+        Dl_info info{};
+        if (dladdr(address, &info) != 0 && info.dli_sname != nullptr) {
+            int status = 0;
+            std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status), &std::free);
+            name = status == 0 ? demangled.get() : info.dli_sname;
+        } else {
+            char buffer[32];
+            if (info.dli_fname != nullptr) {
+                const std::string module = info.dli_fname;
+                std::snprintf(buffer, sizeof(buffer), "+0x%zx", static_cast<size_t>(static_cast<char*>(address) - static_cast<char*>(info.dli_fbase)));
+                name = "[" + module.substr(module.find_last_of('/') + 1) + buffer + "]";
+            } else {
+                std::snprintf(buffer, sizeof(buffer), "[%p]", address);
+                name = buffer;
+            }
+        }
+        // ';' separates frames in the collapsed format
+        for (auto& character : name) {
+            if (character == ';') {
+                character = ':';
+            }
+        }
+        return cache.emplace(address, std::move(name)).first->second;
+    }
+
+    // Stacks are captured leaf first; collapsed stacks are written root first. `skip` drops the
+    // profiler's own frames at the leaf end.
+    inline std::string Collapse(void* const* frames, int depth, int skip) {
+        std::string stack;
+        for (int frame = depth - 1; frame >= skip; --frame) {
+            if (!stack.empty()) {
+                stack += ';';
+            }
+            stack += Symbolize(frames[frame]);
+        }
+        return stack;
+    }
+}
+
+#endif //COMMON_COLLAPSED_STACKS_HPP
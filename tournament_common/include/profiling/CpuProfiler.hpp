@@ -0,0 +1,170 @@
+#ifndef COMMON_CPU_PROFILER_HPP
+#define COMMON_CPU_PROFILER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <sys/time.h>
+#include <thread>
+#include <ucontext.h>
+#include <vector>
+
+#include "profiling/CollapsedStacks.hpp"
+
+namespace profiling {
+    struct CpuProfile {
+        CollapsedStacks stacks;
+        uint64_t samples = 0;
+        // samples lost because the buffer sized for the capture filled up
+        uint64_t dropped = 0;
+    };
+
+    // SIGPROF sampling profiler. ITIMER_PROF fires on consumed CPU time of the whole process and the
+    // kernel delivers the signal to the thread that is running, so busy threads are sampled in
+    // proportion to their CPU use and idle pool threads cost nothing. One capture at a time per process.
+    // Stacks are walked through the frame pointers the project is built with (-fno-omit-frame-pointer);
+    // backtrace() goes through the unwinder, which takes locks and is not async-signal-safe.
+    class CpuProfiler {
+        static constexpr int MAX_FRAMES = 64;
+        // Bounds the buffer a capture allocates up front to about 8 MB (a Sample is 520 bytes); a longer
+        // capture on many busy cores drops what does not fit and reports it in CpuProfile::dropped
+        static constexpr size_t MAX_SAMPLES = 16384;
+        // A saved frame pointer further up than this from the previous one, or outside the default
+        // thread stack above the interrupted stack pointer, is not a frame: the chain passed through
+        // code built without frame pointers and the walk stops there.
+        static constexpr uintptr_t MAX_FRAME_BYTES = 1 << 20;
+        static constexpr uintptr_t MAX_STACK_BYTES = 8 << 20;
+
+        struct Sample {
+            std::array<void*, MAX_FRAMES> frames{};
+            int depth = 0;
+        };
+
+        struct State {
+            std::vector<Sample> samples;
+            std::atomic<size_t> next{0};
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<bool> sampling{false};
+            std::atomic<int> inHandler{0};
+            std::atomic<bool> busy{false};
+        };
+
+        static State& state() {
+            static State instance;
+            return instance;
+        }
+
+        // Starts at the interrupted instruction, so the handler's own frames are never in the sample.
+        // Each frame holds the caller's frame pointer and then the return address, on x86-64 and AArch64.
+        static int walkFrames(const void* context, void** frames) {
+            const auto* machine = &static_cast<const ucontext_t*>(context)->uc_mcontext;
+#if defined(__x86_64__)
+            const auto pc = static_cast<uintptr_t>(machine->gregs[REG_RIP]);
+            auto fp = static_cast<uintptr_t>(machine->gregs[REG_RBP]);
+            const auto sp = static_cast<uintptr_t>(machine->gregs[REG_RSP]);
+#elif defined(__aarch64__)
+            const auto pc = static_cast<uintptr_t>(machine->pc);
+            auto fp = static_cast<uintptr_t>(machine->regs[29]);
+            const auto sp = static_cast<uintptr_t>(machine->sp);
+#endif
+#if defined(__x86_64__) || defined(__aarch64__)
+            int depth = 0;
+            frames[depth++] = reinterpret_cast<void*>(pc);
+            auto previous = sp;
+            while (depth < MAX_FRAMES && fp >= previous && fp - previous <= MAX_FRAME_BYTES
+                   && fp - sp < MAX_STACK_BYTES && fp % alignof(void*) == 0) {
+                const auto* frame = reinterpret_cast<const uintptr_t*>(fp);
+                if (frame[1] == 0) {
+                    break;
+                }
+                frames[depth++] = reinterpret_cast<void*>(frame[1]);
+                previous = fp + 2 * sizeof(uintptr_t);
+                fp = frame[0];
+            }
+            return depth;
+#else
+            return 0;
+#endif
+        }
+
+        // Runs in signal context: no allocation and no locks, every slot is preallocated
+        static void onSignal(int, siginfo_t*, void* context) {
+            auto& current = state();
+            const int savedErrno = errno;
+            current.inHandler.fetch_add(1, std::memory_order_acquire);
+            if (current.sampling.load(std::memory_order_relaxed)) {
+                const size_t index = current.next.fetch_add(1, std::memory_order_relaxed);
+                if (index < current.samples.size()) {
+                    auto& sample = current.samples[index];
+                    sample.depth = walkFrames(context, sample.frames.data());
+                } else {
+                    current.dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            current.inHandler.fetch_sub(1, std::memory_order_release);
+            errno = savedErrno;
+        }
+
+    public:
+        // Samples the process for `duration` at `frequency` Hz, blocking the calling thread meanwhile
+        static std::expected<CpuProfile, std::string> Capture(std::chrono::seconds duration, int frequency = 99) {
+            auto& current = state();
+            if (current.busy.exchange(true)) {
+                return std::unexpected(std::string("A CPU profile is already being captured"));
+            }
+
+            const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+            current.samples.assign(std::min(MAX_SAMPLES, static_cast<size_t>(duration.count()) * frequency * threads + 1), Sample{});
+            current.next = 0;
+            current.dropped = 0;
+
+            struct sigaction action{};
+            action.sa_sigaction = &CpuProfiler::onSignal;
+            action.sa_flags = SA_RESTART | SA_SIGINFO;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGPROF, &action, nullptr);
+
+            const auto interval = static_cast<suseconds_t>(1000000 / frequency);
+            itimerval timer{{0, interval}, {0, interval}};
+            current.sampling = true;
+            setitimer(ITIMER_PROF, &timer, nullptr);
+
+            std::this_thread::sleep_for(duration);
+
+            itimerval stop{};
+            setitimer(ITIMER_PROF, &stop, nullptr);
+            current.sampling = false;
+            while (current.inHandler.load(std::memory_order_acquire) > 0) {
+                std::this_thread::yield();
+            }
+            // A SIGPROF already raised for another thread may still be pending. Under the default
+            // disposition it would terminate the process, ignored it is discarded.
+            struct sigaction ignore{};
+            ignore.sa_handler = SIG_IGN;
+            sigemptyset(&ignore.sa_mask);
+            sigaction(SIGPROF, &ignore, nullptr);
+
+            CpuProfile profile;
+            const size_t taken = std::min(current.next.load(), current.samples.size());
+            for (size_t index = 0; index < taken; ++index) {
+                const auto& sample = current.samples[index];
+                profile.stacks[Collapse(sample.frames.data(), sample.depth, 0)]++;
+            }
+            profile.samples = taken;
+            profile.dropped = current.dropped;
+
+            current.samples.clear();
+            current.samples.shrink_to_fit();
+            current.busy = false;
+            return profile;
+        }
+    };
+}
+
+#endif //COMMON_CPU_PROFILER_HPP
@@ -0,0 +1,212 @@
+#ifndef COMMON_LOCK_PROFILER_HPP
+#define COMMON_LOCK_PROFILER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <execinfo.h>
+#include <expected>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "profiling/CollapsedStacks.hpp"
+
+namespace profiling {
+    // Counters of one named lock; every ProfiledMutex with the same name shares them
+    struct LockSite {
+        std::string name;
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> contended{0};
+        std::atomic<uint64_t> waitNanos{0};
+        std::atomic<uint64_t> maxWaitNanos{0};
+    };
+
+    struct LockStatistics {
+        std::string name;
+        uint64_t acquisitions = 0;
+        uint64_t contended = 0;
+        double waitMillis = 0;
+        double maxWaitMillis = 0;
+    };
+
+    inline void to_json(nlohmann::json& json, const LockStatistics& statistics) {
+        json = {
+            {"name", statistics.name},
+            {"acquisitions", statistics.acquisitions},
+            {"contended", statistics.contended},
+            {"waitMillis", statistics.waitMillis},
+            {"maxWaitMillis", statistics.maxWaitMillis},
+        };
+    }
+
+    // Wait time on contended locks. Counters are always on (an uncontended acquisition costs one
+    // try_lock and one relaxed increment); while a capture runs, each contended acquisition also
+    // records the waiting stack weighted by microseconds waited. The stack is taken while the thread
+    // waits anyway, before it blocks; once it holds the lock it only copies the frames into a slot
+    // preallocated for the capture, so the profiled critical section never waits on the profiler.
+    class LockProfiler {
+    public:
+        static constexpr int MAX_FRAMES = 64;
+        using Frames = std::array<void*, MAX_FRAMES>;
+
+    private:
+        // Stack and ProfiledMutex::lock
+        static constexpr int PROFILER_FRAMES = 2;
+        // waits sampled per capture, the ones beyond still count in the statistics
+        static constexpr size_t MAX_WAITS = 4096;
+
+        struct Wait {
+            Frames frames{};
+            int depth = 0;
+            LockSite* site = nullptr;
+            uint64_t micros = 0;
+        };
+
+        std::mutex mutex;
+        std::map<std::string, std::unique_ptr<LockSite>, std::less<>> sites;
+        std::atomic<bool> capturing{false};
+        std::atomic<bool> busy{false};
+        std::vector<Wait> waits;
+        std::atomic<size_t> next{0};
+        std::atomic<int> recording{0};
+
+    public:
+        static LockProfiler& Instance() {
+            static LockProfiler instance;
+            return instance;
+        }
+
+        LockSite& Site(std::string_view name) {
+            std::lock_guard lock(mutex);
+            auto site = sites.find(name);
+            if (site == sites.end()) {
+                site = sites.emplace(std::string(name), std::make_unique<LockSite>()).first;
+                site->second->name = name;
+            }
+            return *site->second;
+        }
+
+        // Stack of a thread about to block on a lock, depth 0 while no capture runs
+        int Stack(Frames& frames) const {
+            if (!capturing.load(std::memory_order_relaxed)) {
+                return 0;
+            }
+            return backtrace(frames.data(), MAX_FRAMES);
+        }
+
+        // Called holding the profiled lock: atomics and one copy into a preallocated slot, no lock taken
+        void RecordContention(LockSite& site, std::chrono::nanoseconds wait, const Frames& frames, int depth) {
+            const auto nanos = static_cast<uint64_t>(wait.count());
+            site.contended.fetch_add(1, std::memory_order_relaxed);
+            site.waitNanos.fetch_add(nanos, std::memory_order_relaxed);
+            auto max = site.maxWaitNanos.load(std::memory_order_relaxed);
+            while (nanos > max && !site.maxWaitNanos.compare_exchange_weak(max, nanos, std::memory_order_relaxed)) {}
+
+            if (depth <= PROFILER_FRAMES) {
+                return;
+            }
+            recording.fetch_add(1);
+            if (capturing.load()) {
+                if (const auto index = next.fetch_add(1, std::memory_order_relaxed); index < waits.size()) {
+                    auto& slot = waits[index];
+                    std::copy(frames.begin() + PROFILER_FRAMES, frames.begin() + depth, slot.frames.begin());
+                    slot.depth = depth - PROFILER_FRAMES;
+                    slot.site = &site;
+                    slot.micros = nanos / 1000;
+                }
+            }
+            recording.fetch_sub(1);
+        }
+
+        // Collects waiting stacks for `duration`, leaf frame is the lock name, weight is microseconds waited
+        std::expected<CollapsedStacks, std::string> Capture(std::chrono::seconds duration) {
+            if (busy.exchange(true)) {
+                return std::unexpected(std::string("A lock profile is already being captured"));
+            }
+            waits.assign(MAX_WAITS, Wait{});
+            next = 0;
+            capturing = true;
+            std::this_thread::sleep_for(duration);
+            capturing = false;
+            // a thread that saw the capture running may still be filling its slot
+            while (recording.load() > 0) {
+                std::this_thread::yield();
+            }
+
+            CollapsedStacks stacks;
+            const size_t taken = std::min(next.load(), waits.size());
+            for (size_t index = 0; index < taken; ++index) {
+                const auto& wait = waits[index];
+                auto stack = Collapse(wait.frames.data(), wait.depth, 0);
+                stacks[(stack.empty() ? "" : stack + ";") + "[lock " + wait.site->name + "]"] += wait.micros;
+            }
+            waits.clear();
+            waits.shrink_to_fit();
+            busy = false;
+            return stacks;
+        }
+
+        std::vector<LockStatistics> Statistics() {
+            std::lock_guard lock(mutex);
+            std::vector<LockStatistics> statistics;
+            statistics.reserve(sites.size());
+            for (const auto& [name, site] : sites) {
+                statistics.push_back({
+                    name,
+                    site->acquisitions.load(),
+                    site->contended.load(),
+                    site->waitNanos.load() / 1e6,
+                    site->maxWaitNanos.load() / 1e6,
+                });
+            }
+            std::ranges::sort(statistics, std::greater{}, &LockStatistics::waitMillis);
+            return statistics;
+        }
+    };
+
+    // Drop-in for std::mutex that reports contention to the LockProfiler. Pair it with
+    // std::condition_variable_any where a condition variable is needed.
+    class ProfiledMutex {
+        std::mutex mutex;
+        LockSite& site;
+    public:
+        explicit ProfiledMutex(std::string_view name) : site(LockProfiler::Instance().Site(name)) {}
+
+        ProfiledMutex(const ProfiledMutex&) = delete;
+        ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+        void lock() {
+            site.acquisitions.fetch_add(1, std::memory_order_relaxed);
+            if (mutex.try_lock()) {
+                return;
+            }
+            auto& profiler = LockProfiler::Instance();
+            LockProfiler::Frames frames;
+            const int depth = profiler.Stack(frames);
+            const auto start = std::chrono::steady_clock::now();
+            mutex.lock();
+            profiler.RecordContention(site, std::chrono::steady_clock::now() - start, frames, depth);
+        }
+
+        bool try_lock() {
+            if (!mutex.try_lock()) {
+                return false;
+            }
+            site.acquisitions.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void unlock() {
+            mutex.unlock();
+        }
+    };
+}
+
+#endif //COMMON_LOCK_PROFILER_HPP
@@ -0,0 +1,187 @@
+#ifndef COMMON_ADMISSION_CONTROLLER_HPP
+#define COMMON_ADMISSION_CONTROLLER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <expected>
+#include <mutex>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "profiling/LockProfiler.hpp"
+
+namespace resilience {
+    // Shed order under overload: bulk lists first, then standard traffic, critical writes last
+    enum class Priority { CRITICAL, STANDARD, BULK };
+
+    NLOHMANN_JSON_SERIALIZE_ENUM(Priority, {
+        {Priority::CRITICAL, "CRITICAL"},
+        {Priority::STANDARD, "STANDARD"},
+        {Priority::BULK, "BULK"},
+    })
+
+    enum class Rejection { ROUTE_LIMIT, OVERLOADED };
+
+    struct AdmissionConfiguration {
+        double initialLimit = 8;
+        double minLimit = 2;
+        double maxLimit = 12;
+        // the limit shrinks at most once per interval, however many slow requests finish in it
+        std::chrono::milliseconds backoffInterval{250};
+    };
+
+    inline void from_json(const nlohmann::json& json, AdmissionConfiguration& configuration) {
+        configuration.initialLimit = json.value("initialLimit", configuration.initialLimit);
+        configuration.minLimit = json.value("minLimit", configuration.minLimit);
+        configuration.maxLimit = json.value("maxLimit", configuration.maxLimit);
+        configuration.backoffInterval = std::chrono::milliseconds{json.value("backoffIntervalMillis", configuration.backoffInterval.count())};
+    }
+
+    // The limit only bites below the number of HTTP workers: handlers run synchronously, so with every
+    // worker busy the next request waits in the server's queue and never reaches TryAdmit. A quarter of
+    // the workers (at least one) stays outside the limit to answer rejections and health probes.
+    inline AdmissionConfiguration FitToWorkers(AdmissionConfiguration configuration, size_t workers) {
+        const auto spare = std::max<size_t>(1, workers / 4);
+        const auto usable = workers > spare ? static_cast<double>(workers - spare) : 1.0;
+        configuration.maxLimit = std::min(configuration.maxLimit, usable);
+        configuration.minLimit = std::min(configuration.minLimit, configuration.maxLimit);
+        configuration.initialLimit = std::clamp(configuration.initialLimit, configuration.minLimit, configuration.maxLimit);
+        return configuration;
+    }
+
+    // Fixed concurrency cap of a single route, 0 means uncapped
+    class RouteGate {
+        const size_t limit;
+        std::atomic<size_t> inFlight{0};
+    public:
+        explicit RouteGate(size_t limit) : limit(limit) {}
+
+        bool TryEnter() {
+            if (limit == 0) {
+                return true;
+            }
+            auto current = inFlight.load(std::memory_order_relaxed);
+            do {
+                if (current >= limit) {
+                    return false;
+                }
+            } while (!inFlight.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed));
+            return true;
+        }
+
+        void Leave() {
+            if (limit != 0) {
+                inFlight.fetch_sub(1, std::memory_order_release);
+            }
+        }
+    };
+
+    struct AdmissionSnapshot {
+        double limit;
+        size_t inFlight;
+        std::array<uint64_t, 3> admitted;
+        std::array<uint64_t, 3> rejected;
+    };
+
+    // Process-wide concurrency limit adapted to observed latency (AIMD): every request over its route's
+    // latency target shrinks the limit by 10% (at most once per backoff interval), every request under
+    // it grows the limit by 1/limit while at least half of it is in use. Routes without a target (bulk
+    // lists, exports, imports: slow by design) hold a share of the limit but do not move it. Each
+    // priority may only fill a share of the limit, so lower classes are refused while there is still
+    // room for critical writes.
+    class AdmissionController {
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::array<double, 3> SHARE = {1.0, 0.8, 0.5};
+        static constexpr double BACKOFF = 0.9;
+
+        AdmissionConfiguration configuration;
+        mutable profiling::ProfiledMutex mutex{"admission"};
+        double limit;
+        size_t inFlight = 0;
+        Clock::time_point lastDecrease;
+        std::array<uint64_t, 3> admitted{};
+        std::array<uint64_t, 3> rejected{};
+
+        void release(RouteGate& gate, std::chrono::milliseconds latencyTarget, Clock::duration latency) {
+            gate.Leave();
+            std::lock_guard lock(mutex);
+            --inFlight;
+            if (latencyTarget.count() == 0) {
+                return;
+            }
+            const auto now = Clock::now();
+            if (latency > latencyTarget) {
+                if (now - lastDecrease >= configuration.backoffInterval) {
+                    limit = std::max(configuration.minLimit, limit * BACKOFF);
+                    lastDecrease = now;
+                }
+            } else if (static_cast<double>(inFlight + 1) * 2 >= limit) {
+                limit = std::min(configuration.maxLimit, limit + 1.0 / limit);
+            }
+        }
+
+    public:
+        // Held for the whole request; releasing it feeds the request latency back into the limit
+        class Permit {
+            AdmissionController* controller;
+            RouteGate* gate;
+            std::chrono::milliseconds latencyTarget;
+            Clock::time_point admittedAt;
+        public:
+            Permit(AdmissionController* controller, RouteGate* gate, std::chrono::milliseconds latencyTarget)
+                : controller(controller), gate(gate), latencyTarget(latencyTarget), admittedAt(Clock::now()) {}
+            Permit(Permit&& other) noexcept
+                : controller(std::exchange(other.controller, nullptr)), gate(other.gate), latencyTarget(other.latencyTarget),
+                  admittedAt(other.admittedAt) {}
+            Permit(const Permit&) = delete;
+            Permit& operator=(const Permit&) = delete;
+            Permit& operator=(Permit&&) = delete;
+
+            ~Permit() {
+                if (controller != nullptr) {
+                    controller->release(*gate, latencyTarget, Clock::now() - admittedAt);
+                }
+            }
+        };
+
+        explicit AdmissionController(const AdmissionConfiguration& configuration)
+            : configuration(configuration), limit(configuration.initialLimit) {}
+
+        // latencyTarget is the route's own, zero keeps its latency out of the limit
+        std::expected<Permit, Rejection> TryAdmit(Priority priority, RouteGate& gate, std::chrono::milliseconds latencyTarget = {}) {
+            const auto index = static_cast<size_t>(priority);
+            if (!gate.TryEnter()) {
+                std::lock_guard lock(mutex);
+                ++rejected[index];
+                return std::unexpected(Rejection::ROUTE_LIMIT);
+            }
+            std::lock_guard lock(mutex);
+            if (static_cast<double>(inFlight) >= std::max(1.0, limit * SHARE[index])) {
+                ++rejected[index];
+                gate.Leave();
+                return std::unexpected(Rejection::OVERLOADED);
+            }
+            ++inFlight;
+            ++admitted[index];
+            return std::expected<Permit, Rejection>(std::in_place, this, &gate, latencyTarget);
+        }
+
+        // New bounds and backoff interval; the current limit is clamped into them and adapts from there
+        void Reconfigure(const AdmissionConfiguration& settings) {
+            std::lock_guard lock(mutex);
+            configuration = settings;
+            limit = std::clamp(limit, configuration.minLimit, configuration.maxLimit);
+        }
+
+        [[nodiscard]] AdmissionSnapshot Snapshot() const {
+            std::lock_guard lock(mutex);
+            return {limit, inFlight, admitted, rejected};
+        }
+    };
+}
+
+#endif /* COMMON_ADMISSION_CONTROLLER_HPP */
@@ -0,0 +1,164 @@
+#ifndef COMMON_CIRCUIT_BREAKER_HPP
+#define COMMON_CIRCUIT_BREAKER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "exception/CircuitOpen.hpp"
+#include "profiling/LockProfiler.hpp"
+
+namespace resilience {
+    enum class CircuitState { CLOSED, OPEN, HALF_OPEN };
+
+    NLOHMANN_JSON_SERIALIZE_ENUM(CircuitState, {
+        {CircuitState::CLOSED, "CLOSED"},
+        {CircuitState::OPEN, "OPEN"},
+        {CircuitState::HALF_OPEN, "HALF_OPEN"},
+    })
+
+    struct CircuitBreakerConfiguration {
+        size_t failureThreshold = 5;
+        std::chrono::milliseconds openDuration{5000};
+    };
+
+    inline void from_json(const nlohmann::json& json, CircuitBreakerConfiguration& configuration) {
+        configuration.failureThreshold = json.value("failureThreshold", configuration.failureThreshold);
+        configuration.openDuration = std::chrono::milliseconds{json.value("openMillis", configuration.openDuration.count())};
+    }
+
+    struct CircuitSnapshot {
+        std::string name;
+        CircuitState state;
+        uint64_t failures;
+        uint64_t rejected;
+        uint64_t opened;
+    };
+
+    // What Acquire let through. Only the probe's outcome decides a half-open circuit, calls admitted
+    // before the circuit opened may still be finishing and say nothing about the dependency now.
+    enum class Admission { CALL, PROBE };
+
+    // Closed: calls go through and consecutive failures are counted. Open: calls fail immediately until
+    // openDuration has passed. Half-open: a single probe is let through, its outcome closes the circuit
+    // again or reopens it for another openDuration.
+    class CircuitBreaker {
+        using Clock = std::chrono::steady_clock;
+
+        std::string name;
+        CircuitBreakerConfiguration configuration;
+        mutable profiling::ProfiledMutex mutex{"circuit_breaker"};
+        CircuitState state = CircuitState::CLOSED;
+        size_t consecutiveFailures = 0;
+        Clock::time_point openedAt;
+        bool probeInFlight = false;
+        uint64_t failures = 0;
+        uint64_t rejected = 0;
+        uint64_t opened = 0;
+
+        static bool& rejectedOnThread() {
+            thread_local bool value = false;
+            return value;
+        }
+
+        void open() {
+            state = CircuitState::OPEN;
+            openedAt = Clock::now();
+            probeInFlight = false;
+            ++opened;
+        }
+
+    public:
+        CircuitBreaker(std::string_view name, const CircuitBreakerConfiguration& configuration)
+            : name(name), configuration(configuration) {}
+
+        // Throws CircuitOpenException instead of letting the call reach the dependency. The admission
+        // goes back with the outcome.
+        [[nodiscard]] Admission Acquire() {
+            std::lock_guard lock(mutex);
+            if (state == CircuitState::OPEN && Clock::now() - openedAt >= configuration.openDuration) {
+                state = CircuitState::HALF_OPEN;
+            }
+            if (state == CircuitState::CLOSED) {
+                return Admission::CALL;
+            }
+            if (state == CircuitState::HALF_OPEN && !probeInFlight) {
+                probeInFlight = true;
+                return Admission::PROBE;
+            }
+            ++rejected;
+            rejectedOnThread() = true;
+            throw CircuitOpenException(name + " circuit is open");
+        }
+
+        void RecordSuccess(Admission admission) {
+            std::lock_guard lock(mutex);
+            if (state == CircuitState::CLOSED) {
+                consecutiveFailures = 0;
+            } else if (state == CircuitState::HALF_OPEN && admission == Admission::PROBE) {
+                consecutiveFailures = 0;
+                probeInFlight = false;
+                state = CircuitState::CLOSED;
+            }
+        }
+
+        void RecordFailure(Admission admission) {
+            std::lock_guard lock(mutex);
+            ++failures;
+            if (state == CircuitState::HALF_OPEN) {
+                if (admission == Admission::PROBE) {
+                    open();
+                }
+            } else if (state == CircuitState::CLOSED && ++consecutiveFailures >= configuration.failureThreshold) {
+                consecutiveFailures = 0;
+                open();
+            }
+        }
+
+        template<typename Call>
+        decltype(auto) Execute(Call&& call) {
+            const auto admission = Acquire();
+            try {
+                if constexpr (std::is_void_v<std::invoke_result_t<Call>>) {
+                    call();
+                    RecordSuccess(admission);
+                } else {
+                    decltype(auto) result = call();
+                    RecordSuccess(admission);
+                    return result;
+                }
+            } catch (...) {
+                RecordFailure(admission);
+                throw;
+            }
+        }
+
+        // Takes effect on the next failure or open check, the current state is kept
+        void Reconfigure(const CircuitBreakerConfiguration& settings) {
+            std::lock_guard lock(mutex);
+            configuration = settings;
+        }
+
+        [[nodiscard]] CircuitSnapshot Snapshot() const {
+            std::lock_guard lock(mutex);
+            auto current = state;
+            if (current == CircuitState::OPEN && Clock::now() - openedAt >= configuration.openDuration) {
+                current = CircuitState::HALF_OPEN;
+            }
+            return {name, current, failures, rejected, opened};
+        }
+
+        // Whether a breaker failed a call fast on this thread since the last check, the route layer
+        // uses it to answer 503 instead of the 500 the delegate produced
+        static bool TakeRejected() {
+            return std::exchange(rejectedOnThread(), false);
+        }
+    };
+}
+
+#endif /* COMMON_CIRCUIT_BREAKER_HPP */
@@ -0,0 +1,61 @@
+#ifndef COMMON_CIRCUIT_BREAKER_REGISTRY_HPP
+#define COMMON_CIRCUIT_BREAKER_REGISTRY_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "resilience/CircuitBreaker.hpp"
+
+namespace resilience {
+    // Every breaker of the process, so readiness and metrics can report them together
+    class CircuitBreakerRegistry {
+        std::vector<std::shared_ptr<CircuitBreaker>> breakers;
+
+        // configuration["postgres.bulk"], else configuration["postgres"]
+        static const nlohmann::json* entryFor(const nlohmann::json& configuration, std::string_view name) {
+            if (const auto entry = configuration.find(std::string(name)); entry != configuration.end()) {
+                return &*entry;
+            }
+            if (const auto dot = name.find('.'); dot != std::string_view::npos) {
+                if (const auto entry = configuration.find(std::string(name.substr(0, dot))); entry != configuration.end()) {
+                    return &*entry;
+                }
+            }
+            return nullptr;
+        }
+
+    public:
+        // Settings come from configuration[name] or, for "family.member" names, configuration[family];
+        // missing keys keep the defaults
+        std::shared_ptr<CircuitBreaker> Create(std::string_view name, const nlohmann::json& configuration) {
+            CircuitBreakerConfiguration settings;
+            if (const auto* entry = entryFor(configuration, name)) {
+                entry->get_to(settings);
+            }
+            return breakers.emplace_back(std::make_shared<CircuitBreaker>(name, settings));
+        }
+
+        // Breakers without an entry in configuration keep their settings
+        void Reconfigure(const nlohmann::json& configuration) {
+            for (const auto& breaker : breakers) {
+                if (const auto* entry = entryFor(configuration, breaker->Snapshot().name)) {
+                    breaker->Reconfigure(entry->get<CircuitBreakerConfiguration>());
+                }
+            }
+        }
+
+        [[nodiscard]] std::vector<CircuitSnapshot> Snapshots() const {
+            std::vector<CircuitSnapshot> snapshots;
+            snapshots.reserve(breakers.size());
+            for (const auto& breaker : breakers) {
+                snapshots.push_back(breaker->Snapshot());
+            }
+            return snapshots;
+        }
+    };
+}
+
+#endif /* COMMON_CIRCUIT_BREAKER_REGISTRY_HPP */
@@ -0,0 +1,123 @@
+#include "persistence/decoder/SimdDocumentDecoder.hpp"
+
+#include <string>
+#include <simdjson.h>
+
+#include "domain/Utilities.hpp"
+
+namespace {
+    using simdjson::ondemand::object;
+    using simdjson::ondemand::value;
+
+    // simdjson reads SIMDJSON_PADDING bytes past the end of the input, pqxx field buffers are not padded
+    object iterate(std::string_view document) {
+        thread_local simdjson::ondemand::parser parser;
+        thread_local simdjson::ondemand::document current;
+        thread_local std::string buffer;
+
+        buffer.reserve(document.size() + simdjson::SIMDJSON_PADDING);
+        buffer.assign(document);
+        current = parser.iterate(buffer.data(), buffer.size(), buffer.capacity());
+        return current.get_object();
+    }
+
+    void readString(value field, std::string& target) {
+        if (field.type() == simdjson::ondemand::json_type::string) {
+            target = std::string_view(field.get_string());
+        }
+    }
+
+    void readInt(value field, int& target) {
+        if (field.type() == simdjson::ondemand::json_type::number) {
+            target = static_cast<int>(int64_t(field.get_int64()));
+        }
+    }
+
+    void readInt64(value field, int64_t& target) {
+        if (field.type() == simdjson::ondemand::json_type::number) {
+            target = int64_t(field.get_int64());
+        }
+    }
+
+    void decodeTeam(object json, domain::Team& team) {
+        for (auto field : json) {
+            const std::string_view key = field.unescaped_key();
+            if (key == "id") readString(field.value(), team.Id);
+            else if (key == "name") readString(field.value(), team.Name);
+        }
+    }
+
+    void decodeFormat(object json, domain::TournamentFormat& format) {
+        for (auto field : json) {
+            const std::string_view key = field.unescaped_key();
+            if (key == "maxTeamsPerGroup") readInt(field.value(), format.MaxTeamsPerGroup());
+            else if (key == "numberOfGroups") readInt(field.value(), format.NumberOfGroups());
+            else if (key == "qualifiersPerGroup") readInt(field.value(), format.QualifiersPerGroup());
+            else if (key == "type") {
+                std::string type;
+                readString(field.value(), type);
+                format.Type() = domain::fromString(type);
+            }
+        }
+    }
+
+    void decodeSchedule(object json, domain::Schedule& schedule) {
+        for (auto field : json) {
+            const std::string_view key = field.unescaped_key();
+            if (key == "venue") readString(field.value(), schedule.venue);
+            else if (key == "startsAt") readInt64(field.value(), schedule.startsAt);
+        }
+    }
+
+    void decodeScore(object json, domain::Score& score) {
+        for (auto field : json) {
+            const std::string_view key = field.unescaped_key();
+            if (key == "homeTeamScore") readInt(field.value(), score.homeTeamScore);
+            else if (key == "visitorTeamScore") readInt(field.value(), score.visitorTeamScore);
+        }
+    }
+}
+
+void SimdDocumentDecoder::Decode(std::string_view document, domain::Team& team) {
+    decodeTeam(iterate(document), team);
+}
+
+void SimdDocumentDecoder::Decode(std::string_view document, domain::Tournament& tournament) {
+    for (auto field : iterate(document)) {
+        const std::string_view key = field.unescaped_key();
+        if (key == "id") readString(field.value(), tournament.Id());
+        else if (key == "name") readString(field.value(), tournament.Name());
+        else if (key == "format") decodeFormat(field.value().get_object(), tournament.Format());
+    }
+}
+
+void SimdDocumentDecoder::Decode(std::string_view document, domain::Group& group) {
+    for (auto field : iterate(document)) {
+        const std::string_view key = field.unescaped_key();
+        if (key == "id") readString(field.value(), group.Id());
+        else if (key == "name") readString(field.value(), group.Name());
+        else if (key == "tournamentId") readString(field.value(), group.TournamentId());
+        else if (key == "teams" && field.value().type() == simdjson::ondemand::json_type::array) {
+            auto& teams = group.Teams();
+            for (auto team : field.value().get_array()) {
+                decodeTeam(team.get_object(), teams.emplace_back());
+            }
+        }
+    }
+}
+
+void SimdDocumentDecoder::Decode(std::string_view document, domain::Match& match) {
+    for (auto field : iterate(document)) {
+        const std::string_view key = field.unescaped_key();
+        if (key == "id") readString(field.value(), match.Id());
+        else if (key == "name") readString(field.value(), match.Name());
+        else if (key == "tournamentId") readString(field.value(), match.TournamentId());
+        else if (key == "homeTeamId") readString(field.value(), match.HomeTeamId());
+        else if (key == "visitorTeamId") readString(field.value(), match.VisitorTeamId());
+        else if (key == "groupId") readString(field.value(), match.GroupId());
+        else if (key == "score") decodeScore(field.value().get_object(), match.MatchScore());
+        else if (key == "schedule" && field.value().type() == simdjson::ondemand::json_type::object) {
+            decodeSchedule(field.value().get_object(), match.MatchSchedule());
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#include <format>
+#include <string>
+
+#include "persistence/repository/ExportRepository.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+namespace {
+    // Every exported row shares the same shape: kind, id, owning tournament and the stored document.
+    // Groups store team ids only, the export carries the team names resolved at export time.
+    constexpr std::string_view EXPORT_ROWS = R"(
+        select 'tournament' as kind, t.id::text as id, t.id::text as tournament_id, t.document from tournaments t {0}
+        union all
+        select 'group', g.id::text, g.tournament_id::text,
+               jsonb_set(g.document, '{{teams}}', coalesce((
+                   select jsonb_agg(jsonb_build_object('id', r.team->>'id', 'name', tm.document->>'name') order by r.position)
+                   from jsonb_array_elements(coalesce(g.document->'teams', '[]'::jsonb)) with ordinality r(team, position)
+                   left join teams tm on tm.id = (r.team->>'id')::uuid
+               ), '[]'::jsonb))
+        from groups g {1}
+        union all
+        select 'match', m.id::text, m.tournament_id::text, m.document from matches m {1}
+    )";
+
+    constexpr std::string_view CSV_HEADER = "type,id,tournamentId,name,document\n";
+
+    void appendCsvField(std::string& line, std::string_view field) {
+        if (field.find_first_of(",\"\r\n") == std::string_view::npos) {
+            line.append(field);
+            return;
+        }
+        line.push_back('"');
+        for (const char c : field) {
+            if (c == '"') {
+                line.push_back('"');
+            }
+            line.push_back(c);
+        }
+        line.push_back('"');
+    }
+}
+
+ExportRepository::ExportRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+void ExportRepository::ExportTournament(const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink) {
+    Stream(tournamentId, format, sink);
+}
+
+void ExportRepository::ExportAll(ExportFormat format, const ExportSink& sink) {
+    Stream({}, format, sink);
+}
+
+void ExportRepository::Stream(const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink) {
+    auto pooled = connectionProvider->Connection(Workload::BULK);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::read_transaction tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+
+    // COPY does not accept bind parameters, so the (already validated) id is quoted in place
+    std::string rows;
+    if (tournamentId.empty()) {
+        rows = std::format(EXPORT_ROWS, "", "");
+    } else {
+        const std::string id = tx.quote(tournamentId);
+        rows = std::format(EXPORT_ROWS, "where t.id = " + id, "where tournament_id = " + id);
+    }
+
+    // One reusable line buffer; rows are handed to the sink as soon as they come off the wire
+    std::string line;
+    if (format == ExportFormat::NDJSON) {
+        const auto query = std::format(
+            "select (jsonb_build_object('type', kind, 'id', id, 'tournamentId', tournament_id) || document)::text from ({}) rows",
+            rows);
+        for (auto [document] : tx.stream<std::string_view>(query)) {
+            line.assign(document);
+            line.push_back('\n');
+            sink(line);
+        }
+    } else {
+        const auto query = std::format(
+            "select kind, id, tournament_id, coalesce(document->>'name', ''), document::text from ({}) rows",
+            rows);
+        sink(CSV_HEADER);
+        for (auto [kind, id, ownerId, name, document] : tx.stream<std::string_view, std::string_view, std::string_view, std::string_view, std::string_view>(query)) {
+            line.clear();
+            appendCsvField(line, kind);
+            line.push_back(',');
+            appendCsvField(line, id);
+            line.push_back(',');
+            appendCsvField(line, ownerId);
+            line.push_back(',');
+            appendCsvField(line, name);
+            line.push_back(',');
+            appendCsvField(line, document);
+            line.push_back('\n');
+            sink(line);
+        }
+    }
+    tx.commit();
+}
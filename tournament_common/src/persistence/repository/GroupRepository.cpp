@@ -3,53 +3,60 @@
 //
 
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
 #include  "persistence/repository/GroupRepository.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
 
-GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+GroupRepository::GroupRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, const std::shared_ptr<IDocumentDecoder>& documentDecoder)
+    : connectionProvider(connectionProvider), documentDecoder(documentDecoder) {}
 
-std::vector<std::shared_ptr<domain::Group>> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
+std::vector<domain::Group> GroupRepository::FindByTournamentId(const std::string_view& tournamentId) {
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_groups_by_tournament"}, pqxx::params{tournamentId.data()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "select_groups_by_tournament", tournamentId.data());
     tx.commit();
 
-    std::vector<std::shared_ptr<domain::Group>> groups;
+    std::vector<domain::Group> groups;
+    groups.reserve(result.size());
     for(auto row : result){
-        nlohmann::json groupDocument = nlohmann::json::parse(row["document"].c_str());
-        auto group = std::make_shared<domain::Group>(groupDocument);
-        group->Id() = row["id"].c_str();
-
-        groups.push_back(group);
+        auto& group = groups.emplace_back();
+        documentDecoder->Decode(row["document"].view(), group);
+        group.Id() = row["id"].c_str();
     }
 
     return groups;
 }
 
 std::shared_ptr<domain::Group> GroupRepository::ReadById(std::string id) {
-    return std::make_shared<domain::Group>();
+    return memory::make_request_shared<domain::Group>();
 }
 
-std::string GroupRepository::Create (const domain::Group & entity) {
-    auto pooled = connectionProvider->Connection();
+std::expected<std::string, Error> GroupRepository::Create (const domain::Group & entity) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    nlohmann::json groupBody = entity;
+    const nlohmann::json groupBody = domain::GroupDocument(entity);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"insert_group"}, pqxx::params{entity.TournamentId(), groupBody.dump()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "insert_group", entity.TournamentId(), groupBody.dump());
     tx.commit();
-    
-    return result[0]["id"].c_str();
+    if (result.empty()) {
+        return std::unexpected(Error::DUPLICATE);
+    }
+    return std::string(result[0]["id"].c_str());
 }
 
 std::string GroupRepository::Update (const domain::Group & entity) {
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
-    nlohmann::json groupBody = entity;
+    const nlohmann::json groupBody = domain::GroupDocument(entity);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"update_group"}, pqxx::params{entity.Id(), groupBody.dump()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "update_group", entity.Id(), groupBody.dump());
 
     tx.commit();
 
@@ -57,27 +64,30 @@ std::string GroupRepository::Update (const domain::Group & entity) {
 }
 
 void GroupRepository::Delete(std::string id) {
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"delete_group"}, pqxx::params{id});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "delete_group", id);
 
     tx.commit();
 }
 
-std::vector<std::shared_ptr<domain::Group>> GroupRepository::ReadAll() {
-    std::vector<std::shared_ptr<domain::Group>> teams;
+std::vector<domain::Group> GroupRepository::ReadAll() {
+    std::vector<domain::Group> teams;
 
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
     pqxx::result result{tx.exec("select id, document->>'name' as name from groups")};
     tx.commit();
 
+    teams.reserve(result.size());
     for(auto row : result){
-        teams.push_back(std::make_shared<domain::Group>(domain::Group{row["id"].c_str(), row["name"].c_str()}));
+        teams.emplace_back(row["id"].c_str(), row["name"].c_str());
     }
 
     return teams;
@@ -88,13 +98,14 @@ std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndGroupId(con
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_tournamentid_groupid"}, pqxx::params{tournamentId.data(), groupId.data()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "select_group_by_tournamentid_groupid", tournamentId.data(), groupId.data());
     tx.commit();
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto group = std::make_shared<domain::Group>(groupDocument);
+    auto group = memory::make_request_shared<domain::Group>();
+    documentDecoder->Decode(result[0]["document"].view(), *group);
     group->Id() = result[0]["id"].c_str();
 
     return group;
@@ -105,13 +116,14 @@ std::shared_ptr<domain::Group> GroupRepository::FindByTournamentIdAndTeamId(cons
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_group_in_tournament"}, pqxx::params{tournamentId.data(), teamId.data()});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_group_in_tournament", tournamentId.data(), teamId.data());
     tx.commit();
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    std::shared_ptr<domain::Group> group = std::make_shared<domain::Group>(groupDocument);
+    std::shared_ptr<domain::Group> group = memory::make_request_shared<domain::Group>();
+    documentDecoder->Decode(result[0]["document"].view(), *group);
     group->Id() = result[0]["id"].c_str();
 
     return group;
@@ -122,26 +134,29 @@ std::shared_ptr<domain::Group> GroupRepository::FindByGroupIdAndTeamId(const std
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_group_by_group_id_team_id"}, pqxx::params{groupId.data(), teamId.data()});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_group_by_group_id_team_id", groupId.data(), teamId.data());
     tx.commit();
     
     if (result.empty()) {
         return nullptr;
     }
     
-    nlohmann::json groupDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    std::shared_ptr<domain::Group> group = std::make_shared<domain::Group>(groupDocument);
+    std::shared_ptr<domain::Group> group = memory::make_request_shared<domain::Group>();
+    documentDecoder->Decode(result[0]["document"].view(), *group);
     group->Id() = result[0]["id"].c_str();
     
     return group;
 }
 
 void GroupRepository::UpdateGroupAddTeam(const std::string_view& groupId, const std::shared_ptr<domain::Team> & team) {
-    nlohmann::json teamDocument = team;
-    auto pooled = connectionProvider->Connection();
+    // only the reference, the name stays in the teams table
+    const nlohmann::json teamDocument = {{"id", team->Id}};
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"update_group_add_team"}, pqxx::params{groupId.data(), teamDocument.dump()});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "update_group_add_team", groupId.data(), teamDocument.dump());
     tx.commit();
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "persistence/repository/IdempotencyRepository.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+namespace {
+    // Inserts the reservation, or takes over an expired key or an abandoned reservation
+    constexpr auto RESERVE_KEY = R"(
+        insert into idempotency_keys (idempotency_key, scope, fingerprint) values ($1, $2, $3)
+        on conflict (idempotency_key, scope) do update
+            set fingerprint = excluded.fingerprint, status = null, headers = null, body = null,
+                created_at = CURRENT_TIMESTAMP, completed_at = null
+            where idempotency_keys.created_at < CURRENT_TIMESTAMP - interval '24 hours'
+               or (idempotency_keys.completed_at is null and idempotency_keys.created_at < CURRENT_TIMESTAMP - interval '10 minutes')
+        returning 1
+    )";
+
+    constexpr auto SELECT_KEY = R"(
+        select fingerprint, status, headers::text, body from idempotency_keys
+        where idempotency_key = $1 and scope = $2 and created_at >= CURRENT_TIMESTAMP - interval '24 hours'
+    )";
+
+    constexpr auto COMPLETE_KEY = R"(
+        update idempotency_keys set status = $3, headers = $4::jsonb, body = $5, completed_at = CURRENT_TIMESTAMP
+        where idempotency_key = $1 and scope = $2
+    )";
+
+    constexpr auto DELETE_KEY = "delete from idempotency_keys where idempotency_key = $1 and scope = $2 and completed_at is null";
+
+    constexpr auto PURGE_KEYS = "delete from idempotency_keys where created_at < CURRENT_TIMESTAMP - interval '24 hours'";
+}
+
+IdempotencyRepository::IdempotencyRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+bool IdempotencyRepository::Reserve(std::string_view key, std::string_view scope, std::string_view fingerprint) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = tx.exec(RESERVE_KEY, pqxx::params{key, scope, fingerprint});
+    tx.commit();
+    return !result.empty();
+}
+
+std::optional<IdempotencyRecord> IdempotencyRepository::Find(std::string_view key, std::string_view scope) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = tx.exec(SELECT_KEY, pqxx::params{key, scope});
+    tx.commit();
+    if (result.empty()) {
+        return std::nullopt;
+    }
+
+    const auto row = result.at(0);
+    IdempotencyRecord record{row["fingerprint"].c_str(), std::nullopt};
+    if (!row["status"].is_null()) {
+        StoredResponse response;
+        response.status = row["status"].as<int>();
+        response.body = row["body"].is_null() ? "" : row["body"].c_str();
+        for (const auto& header : nlohmann::json::parse(row["headers"].view())) {
+            response.headers.emplace_back(header.at(0).get<std::string>(), header.at(1).get<std::string>());
+        }
+        record.response = std::move(response);
+    }
+    return record;
+}
+
+void IdempotencyRepository::Complete(std::string_view key, std::string_view scope, const StoredResponse& response) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    nlohmann::json headers = nlohmann::json::array();
+    for (const auto& [name, value] : response.headers) {
+        headers.push_back({name, value});
+    }
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    tx.exec(COMPLETE_KEY, pqxx::params{key, scope, response.status, headers.dump(), response.body});
+    tx.commit();
+}
+
+void IdempotencyRepository::Release(std::string_view key, std::string_view scope) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    tx.exec(DELETE_KEY, pqxx::params{key, scope});
+    tx.commit();
+}
+
+void IdempotencyRepository::PurgeExpired() {
+    auto pooled = connectionProvider->Connection(Workload::BULK);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    tx.exec(PURGE_KEYS);
+    tx.commit();
+}
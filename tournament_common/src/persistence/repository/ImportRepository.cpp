@@ -0,0 +1,162 @@
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+#include "persistence/repository/ImportRepository.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+namespace {
+    constexpr size_t MAX_REPORTED_ERRORS = 20;
+    constexpr size_t MAX_TEAMS_PER_GROUP = 32;
+
+    // Validates a parsed line and returns its kind, or an error message when it has to be rejected
+    std::string validateLine(const nlohmann::json& document, std::string& kind) {
+        if (!document.is_object() || !document.contains("type") || !document["type"].is_string()) {
+            return "missing type";
+        }
+        kind = document["type"].get<std::string>();
+        if (kind != "team" && kind != "tournament" && kind != "group") {
+            return "unknown type " + kind;
+        }
+        if (!document.contains("name") || !document["name"].is_string() || document["name"].get_ref<const std::string&>().empty()) {
+            return "missing name";
+        }
+        if (kind == "tournament" && document.contains("format") && !document["format"].is_object()) {
+            return "format must be an object";
+        }
+        if (kind == "group") {
+            if (!document.contains("tournament") || !document["tournament"].is_string()) {
+                return "missing tournament";
+            }
+            if (document.contains("teams")) {
+                const auto& teams = document["teams"];
+                if (!teams.is_array() || teams.size() > MAX_TEAMS_PER_GROUP) {
+                    return "teams must be an array of at most 32 team names";
+                }
+                for (const auto& team : teams) {
+                    if (!team.is_string()) {
+                        return "teams must be an array of at most 32 team names";
+                    }
+                }
+            }
+        }
+        return "";
+    }
+
+    // Duplicates inside the batch keep their first occurrence, duplicates against the table are skipped by ON CONFLICT
+    constexpr auto MERGE_TEAMS = R"(
+        insert into teams (document)
+        select distinct on (s.document->>'name') jsonb_build_object('name', s.document->>'name')
+        from import_staging s
+        where s.batch_id = $1 and s.kind = 'team'
+        order by s.document->>'name', s.line_number
+        on conflict ((document->>'name')) do nothing
+    )";
+
+    constexpr auto MERGE_TOURNAMENTS = R"(
+        insert into tournaments (document)
+        select distinct on (s.document->>'name') jsonb_strip_nulls(jsonb_build_object('name', s.document->>'name', 'format', s.document->'format'))
+        from import_staging s
+        where s.batch_id = $1 and s.kind = 'tournament'
+        order by s.document->>'name', s.line_number
+        on conflict ((document->>'name')) do nothing
+    )";
+
+    // Runs after teams and tournaments are merged. A group naming a tournament or a team found neither in
+    // the tables nor earlier in the batch is taken out of the batch whole, and its line is reported with
+    // every name that did not resolve, instead of the group being merged without them.
+    constexpr auto REJECT_UNRESOLVED_GROUPS = R"(
+        with unresolved as (
+            select s.line_number, 'unknown tournament ' || (s.document->>'tournament') as error, 0 as position
+            from import_staging s
+            where s.batch_id = $1 and s.kind = 'group'
+              and not exists (select 1 from tournaments t where t.document->>'name' = s.document->>'tournament')
+            union all
+            select s.line_number, 'unknown team ' || n.team_name, n.position
+            from import_staging s
+            cross join jsonb_array_elements_text(coalesce(s.document->'teams', '[]'::jsonb)) with ordinality n(team_name, position)
+            where s.batch_id = $1 and s.kind = 'group'
+              and not exists (select 1 from teams tm where tm.document->>'name' = n.team_name)
+        ), rejected as (
+            delete from import_staging s
+            where s.batch_id = $1 and s.kind = 'group' and s.line_number in (select line_number from unresolved)
+            returning s.line_number
+        )
+        select r.line_number, string_agg(u.error, ', ' order by u.position) as error
+        from rejected r join unresolved u on u.line_number = r.line_number
+        group by r.line_number
+        order by r.line_number
+    )";
+
+    // Tournaments and teams are resolved by name, so groups can reference rows merged earlier in the same batch
+    constexpr auto MERGE_GROUPS = R"(
+        insert into groups (tournament_id, document)
+        select distinct on (t.id, s.document->>'name')
+               t.id,
+               jsonb_build_object(
+                   'name', s.document->>'name',
+                   'tournamentId', t.id::text,
+                   'teams', coalesce((
+                       select jsonb_agg(jsonb_build_object('id', tm.id::text) order by n.position)
+                       from jsonb_array_elements_text(coalesce(s.document->'teams', '[]'::jsonb)) with ordinality n(team_name, position)
+                       join teams tm on tm.document->>'name' = n.team_name
+                   ), '[]'::jsonb))
+        from import_staging s
+        join tournaments t on t.document->>'name' = s.document->>'tournament'
+        where s.batch_id = $1 and s.kind = 'group'
+        order by t.id, s.document->>'name', s.line_number
+        on conflict (tournament_id, (document->>'name')) do nothing
+    )";
+}
+
+ImportRepository::ImportRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+ImportSummary ImportRepository::Import(const ImportSource& source) {
+    ImportSummary summary;
+    auto pooled = connectionProvider->Connection(Workload::BULK);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const auto batchId = tx.query_value<std::string>("select uuid_generate_v4()::text");
+
+    {
+        auto staging = pqxx::stream_to::table(tx, {"import_staging"}, {"batch_id", "line_number", "kind", "document"});
+        std::string line;
+        std::string kind;
+        while (source(line)) {
+            ++summary.lines;
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            // Only the current line is ever parsed, memory stays bounded by the longest line
+            const auto document = nlohmann::json::parse(line, nullptr, false);
+            std::string error = document.is_discarded() ? "invalid JSON" : validateLine(document, kind);
+            if (!error.empty()) {
+                ++summary.rejected;
+                if (summary.errors.size() < MAX_REPORTED_ERRORS) {
+                    summary.errors.push_back("line " + std::to_string(summary.lines) + ": " + error);
+                }
+                continue;
+            }
+            staging.write_values(batchId, summary.lines, kind, line);
+            ++summary.staged;
+        }
+        staging.complete();
+    }
+
+    summary.teamsCreated = tx.exec(MERGE_TEAMS, pqxx::params{batchId}).affected_rows();
+    summary.tournamentsCreated = tx.exec(MERGE_TOURNAMENTS, pqxx::params{batchId}).affected_rows();
+    for (const auto& row : tx.exec(REJECT_UNRESOLVED_GROUPS, pqxx::params{batchId})) {
+        --summary.staged;
+        ++summary.rejected;
+        if (summary.errors.size() < MAX_REPORTED_ERRORS) {
+            summary.errors.push_back("line " + std::to_string(row["line_number"].as<size_t>()) + ": " + row["error"].c_str());
+        }
+    }
+    summary.groupsCreated = tx.exec(MERGE_GROUPS, pqxx::params{batchId}).affected_rows();
+    tx.exec("delete from import_staging where batch_id = $1", pqxx::params{batchId});
+    tx.commit();
+
+    return summary;
+}
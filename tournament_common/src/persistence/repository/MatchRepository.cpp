@@ -1,23 +1,27 @@
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
 #include  "persistence/repository/MatchRepository.hpp"
+#include "persistence/configuration/Durability.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
 
-MatchRepository::MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+MatchRepository::MatchRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, const std::shared_ptr<IDocumentDecoder>& documentDecoder)
+    : connectionProvider(connectionProvider), documentDecoder(documentDecoder) {}
 
-std::vector<std::shared_ptr<domain::Match>> MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
+std::vector<domain::Match> MatchRepository::FindByTournamentId(const std::string_view& tournamentId) {
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_matches_by_tournament"}, pqxx::params{tournamentId.data()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "select_matches_by_tournament", tournamentId.data());
     tx.commit();
 
-    std::vector<std::shared_ptr<domain::Match>> matches;
+    std::vector<domain::Match> matches;
+    matches.reserve(result.size());
     for(auto row : result){
-        nlohmann::json matchDocument = nlohmann::json::parse(row["document"].c_str());
-        auto match = std::make_shared<domain::Match>(matchDocument);
-        match->Id() = row["id"].c_str();
-
-        matches.push_back(match);
+        auto& match = matches.emplace_back();
+        documentDecoder->Decode(row["document"].view(), match);
+        match.Id() = row["id"].c_str();
     }
 
     return matches;
@@ -28,13 +32,14 @@ std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndMatchId(con
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_match_by_tournamentid_matchid"}, pqxx::params{tournamentId.data(), matchId.data()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "select_match_by_tournamentid_matchid", tournamentId.data(), matchId.data());
     tx.commit();
     if (result.empty()) {
         return nullptr;
     }
-    nlohmann::json matchDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto match = std::make_shared<domain::Match>(matchDocument);
+    auto match = memory::make_request_shared<domain::Match>();
+    documentDecoder->Decode(result[0]["document"].view(), *match);
     match->Id() = result[0]["id"].c_str();
 
     return match;
@@ -42,66 +47,193 @@ std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndMatchId(con
 
 void MatchRepository::UpdateMatchScore(const std::string_view& matchId, const domain::Score& score) {
     nlohmann::json scoreDocument = score;
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"update_match_score"}, pqxx::params{matchId.data(), scoreDocument.dump()});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "update_match_score", matchId.data(), scoreDocument.dump());
     tx.commit();
 }
 
 std::vector<std::string> MatchRepository::CreateBulk(const std::vector<domain::Match>& matches) {
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
     std::vector<std::string> createdIds;
     for (const auto& match : matches) {
         nlohmann::json matchDocument = match;
-        const pqxx::result result = tx.exec(pqxx::prepped{"insert_match"}, pqxx::params{match.TournamentId().data(),
-                                                                                      matchDocument.dump()});
+        const pqxx::result result = connection->Exec(tx, "insert_match", match.TournamentId().data(), matchDocument.dump());
         createdIds.push_back(result[0]["id"].c_str());
     }
     tx.commit();
     return createdIds;
 }
 
+std::vector<std::string> MatchRepository::CreateBracket(const std::string_view& tournamentId, const std::vector<domain::Match>& matches) {
+    const nlohmann::json matchesDocument = matches;
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    // whoever takes the lock second finds the bracket there and inserts nothing
+    connection->Exec(tx, "lock_tournament_stage", tournamentId.data());
+    const pqxx::result result = connection->Exec(tx, "insert_bracket", tournamentId.data(), matchesDocument.dump());
+    tx.commit();
+
+    std::vector<std::string> createdIds;
+    createdIds.reserve(result.size());
+    for (const auto& row : result) {
+        createdIds.push_back(row["id"].c_str());
+    }
+    return createdIds;
+}
+
+std::vector<std::string> MatchRepository::CreateGroupMatches(const std::string_view& tournamentId, const std::string_view& groupId,
+                                                             const std::vector<domain::Match>& matches) {
+    const nlohmann::json matchesDocument = matches;
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    connection->Exec(tx, "lock_tournament_stage", tournamentId.data());
+    const pqxx::result result = connection->Exec(tx, "insert_group_matches", tournamentId.data(), groupId.data(), matchesDocument.dump());
+    tx.commit();
+
+    std::vector<std::string> createdIds;
+    createdIds.reserve(result.size());
+    for (const auto& row : result) {
+        createdIds.push_back(row["id"].c_str());
+    }
+    return createdIds;
+}
+
+void MatchRepository::UpdateSchedules(const std::vector<domain::Match>& matches) {
+    if (matches.empty()) {
+        return;
+    }
+    nlohmann::json schedules = nlohmann::json::array();
+    for (const auto& match : matches) {
+        schedules.push_back({{"id", match.Id()}, {"schedule", match.MatchSchedule()}});
+    }
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    connection->Exec(tx, "update_match_schedules", schedules.dump());
+    tx.commit();
+}
+
+std::vector<domain::Schedule> MatchRepository::FindVenueBookings(const std::string_view& tournamentId, int64_t from) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_venue_bookings", tournamentId.data(), from);
+    tx.commit();
+
+    std::vector<domain::Schedule> bookings;
+    bookings.reserve(result.size());
+    for (const auto& row : result) {
+        bookings.push_back({row["venue"].c_str(), row["starts_at"].as<int64_t>()});
+    }
+    return bookings;
+}
+
 bool MatchRepository::MatchesExistForTournament(const std::string_view& tournamentId) {
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_matches_by_tournament"}, pqxx::params{tournamentId.data()});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_match_exists", tournamentId.data());
     tx.commit();
 
     return !result.empty();
 }
 
+bool MatchRepository::MatchesExistForGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_group_match_exists", tournamentId.data(), groupId.data());
+    tx.commit();
+
+    return !result.empty();
+}
+
+std::vector<std::string> MatchRepository::StartKnockoutStage(const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket) {
+    const nlohmann::json bracketDocument = bracket;
+    int seeds = 0;
+    for (const auto& match : bracket) {
+        seeds += !match.HomeTeamId().empty() + !match.VisitorTeamId().empty();
+    }
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    // the last two group results can arrive together, whoever takes the lock second finds the bracket there
+    connection->Exec(tx, "lock_tournament_stage", tournamentId.data());
+    const pqxx::result result = connection->Exec(tx, "insert_seeded_knockout", tournamentId.data(), qualifiersPerGroup, bracketDocument.dump(), seeds);
+    tx.commit();
+
+    std::vector<std::string> createdIds;
+    createdIds.reserve(result.size());
+    for (const auto& row : result) {
+        createdIds.push_back(row["id"].c_str());
+    }
+    return createdIds;
+}
+
 std::shared_ptr<domain::Match> MatchRepository::FindByTournamentIdAndName(const std::string_view& tournamentId, const std::string_view& name) {
     auto pooled = connectionProvider->Connection();
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"select_match_by_tournamentid_name"}, pqxx::params{tournamentId.data(), name.data()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "select_match_by_tournamentid_name", tournamentId.data(), name.data());
     tx.commit();
     
     if (result.empty()) {
         return nullptr;
     }
     
-    nlohmann::json matchDocument = nlohmann::json::parse(result[0]["document"].c_str());
-    auto match = std::make_shared<domain::Match>(matchDocument);
+    auto match = memory::make_request_shared<domain::Match>();
+    documentDecoder->Decode(result[0]["document"].view(), *match);
     match->Id() = result[0]["id"].c_str();
 
     return match;
 }
 
-void MatchRepository::Update(const std::string_view& matchId, const domain::Match& match) {
+void MatchRepository::Update(const std::string_view& matchId, const domain::Match& match, Durability durability) {
     nlohmann::json matchDocument = match;
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    ApplyDurability(tx, durability);
+    connection->Exec(tx, "update_match", matchId.data(), matchDocument.dump());
+    tx.commit();
+}
+
+bool MatchRepository::AdvanceTeam(const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId, Durability durability) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    tx.exec(pqxx::prepped{"update_match"}, pqxx::params{matchId.data(), matchDocument.dump()});
+    ApplyStatementTimeout(tx);
+    ApplyDurability(tx, durability);
+    const pqxx::result result = connection->Exec(tx, "advance_team", tournamentId.data(), matchName.data(), teamId.data());
     tx.commit();
+    return !result.empty();
 }
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "domain/Utilities.hpp"
+#include "persistence/repository/ReconciliationRepository.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+namespace {
+    int64_t epochSeconds(IReconciliationRepository::Clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count();
+    }
+
+    // null before the first page
+    std::optional<std::string> bound(const std::string& value) {
+        return value.empty() ? std::nullopt : std::optional(value);
+    }
+
+    ScanPosition positionOf(const pqxx::row& row) {
+        return {row["last_update_date"].c_str(), row["position_id"].c_str()};
+    }
+}
+
+ReconciliationRepository::ReconciliationRepository(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+std::vector<StalledGroup> ReconciliationRepository::FindStalledGroups(Clock::time_point since, Clock::time_point until, size_t limit, const ScanPosition& after) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_stalled_groups", epochSeconds(since), epochSeconds(until), static_cast<int64_t>(limit),
+                                                 bound(after.lastUpdate), bound(after.id));
+    tx.commit();
+
+    std::vector<StalledGroup> groups;
+    groups.reserve(result.size());
+    for (const auto& row : result) {
+        groups.push_back({row["tournament_id"].c_str(), row["group_id"].c_str(), positionOf(row)});
+    }
+    return groups;
+}
+
+std::vector<StalledResult> ReconciliationRepository::FindUnadvancedResults(Clock::time_point since, Clock::time_point until, size_t limit,
+                                                                         const Successors& successors, const ScanPosition& after) {
+    nlohmann::json successorDocument = nlohmann::json::object();
+    for (const auto& [name, next] : successors) {
+        successorDocument[name] = {next.first, next.second};
+    }
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_unadvanced_results", epochSeconds(since), epochSeconds(until),
+                                                 static_cast<int64_t>(limit), successorDocument.dump(), bound(after.lastUpdate), bound(after.id));
+    tx.commit();
+
+    std::vector<StalledResult> results;
+    results.reserve(result.size());
+    for (const auto& row : result) {
+        auto& stalled = results.emplace_back(StalledResult{row["tournament_id"].c_str(), row["match_id"].c_str(), {}, positionOf(row)});
+        nlohmann::json::parse(row["score"].view()).get_to(stalled.score);
+    }
+    return results;
+}
@@ -0,0 +1,34 @@
+#include "domain/Constants.hpp"
+#include "persistence/repository/TeamDictionary.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+std::unordered_map<std::string, std::string> TeamDictionary::Fetch(const std::vector<std::string>& teamIds) {
+    // uuid[] literal, ids that are not uuids cannot name a team and would fail the cast
+    std::string idArray = "{";
+    for (const auto& teamId : teamIds) {
+        if (IsValidId(teamId)) {
+            idArray.append(idArray.size() > 1 ? "," : "").append(teamId);
+        }
+    }
+    idArray.push_back('}');
+
+    std::unordered_map<std::string, std::string> names;
+    if (idArray.size() == 2) {
+        return names;
+    }
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_team_names", idArray);
+    tx.commit();
+
+    names.reserve(result.size());
+    for (const auto& row : result) {
+        names.emplace(row["id"].c_str(), row["name"].c_str());
+    }
+    return names;
+}
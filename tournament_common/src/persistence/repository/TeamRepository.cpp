@@ -4,26 +4,50 @@
 #include <iostream>
 
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
 
 TeamRepository::TeamRepository(
-    std::shared_ptr<IDbConnectionProvider> connectionProvider) : connectionProvider(std::move(connectionProvider)) {}
+    std::shared_ptr<IDbConnectionProvider> connectionProvider, std::shared_ptr<IDocumentDecoder> documentDecoder)
+    : connectionProvider(std::move(connectionProvider)), documentDecoder(std::move(documentDecoder)) {}
 
-std::vector<std::shared_ptr<domain::Team>> TeamRepository::ReadAll() {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+std::vector<domain::Team> TeamRepository::ReadAll() {
+  std::vector<domain::Team> teams;
 
-  auto pooled = connectionProvider->Connection();
+  // the whole table, it waits in the bulk pool instead of holding an interactive connection
+  auto pooled = connectionProvider->Connection(Workload::BULK);
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
 
   pqxx::work tx(*(connection->connection));
+  ApplyStatementTimeout(tx);
   pqxx::result result{
       tx.exec("select id, document->>'name' as name from teams")};
   tx.commit();
 
+  teams.reserve(result.size());
+  for (auto row : result) {
+    teams.push_back(domain::Team{row["id"].c_str(), row["name"].c_str()});
+  }
+
+  return teams;
+}
+
+std::vector<domain::Team> TeamRepository::SearchByName(std::string_view query, size_t limit) {
+  std::vector<domain::Team> teams;
+
+  auto pooled = connectionProvider->Connection();
+  const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+  pqxx::work tx(*(connection->connection));
+  ApplyStatementTimeout(tx);
+  const pqxx::result result = connection->Exec(tx, "search_teams_by_name", std::string(query), EscapeLikePattern(query), static_cast<int64_t>(limit));
+  tx.commit();
+
+  teams.reserve(result.size());
   for (auto row : result) {
-    teams.push_back(std::make_shared<domain::Team>(
-        domain::Team{row["id"].c_str(), row["name"].c_str()}));
+    teams.push_back(domain::Team{row["id"].c_str(), row["name"].c_str()});
   }
 
   return teams;
@@ -34,47 +58,55 @@ std::shared_ptr<domain::Team> TeamRepository::ReadById(std::string_view id) {
   const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
   pqxx::work tx(*(connection->connection));
-  const pqxx::result result = tx.exec(pqxx::prepped{"select_team_by_id"}, pqxx::params{id});
+  ApplyStatementTimeout(tx);
+  const pqxx::result result = connection->Exec(tx, "select_team_by_id", id);
   tx.commit();
   if (result.empty()) {
     return nullptr;
   }
 
-  nlohmann::json rowTeam = nlohmann::json::parse(result.at(0)["document"].c_str());
-  auto team = std::make_shared<domain::Team>(rowTeam);
+  auto team = memory::make_request_shared<domain::Team>();
+  documentDecoder->Decode(result.at(0)["document"].view(), *team);
   team->Id = result.at(0)["id"].c_str();
 
   return team;
 }
 
-std::string_view TeamRepository::Create(const domain::Team &entity) {
-  auto pooled = connectionProvider->Connection();
+std::expected<std::string, Error> TeamRepository::Create(const domain::Team &entity) {
+  auto pooled = connectionProvider->Connection(Workload::WRITE);
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
   nlohmann::json teamBody = entity;
 
   pqxx::work tx(*(connection->connection));
-  pqxx::result result = tx.exec(pqxx::prepped{"insert_team"}, teamBody.dump());
+  ApplyStatementTimeout(tx);
+  pqxx::result result = connection->Exec(tx, "insert_team", teamBody.dump());
   tx.commit();
-  
-  return result[0]["id"].c_str();
+
+  // ON CONFLICT DO NOTHING returns no row when the name is already registered
+  if (result.empty()) {
+    return std::unexpected(Error::DUPLICATE);
+  }
+  return std::string(result[0]["id"].c_str());
 }
 
 std::string_view TeamRepository::Update(const domain::Team &entity) {
-  auto pooled = connectionProvider->Connection();
+  auto pooled = connectionProvider->Connection(Workload::WRITE);
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
   nlohmann::json teamBody = entity;
 
   pqxx::work tx(*(connection->connection));
-  pqxx::result result = tx.exec(pqxx::prepped{"update_team"}, pqxx::params{ teamBody.dump(), entity.Id });
+  ApplyStatementTimeout(tx);
+  pqxx::result result = connection->Exec(tx, "update_team", teamBody.dump(), entity.Id);
   tx.commit();
   return result[0]["document"].c_str();
 }
 
 void TeamRepository::Delete(std::string_view id) {
-  auto pooled = connectionProvider->Connection();
+  auto pooled = connectionProvider->Connection(Workload::WRITE);
   auto connection = dynamic_cast<PostgresConnection *>(&*pooled);
 
   pqxx::work tx(*(connection->connection));
-  pqxx::result result = tx.exec(pqxx::prepped{"delete_team"}, pqxx::params{id});
+  ApplyStatementTimeout(tx);
+  pqxx::result result = connection->Exec(tx, "delete_team", id);
   tx.commit();
 }
\ No newline at end of file
@@ -9,48 +9,56 @@
 
 #include "persistence/repository/TournamentRepository.hpp"
 #include "domain/Utilities.hpp"
+#include "memory/RequestArena.hpp"
 #include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
 
-TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection)
-    : connectionProvider(std::move(connection)) {}
+TournamentRepository::TournamentRepository(std::shared_ptr<IDbConnectionProvider> connection, std::shared_ptr<IDocumentDecoder> documentDecoder)
+    : connectionProvider(std::move(connection)), documentDecoder(std::move(documentDecoder)) {}
 
 std::shared_ptr<domain::Tournament> TournamentRepository::ReadById(const std::string id) {
     auto pooled = connectionProvider->Connection();
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    const pqxx::result result = tx.exec(pqxx::prepped{"select_tournament_by_id"}, pqxx::params{id});
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_tournament_by_id", id);
     tx.commit();
 
     if (result.empty()) {
         return nullptr;
     }
 
-    nlohmann::json rowTournament = nlohmann::json::parse(result.at(0)["document"].c_str());
-    auto tournament = std::make_shared<domain::Tournament>(rowTournament);
+    auto tournament = memory::make_request_shared<domain::Tournament>();
+    documentDecoder->Decode(result.at(0)["document"].view(), *tournament);
     tournament->Id() = std::string(result.at(0)["id"].c_str());
 
     return tournament;
 }
 
-std::string TournamentRepository::Create(const domain::Tournament& entity) {
-    auto pooled = connectionProvider->Connection();
+std::expected<std::string, Error> TournamentRepository::Create(const domain::Tournament& entity) {
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
     const nlohmann::json tournamentBody = entity;
     pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
 
-    pqxx::result result = tx.exec(pqxx::prepped{"insert_tournament"}, tournamentBody.dump());
+    pqxx::result result = connection->Exec(tx, "insert_tournament", tournamentBody.dump());
     tx.commit();
+    if (result.empty()) {
+        return std::unexpected(Error::DUPLICATE);
+    }
     return std::string(result[0]["id"].c_str());
 }
 
 std::string TournamentRepository::Update(const domain::Tournament& entity) {
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
     nlohmann::json tournamentBody = entity;
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"update_tournament"}, pqxx::params{tournamentBody.dump(), entity.Id()});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "update_tournament", tournamentBody.dump(), entity.Id());
     tx.commit();
 
     if (result.empty()) {
@@ -60,31 +68,71 @@ std::string TournamentRepository::Update(const domain::Tournament& entity) {
 }
 
 void TournamentRepository::Delete(const std::string id) {
-    auto pooled = connectionProvider->Connection();
+    auto pooled = connectionProvider->Connection(Workload::WRITE);
     auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
-    pqxx::result result = tx.exec(pqxx::prepped{"delete_tournament"}, pqxx::params{id});
+    ApplyStatementTimeout(tx);
+    pqxx::result result = connection->Exec(tx, "delete_tournament", id);
     tx.commit();
 }
 
-std::vector<std::shared_ptr<domain::Tournament>> TournamentRepository::ReadAll() {
-    std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+std::vector<domain::Tournament> TournamentRepository::ReadAll() {
+    std::vector<domain::Tournament> tournaments;
 
-    auto pooled = connectionProvider->Connection();
+    // the whole table, it waits in the bulk pool instead of holding an interactive connection
+    auto pooled = connectionProvider->Connection(Workload::BULK);
     const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
     pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
     const pqxx::result result{tx.exec("select id, document from tournaments")};
     tx.commit();
 
+    tournaments.reserve(result.size());
     for (auto row : result) {
-        nlohmann::json rowTournament = nlohmann::json::parse(row["document"].c_str());
-        auto tournament = std::make_shared<domain::Tournament>(rowTournament);
-        tournament->Id() = std::string(row["id"].c_str());
+        auto& tournament = tournaments.emplace_back();
+        documentDecoder->Decode(row["document"].view(), tournament);
+        tournament.Id() = std::string(row["id"].c_str());
+    }
+
+    return tournaments;
+}
+
+std::vector<std::string> TournamentRepository::FindRecentlyActiveIds(size_t limit, std::chrono::seconds within) {
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "select_recent_tournament_ids", static_cast<int64_t>(limit), static_cast<double>(within.count()));
+    tx.commit();
+
+    std::vector<std::string> ids;
+    ids.reserve(result.size());
+    for (const auto& row : result) {
+        ids.emplace_back(row["id"].c_str());
+    }
+    return ids;
+}
+
+std::vector<domain::Tournament> TournamentRepository::SearchByName(std::string_view query, size_t limit) {
+    std::vector<domain::Tournament> tournaments;
+
+    auto pooled = connectionProvider->Connection();
+    const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
 
-        tournaments.push_back(tournament);
+    pqxx::work tx(*(connection->connection));
+    ApplyStatementTimeout(tx);
+    const pqxx::result result = connection->Exec(tx, "search_tournaments_by_name", std::string(query), EscapeLikePattern(query), static_cast<int64_t>(limit));
+    tx.commit();
+
+    tournaments.reserve(result.size());
+    for (auto row : result) {
+        auto& tournament = tournaments.emplace_back();
+        documentDecoder->Decode(row["document"].view(), tournament);
+        tournament.Id() = std::string(row["id"].c_str());
     }
 
     return tournaments;
-}
\ No newline at end of file
+}
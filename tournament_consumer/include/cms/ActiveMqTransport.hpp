@@ -0,0 +1,67 @@
+#ifndef CONSUMER_ACTIVEMQ_TRANSPORT_HPP
+#define CONSUMER_ACTIVEMQ_TRANSPORT_HPP
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <cms/MessageConsumer.h>
+#include <cms/Session.h>
+#include <cms/TextMessage.h>
+
+#include "cms/ConnectionManager.hpp"
+#include "cms/IMessageTransport.hpp"
+
+// Acknowledges message by message: with CLIENT_ACKNOWLEDGE one acknowledge() would also settle the
+// later messages still waiting in the listener's queue. The broker redelivers what is unacknowledged
+// when the session closes.
+class ActiveMqReceiver : public IMessageReceiver {
+    std::shared_ptr<cms::Session> session;
+    std::unique_ptr<cms::MessageConsumer> messageConsumer;
+    std::deque<std::unique_ptr<cms::Message>> unacknowledged;
+
+public:
+    ActiveMqReceiver(const std::shared_ptr<ConnectionManager>& connectionManager, std::string_view queue)
+        : session(connectionManager->CreateSession(cms::Session::INDIVIDUAL_ACKNOWLEDGE)) {
+        const auto destination = std::unique_ptr<cms::Queue>(session->createQueue(std::string(queue)));
+        messageConsumer = std::unique_ptr<cms::MessageConsumer>(session->createConsumer(destination.get()));
+    }
+
+    std::optional<std::string> Receive(std::chrono::milliseconds timeout) override {
+        std::unique_ptr<cms::Message> message(messageConsumer->receive(static_cast<int>(timeout.count())));
+        if (!message) {
+            return std::nullopt;
+        }
+        if (auto text = dynamic_cast<cms::TextMessage*>(message.get())) {
+            auto body = text->getText();
+            unacknowledged.push_back(std::move(message));
+            return body;
+        }
+        // nothing the listeners could process, settled right away
+        message->acknowledge();
+        return std::nullopt;
+    }
+
+    void Acknowledge() override {
+        unacknowledged.front()->acknowledge();
+        unacknowledged.pop_front();
+    }
+
+    void Close() override {
+        messageConsumer->close();
+        session->close();
+    }
+};
+
+// Queues on the broker, one session per consumed queue
+class ActiveMqTransport : public IMessageTransport {
+    std::shared_ptr<ConnectionManager> connectionManager;
+
+public:
+    explicit ActiveMqTransport(const std::shared_ptr<ConnectionManager>& connectionManager) : connectionManager(connectionManager) {}
+
+    std::unique_ptr<IMessageReceiver> Open(std::string_view queue) override {
+        return std::make_unique<ActiveMqReceiver>(connectionManager, queue);
+    }
+};
+
+#endif //CONSUMER_ACTIVEMQ_TRANSPORT_HPP
@@ -0,0 +1,69 @@
+#ifndef CONSUMER_BACKPRESSURE_HPP
+#define CONSUMER_BACKPRESSURE_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+
+struct BackpressureConfiguration {
+    // received messages waiting for processing, the receive loop blocks when it is full
+    size_t queueCapacity = 64;
+    // consumption pauses at pauseDepth queued messages or pauseWait of average pool checkout wait...
+    size_t pauseDepth = 48;
+    std::chrono::milliseconds pauseWait{250};
+    // ...and resumes once both are back at or below the resume marks
+    size_t resumeDepth = 16;
+    std::chrono::milliseconds resumeWait{50};
+};
+
+inline void from_json(const nlohmann::json& json, BackpressureConfiguration& configuration) {
+    configuration.queueCapacity = json.value("queueCapacity", configuration.queueCapacity);
+    configuration.pauseDepth = json.value("pauseDepth", configuration.pauseDepth);
+    configuration.pauseWait = std::chrono::milliseconds(json.value("pauseWaitMillis", configuration.pauseWait.count()));
+    configuration.resumeDepth = json.value("resumeDepth", configuration.resumeDepth);
+    configuration.resumeWait = std::chrono::milliseconds(json.value("resumeWaitMillis", configuration.resumeWait.count()));
+    if (configuration.queueCapacity == 0 || configuration.pauseDepth > configuration.queueCapacity
+        || configuration.resumeDepth > configuration.pauseDepth || configuration.resumeWait > configuration.pauseWait) {
+        throw std::invalid_argument("backpressure needs resume <= pause <= queueCapacity");
+    }
+}
+
+// Decides when the listeners stop taking messages off the broker. The signals are the listener's own
+// work queue and how long checkouts wait on the database pool: while Postgres is saturated, pulling
+// more messages only adds waiters to the pool. The gap between the pause and resume marks keeps a
+// listener from flapping around a single threshold.
+class Backpressure {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+    std::mutex mutex;
+    BackpressureConfiguration configuration;
+
+public:
+    Backpressure(const std::shared_ptr<IDbConnectionProvider>& connectionProvider, BackpressureConfiguration configuration = {})
+        : connectionProvider(connectionProvider), configuration(configuration) {}
+
+    BackpressureConfiguration Configuration() {
+        std::lock_guard lock(mutex);
+        return configuration;
+    }
+
+    void Reconfigure(const BackpressureConfiguration& settings) {
+        std::lock_guard lock(mutex);
+        configuration = settings;
+    }
+
+    // Whether a listener that is `paused` now, with `depth` messages queued, should be paused next
+    bool Paused(bool paused, size_t depth) {
+        const auto settings = Configuration();
+        const auto wait = connectionProvider->CheckoutWait();
+        if (paused) {
+            return depth > settings.resumeDepth || wait > settings.resumeWait;
+        }
+        return depth >= settings.pauseDepth || wait >= settings.pauseWait;
+    }
+};
+
+#endif //CONSUMER_BACKPRESSURE_HPP
@@ -15,13 +15,15 @@ class GroupAddTeamListener : public QueueMessageListener{
     void processMessage(const std::string& message) override;
     std::shared_ptr<MatchDelegate> matchDelegate;
 public:
-    GroupAddTeamListener(const std::shared_ptr<ConnectionManager> &connectionManager, const std::shared_ptr<MatchDelegate> &matchDelegate);
+    GroupAddTeamListener(const std::shared_ptr<IMessageTransport> &transport, const std::shared_ptr<Backpressure> &backpressure,
+    const std::shared_ptr<MatchDelegate> &matchDelegate);
     ~GroupAddTeamListener() override;
 
 };
 
-inline GroupAddTeamListener::GroupAddTeamListener(const std::shared_ptr<ConnectionManager> &connectionManager, const std::shared_ptr<MatchDelegate> &matchDelegate)
-    : QueueMessageListener(connectionManager), matchDelegate(matchDelegate) {
+inline GroupAddTeamListener::GroupAddTeamListener(const std::shared_ptr<IMessageTransport> &transport, const std::shared_ptr<Backpressure> &backpressure,
+    const std::shared_ptr<MatchDelegate> &matchDelegate)
+    : QueueMessageListener(transport, backpressure), matchDelegate(matchDelegate) {
 }
 
 inline GroupAddTeamListener::~GroupAddTeamListener() {
@@ -0,0 +1,32 @@
+#ifndef CONSUMER_IMESSAGE_TRANSPORT_HPP
+#define CONSUMER_IMESSAGE_TRANSPORT_HPP
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// One consumed queue. A message counts as delivered once it is acknowledged; whatever was received and
+// not acknowledged when the receiver closes or its connection drops is delivered again. Receive,
+// Acknowledge and Close are called from the same thread.
+class IMessageReceiver {
+public:
+    virtual ~IMessageReceiver() = default;
+
+    // The next message, or nullopt when none arrived within timeout
+    virtual std::optional<std::string> Receive(std::chrono::milliseconds timeout) = 0;
+    // The oldest message Receive returned that is not acknowledged yet, messages are processed in order
+    virtual void Acknowledge() = 0;
+    virtual void Close() = 0;
+};
+
+// Where the listeners take their messages from, chosen by "messaging" in configuration.json
+class IMessageTransport {
+public:
+    virtual ~IMessageTransport() = default;
+
+    virtual std::unique_ptr<IMessageReceiver> Open(std::string_view queue) = 0;
+};
+
+#endif //CONSUMER_IMESSAGE_TRANSPORT_HPP
@@ -18,12 +18,14 @@ class MatchScoreUpdateListener : public QueueMessageListener {
     void processMessage(const std::string& message) override;
 
 public:
-    MatchScoreUpdateListener(const std::shared_ptr<ConnectionManager> &connectionManager, const std::shared_ptr<MatchDelegate> &matchDelegate);
+    MatchScoreUpdateListener(const std::shared_ptr<IMessageTransport> &transport, const std::shared_ptr<Backpressure> &backpressure,
+    const std::shared_ptr<MatchDelegate> &matchDelegate);
     ~MatchScoreUpdateListener() override;
 };
 
-inline MatchScoreUpdateListener::MatchScoreUpdateListener(const std::shared_ptr<ConnectionManager> &connectionManager, const std::shared_ptr<MatchDelegate> &matchDelegate)
-    : QueueMessageListener(connectionManager), matchDelegate(matchDelegate) {
+inline MatchScoreUpdateListener::MatchScoreUpdateListener(const std::shared_ptr<IMessageTransport> &transport, const std::shared_ptr<Backpressure> &backpressure,
+    const std::shared_ptr<MatchDelegate> &matchDelegate)
+    : QueueMessageListener(transport, backpressure), matchDelegate(matchDelegate) {
 }
 
 inline MatchScoreUpdateListener::~MatchScoreUpdateListener() {
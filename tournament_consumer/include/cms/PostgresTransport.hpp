@@ -0,0 +1,182 @@
+#ifndef CONSUMER_POSTGRES_TRANSPORT_HPP
+#define CONSUMER_POSTGRES_TRANSPORT_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <pqxx/pqxx>
+
+#include "cms/IMessageTransport.hpp"
+
+// Consumes one queue of the MESSAGE_QUEUE table. It keeps its own connection instead of borrowing one
+// from the pool: LISTEN and the queue lock belong to a session and the receiver sits waiting on it
+// between messages.
+// One receiver at a time owns a queue, through a session advisory lock, so messages are processed in id
+// order and the events of a tournament never overtake each other; other consumers of the queue wait
+// their turn. A claim reads up to claimBatch rows the receiver is not holding yet, in id order; a
+// delivery is counted on the one row Receive hands out, so the rows queued behind a failing message
+// are not charged for its retries. Rows are only deleted when acknowledged, after they were processed.
+// When the receiver closes or its connection drops, the lock goes with the session and the next owner
+// gets the unacknowledged rows again, in order. A row handed out more than maxDeliveries times is
+// dropped with a log, the Reconciler repairs what it would have done.
+class PostgresReceiver : public IMessageReceiver {
+    static constexpr auto CHANNEL = "message_queue";
+
+    std::string connectionString;
+    std::string queue;
+    size_t claimBatch;
+    int maxDeliveries;
+    std::unique_ptr<pqxx::connection> connection;
+    bool owner = false;
+    bool notified = false;
+    // claimed and not handed out yet
+    std::deque<std::pair<int64_t, std::string>> claimed;
+    // handed out and not acknowledged yet, oldest first
+    std::deque<int64_t> unacknowledged;
+
+    void connect() {
+        connection = std::make_unique<pqxx::connection>(connectionString);
+        connection->prepare("lock_message_queue", "select pg_try_advisory_lock(hashtextextended('message_queue:' || $1, 0))");
+        // $2 are the ids this receiver holds already, rows of an insert that committed late still come in id order
+        connection->prepare("claim_messages", R"(
+            select id, body from message_queue
+            where queue = $1 and id <> all($2::bigint[])
+            order by id
+            limit $3
+        )");
+        connection->prepare("deliver_message", "update message_queue set deliveries = deliveries + 1 where id = $1 returning deliveries");
+        connection->prepare("delete_message", "delete from message_queue where id = $1");
+        // the payload names the queue, the rows themselves are read by the claim.
+        // Listening before the first claim means no insert can slip between the two unnoticed.
+        connection->listen(CHANNEL, [this](const pqxx::notification& notification) {
+            notified = notified || notification.payload == queue;
+        });
+    }
+
+    bool lock() {
+        pqxx::nontransaction tx(*connection);
+        return tx.exec(pqxx::prepped{"lock_message_queue"}, pqxx::params{queue})[0][0].as<bool>();
+    }
+
+    std::string held() const {
+        std::string ids = "{";
+        for (const auto id : unacknowledged) {
+            ids += (ids.size() > 1 ? "," : "") + std::to_string(id);
+        }
+        for (const auto& [id, body] : claimed) {
+            ids += (ids.size() > 1 ? "," : "") + std::to_string(id);
+        }
+        return ids + "}";
+    }
+
+    void claim() {
+        pqxx::nontransaction tx(*connection);
+        for (const auto& row : tx.exec(pqxx::prepped{"claim_messages"}, pqxx::params{queue, held(), claimBatch})) {
+            claimed.emplace_back(row[0].as<int64_t>(), row[1].as<std::string>());
+        }
+    }
+
+    // Counts the delivery of the row about to be handed out, false when it was dropped instead
+    bool deliver(int64_t id, const std::string& message) {
+        pqxx::work tx(*connection);
+        const auto deliveries = tx.exec(pqxx::prepped{"deliver_message"}, pqxx::params{id})[0][0].as<int>();
+        if (deliveries > maxDeliveries) {
+            std::cout << "[PostgresReceiver] ERROR dropping message " << id << " of " << queue << " after "
+                      << maxDeliveries << " deliveries: " << message << std::endl;
+            tx.exec(pqxx::prepped{"delete_message"}, pqxx::params{id});
+        }
+        tx.commit();
+        return deliveries <= maxDeliveries;
+    }
+
+    // Until a NOTIFY for this queue or the timeout, notifications of the other queues are skipped
+    void await(std::chrono::milliseconds timeout) {
+        const auto until = std::chrono::steady_clock::now() + timeout;
+        notified = false;
+        while (!notified) {
+            const auto left = std::chrono::duration_cast<std::chrono::microseconds>(until - std::chrono::steady_clock::now());
+            if (left.count() <= 0) {
+                return;
+            }
+            connection->await_notification(left.count() / 1000000, left.count() % 1000000);
+        }
+    }
+
+public:
+    PostgresReceiver(std::string connectionString, std::string_view queue, size_t claimBatch, int maxDeliveries)
+        : connectionString(std::move(connectionString)), queue(queue), claimBatch(claimBatch), maxDeliveries(maxDeliveries) {}
+
+    // Database errors are thrown, the listener closes the receiver and opens a new one
+    std::optional<std::string> Receive(std::chrono::milliseconds timeout) override {
+        if (!connection) {
+            connect();
+        }
+        if (!owner) {
+            owner = lock();
+            if (!owner) {
+                // another consumer owns the queue
+                std::this_thread::sleep_for(timeout);
+                return std::nullopt;
+            }
+        }
+        bool waited = false;
+        while (true) {
+            while (!claimed.empty()) {
+                auto [id, message] = std::move(claimed.front());
+                claimed.pop_front();
+                if (deliver(id, message)) {
+                    unacknowledged.push_back(id);
+                    return message;
+                }
+            }
+            claim();
+            if (claimed.empty()) {
+                if (waited) {
+                    return std::nullopt;
+                }
+                await(timeout);
+                waited = true;
+            }
+        }
+    }
+
+    void Acknowledge() override {
+        if (unacknowledged.empty()) {
+            return;
+        }
+        pqxx::work tx(*connection);
+        tx.exec(pqxx::prepped{"delete_message"}, pqxx::params{unacknowledged.front()});
+        tx.commit();
+        unacknowledged.pop_front();
+    }
+
+    // Closing the session releases the queue, what was not acknowledged stays in the table
+    void Close() override {
+        claimed.clear();
+        unacknowledged.clear();
+        owner = false;
+        connection.reset();
+    }
+};
+
+// Broker-less transport over the MESSAGE_QUEUE table, the services enqueue through PostgresMessageProducer
+class PostgresTransport : public IMessageTransport {
+    std::string connectionString;
+    size_t claimBatch;
+    int maxDeliveries;
+
+public:
+    PostgresTransport(std::string connectionString, size_t claimBatch, int maxDeliveries)
+        : connectionString(std::move(connectionString)), claimBatch(claimBatch), maxDeliveries(maxDeliveries) {}
+
+    std::unique_ptr<IMessageReceiver> Open(std::string_view queue) override {
+        return std::make_unique<PostgresReceiver>(connectionString, queue, claimBatch, maxDeliveries);
+    }
+};
+
+#endif //CONSUMER_POSTGRES_TRANSPORT_HPP
@@ -7,63 +7,206 @@
 
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <iostream>
 #include <memory>
+#include <mutex>
 #include <thread>
-#include <cms/MessageConsumer.h>
-#include <cms/Session.h>
 #include <print>
+#include <utility>
 
-#include "cms/ConnectionManager.hpp"
+#include "cms/Backpressure.hpp"
+#include "cms/IMessageTransport.hpp"
 
+// Receives on the calling thread and processes on a worker thread, with a bounded queue in between.
+// One worker per listener keeps the messages of a queue in the order they were sent. Receiving pauses
+// while Backpressure says so; messages stay in the transport meanwhile instead of piling up here.
+// A message is acknowledged only after it was processed, so what sits in the queue at a crash is
+// delivered again. When processing fails, the queued messages are dropped unacknowledged and the
+// receiver is reopened, which redelivers the failed message first and keeps the order.
 class QueueMessageListener {
-    std::shared_ptr<ConnectionManager> connectionManager;
+    static constexpr std::chrono::milliseconds PAUSED_POLL{100};
+    static constexpr std::chrono::milliseconds RECEIVE_TIMEOUT{1500};
+    static constexpr std::chrono::milliseconds REOPEN_DELAY{1000};
+
+    std::shared_ptr<IMessageTransport> transport;
+    std::shared_ptr<Backpressure> backpressure;
     std::atomic<bool> running;
     std::thread worker;
-    std::shared_ptr<cms::Session> session;
-    std::shared_ptr<cms::MessageConsumer> messageConsumer;
+
+    std::mutex queueMutex;
+    // signals a message queued, a message taken, a failure and Stop
+    std::condition_variable queueCondition;
+    std::deque<std::string> work;
+    bool paused = false;
+    // processed messages the receiving thread has yet to acknowledge
+    size_t processed = 0;
+    // set by the worker when a message failed, until the receiver is reopened
+    bool failed = false;
+    // counts reopened receivers, an outcome of a message from an earlier one is not acknowledged
+    uint64_t generation = 0;
 
     virtual void processMessage(const std::string& message) = 0 ;
+
+    // False while consumption is paused, after waiting a little for the queue to drain
+    bool admit();
+    void enqueue(std::string message);
+    void acknowledge(IMessageReceiver& receiver);
+    void consume(const std::string_view& queueName);
+    void process();
 public:
-    explicit QueueMessageListener(const std::shared_ptr<ConnectionManager>& connectionManager);
+    QueueMessageListener(const std::shared_ptr<IMessageTransport>& transport, const std::shared_ptr<Backpressure>& backpressure);
     virtual ~QueueMessageListener() = default;
     void Start(const std::string_view & queueName);
     void Stop();
 };
 
-inline QueueMessageListener::QueueMessageListener(const std::shared_ptr<ConnectionManager>& connectionManager) : connectionManager(connectionManager) {
+inline QueueMessageListener::QueueMessageListener(const std::shared_ptr<IMessageTransport>& transport, const std::shared_ptr<Backpressure>& backpressure)
+    : transport(transport), backpressure(backpressure) {
     std::print("Created QueueMessageConsumer");
 }
 
+inline bool QueueMessageListener::admit() {
+    size_t depth;
+    bool wasPaused;
+    {
+        std::lock_guard lock(queueMutex);
+        depth = work.size();
+        wasPaused = paused;
+    }
+    const bool pause = backpressure->Paused(wasPaused, depth);
+
+    std::unique_lock lock(queueMutex);
+    if (pause != wasPaused) {
+        paused = pause;
+        std::cout << "[QueueMessageListener] " << (pause ? "pausing" : "resuming") << " consumption, "
+                  << depth << " messages queued" << std::endl;
+    }
+    if (pause) {
+        queueCondition.wait_for(lock, PAUSED_POLL, [this] { return !running || failed; });
+    }
+    return !pause;
+}
+
+// A message received after a failure is not queued, the reopened receiver delivers it again
+inline void QueueMessageListener::enqueue(std::string message) {
+    const auto capacity = backpressure->Configuration().queueCapacity;
+    std::unique_lock lock(queueMutex);
+    queueCondition.wait(lock, [this, capacity] { return work.size() < capacity || !running || failed; });
+    if (failed) {
+        return;
+    }
+    work.push_back(std::move(message));
+    lock.unlock();
+    queueCondition.notify_all();
+}
+
+inline void QueueMessageListener::acknowledge(IMessageReceiver& receiver) {
+    size_t count;
+    {
+        std::lock_guard lock(queueMutex);
+        count = std::exchange(processed, 0);
+    }
+    for (; count > 0; --count) {
+        receiver.Acknowledge();
+    }
+}
+
+// Opened, used and closed on this thread, the receiver is not shared with the worker
+inline void QueueMessageListener::consume(const std::string_view& queueName) {
+    const auto receiver = transport->Open(queueName);
+    while (running) {
+        acknowledge(*receiver);
+        {
+            std::lock_guard lock(queueMutex);
+            if (failed) {
+                break;
+            }
+        }
+        if (!admit()) {
+            continue;
+        }
+        if (auto message = receiver->Receive(RECEIVE_TIMEOUT)) {
+            enqueue(std::move(*message));
+        }
+    }
+    acknowledge(*receiver);
+    receiver->Close();
+}
+
+// Stops at Stop, messages still queued were not acknowledged and are delivered again
+inline void QueueMessageListener::process() {
+    while (true) {
+        std::unique_lock lock(queueMutex);
+        queueCondition.wait(lock, [this] { return (!work.empty() && !failed) || !running; });
+        if (!running) {
+            return;
+        }
+        auto message = std::move(work.front());
+        work.pop_front();
+        const auto receivedBy = generation;
+        lock.unlock();
+        queueCondition.notify_all();
+
+        bool succeeded = true;
+        try {
+            processMessage(message);
+        } catch (const std::exception& e) {
+            std::cout << "[QueueMessageListener] ERROR: " << e.what() << std::endl;
+            succeeded = false;
+        }
+
+        lock.lock();
+        if (receivedBy != generation) {
+            continue;
+        }
+        if (succeeded) {
+            ++processed;
+        } else {
+            failed = true;
+            work.clear();
+        }
+        lock.unlock();
+        queueCondition.notify_all();
+    }
+}
+
+// Reopens the receiver after a failed message or a lost connection until Stop
 inline void QueueMessageListener::Start(const std::string_view& queueName) {
     if (this->running)
         return;
     this->running = true;
-    try {
-        session = connectionManager->CreateSession();
-        const auto destination = std::unique_ptr<cms::Queue>(session->createQueue(queueName.data()));
-        auto consumer = std::unique_ptr<cms::MessageConsumer>(session->createConsumer(destination.get()));
-
-        while (running) {
-            std::unique_ptr<cms::Message> message(consumer->receive(1500));
-            if (message) {
-                if (auto text = dynamic_cast<cms::TextMessage*>(message.get())) {
-                   processMessage(text->getText());
-                }
-            }
+    worker = std::thread([this] { process(); });
+    while (running) {
+        try {
+            consume(queueName);
+        } catch (const std::exception& e) {
+            std::cout << "[QueueMessageListener] ERROR receiving from " << queueName << ", reopening: " << e.what() << std::endl;
         }
-    } catch (const cms::CMSException& e) {
-
+        std::unique_lock lock(queueMutex);
+        if (failed || running) {
+            queueCondition.wait_for(lock, REOPEN_DELAY, [this] { return !running; });
+        }
+        // the worker already emptied the queue, and acknowledgements belong to the closed receiver
+        work.clear();
+        processed = 0;
+        failed = false;
+        ++generation;
     }
 }
 
 inline void QueueMessageListener::Stop() {
-    running = false;
+    {
+        std::lock_guard lock(queueMutex);
+        running = false;
+    }
+    queueCondition.notify_all();
     if (worker.joinable())
         worker.join();
-
-    messageConsumer->close();
-    session->close();
-    // connection->close();
 }
 
 #endif //COMMON_QUEUE_MESSAGE_CONSUMER_HPP
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef TOURNAMENTS_CONSUMER_ADMIN_SERVER_HPP
+#define TOURNAMENTS_CONSUMER_ADMIN_SERVER_HPP
+
+#include <crow.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <nlohmann/json.hpp>
+
+#include "configuration/AdminConfiguration.hpp"
+#include "configuration/ConfigurationWatcher.hpp"
+#include "persistence/configuration/SlowQueryLog.hpp"
+#include "profiling/CaptureDuration.hpp"
+#include "profiling/CpuProfiler.hpp"
+#include "profiling/LockProfiler.hpp"
+
+// The consumer has no API, so its operational endpoints get a small listener of their own on
+// admin.port with the same routes and bearer token as the services' admin routes.
+class AdminServer {
+    std::shared_ptr<SlowQueryLog> slowQueries;
+    std::shared_ptr<config::AdminConfiguration> adminConfiguration;
+    std::shared_ptr<config::ConfigurationWatcher> configurationWatcher;
+    crow::SimpleApp app;
+    std::thread thread;
+
+    template<typename Handler>
+    auto authorized(Handler handler) {
+        return [this, handler](const crow::request& request) {
+            if (!adminConfiguration->Authorizes(request.get_header_value("Authorization"))) {
+                crow::response response{crow::UNAUTHORIZED, "Admin token required"};
+                response.add_header("WWW-Authenticate", "Bearer");
+                return response;
+            }
+            return handler(request);
+        };
+    }
+
+    static crow::response text(crow::status status, const std::string& body, const std::string& contentType = "text/plain") {
+        crow::response response{status, body};
+        response.add_header("content-type", contentType);
+        return response;
+    }
+
+public:
+    AdminServer(const std::shared_ptr<SlowQueryLog>& slowQueries, const std::shared_ptr<config::AdminConfiguration>& adminConfiguration,
+                const std::shared_ptr<config::ConfigurationWatcher>& configurationWatcher)
+        : slowQueries(slowQueries), adminConfiguration(adminConfiguration), configurationWatcher(configurationWatcher) {
+        CROW_ROUTE(app, "/admin/config")(authorized([this](const crow::request&) {
+            return text(crow::OK, this->configurationWatcher->Status().dump(), "application/json");
+        }));
+        CROW_ROUTE(app, "/admin/config/reload").methods("POST"_method)(authorized([this](const crow::request&) {
+            const auto reloaded = this->configurationWatcher->Reload();
+            if (!reloaded) {
+                return text(static_cast<crow::status>(422), reloaded.error());
+            }
+            return text(crow::OK, this->configurationWatcher->Status().dump(), "application/json");
+        }));
+        CROW_ROUTE(app, "/admin/slow-queries")(authorized([this](const crow::request&) {
+            const nlohmann::json body = {{"statements", this->slowQueries->Statements()}, {"recent", this->slowQueries->Recent()}};
+            return text(crow::OK, body.dump(), "application/json");
+        }));
+        CROW_ROUTE(app, "/admin/profile/cpu")(authorized([](const crow::request& request) {
+            const auto duration = profiling::CaptureDuration(request.url_params.get("seconds"));
+            if (!duration) {
+                return text(crow::BAD_REQUEST, duration.error());
+            }
+            const auto profile = profiling::CpuProfiler::Capture(*duration);
+            if (!profile) {
+                return text(crow::CONFLICT, profile.error());
+            }
+            auto response = text(crow::OK, profiling::Render(profile->stacks));
+            response.add_header("X-Profile-Samples", std::to_string(profile->samples));
+            response.add_header("X-Profile-Dropped", std::to_string(profile->dropped));
+            return response;
+        }));
+        CROW_ROUTE(app, "/admin/profile/locks")(authorized([](const crow::request& request) {
+            const auto duration = profiling::CaptureDuration(request.url_params.get("seconds"));
+            if (!duration) {
+                return text(crow::BAD_REQUEST, duration.error());
+            }
+            const auto stacks = profiling::LockProfiler::Instance().Capture(*duration);
+            if (!stacks) {
+                return text(crow::CONFLICT, stacks.error());
+            }
+            return text(crow::OK, profiling::Render(*stacks));
+        }));
+        CROW_ROUTE(app, "/admin/locks")(authorized([](const crow::request&) {
+            const nlohmann::json body = profiling::LockProfiler::Instance().Statistics();
+            return text(crow::OK, body.dump(), "application/json");
+        }));
+    }
+
+    ~AdminServer() {
+        app.stop();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    // No-op when admin.port is not configured
+    void Start() {
+        if (adminConfiguration->port <= 0) {
+            return;
+        }
+        // Ctrl+C stops the listeners, not only this server
+        app.signal_clear();
+        app.port(adminConfiguration->port).concurrency(2);
+        thread = std::thread([this] { app.run(); });
+    }
+};
+
+#endif //TOURNAMENTS_CONSUMER_ADMIN_SERVER_HPP
@@ -6,51 +6,118 @@
 #define TOURNAMENTS_CONSUMER_CONTAINER_SETUP_HPP
 
 #include <Hypodermic/Hypodermic.h>
-#include <fstream>
 #include <nlohmann/json.hpp>
 #include <memory>
 
+#include "configuration/AdminConfiguration.hpp"
+#include "configuration/AdminServer.hpp"
+#include "configuration/ConfigurationWatcher.hpp"
 #include "configuration/DatabaseConfiguration.hpp"
+#include "configuration/MessagingConfiguration.hpp"
+#include "cms/ActiveMqTransport.hpp"
+#include "cms/Backpressure.hpp"
 #include "cms/ConnectionManager.hpp"
+#include "cms/PostgresTransport.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
-#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/ConnectionProviders.hpp"
+#include "persistence/decoder/DocumentDecoders.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/repository/IGroupRepository.hpp"
 #include "cms/GroupAddTeamListener.hpp"
 #include "cms/MatchScoreUpdateListener.hpp"
 #include "delegate/MatchDelegate.hpp"
+#include "delegate/MatchScheduler.hpp"
+#include "delegate/Reconciler.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
+#include "persistence/repository/ReconciliationRepository.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
         Hypodermic::ContainerBuilder builder;
 
-        std::ifstream file("configuration.json");
-        nlohmann::json configuration;
-        file >> configuration;
+        // Pool bounds, slow query settings and backpressure marks are applied live when configuration.json changes
+        auto watcher = std::make_shared<ConfigurationWatcher>("configuration.json");
+        builder.registerInstance(watcher);
+        const nlohmann::json configuration = *watcher->Current();
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(configuration["databaseConfig"]["connectionString"].get<std::string>(), configuration["databaseConfig"]["poolSize"].get<size_t>());
+        auto slowQueries = std::make_shared<SlowQueryLog>(
+            configuration["databaseConfig"].value("slowQueries", nlohmann::json::object()).get<SlowQueryConfiguration>());
+        builder.registerInstance(slowQueries);
+        watcher->Subscribe("/databaseConfig/slowQueries", [slowQueries](const nlohmann::json& section) {
+            slowQueries->Reconfigure(section.get<SlowQueryConfiguration>());
+        });
+        builder.registerInstance(std::make_shared<AdminConfiguration>(
+            configuration.value("admin", nlohmann::json::object()).get<AdminConfiguration>()));
+        builder.registerType<AdminServer>().singleInstance();
+        std::shared_ptr<IDbConnectionProvider> postgressConnection = connectionProvider(configuration["databaseConfig"], slowQueries);
         builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
+        for (const auto* bounds : {"/databaseConfig/pools", "/databaseConfig/poolSize"}) {
+            // the watcher owns its listeners, a plain pointer back to it avoids a reference cycle
+            watcher->Subscribe(bounds, [current = watcher.get(), postgressConnection](const nlohmann::json&) {
+                resizePools(*postgressConnection, current->Current()->at("databaseConfig"));
+            });
+        }
+        // Fallback for repositories resolved by their concrete type, the registrations below pick one per repository
+        builder.registerInstance(documentDecoder(configuration["databaseConfig"], "default"));
 
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext& context, const std::shared_ptr<ConnectionManager>& instance) {
                 instance->initialize(configuration["activemq"]["broker-url"].get<std::string>());
             })
             .singleInstance();
+        // the broker connection is only opened when the activemq transport resolves it
+        const auto messaging = configuration.value("messaging", nlohmann::json::object()).get<MessagingConfiguration>();
+        if (messaging.transport == Transport::POSTGRES) {
+            builder.registerInstance(std::make_shared<PostgresTransport>(
+                configuration["databaseConfig"]["connectionString"].get<std::string>(), messaging.claimBatch,
+                messaging.maxDeliveries)).as<IMessageTransport>();
+        } else {
+            builder.registerType<ActiveMqTransport>().as<IMessageTransport>().singleInstance();
+        }
+
+        auto backpressure = std::make_shared<Backpressure>(
+            postgressConnection, configuration.value("backpressure", nlohmann::json::object()).get<BackpressureConfiguration>());
+        builder.registerInstance(backpressure);
+        watcher->Subscribe("/backpressure", [backpressure](const nlohmann::json& section) {
+            backpressure->Reconfigure(section.get<BackpressureConfiguration>());
+        });
 
         builder.registerType<GroupAddTeamListener>();
         builder.registerType<MatchScoreUpdateListener>();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view>>().singleInstance();
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string>>().singleInstance();
-        builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
+        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view>>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "teams");
+            })
+            .singleInstance();
+        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string>>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "tournaments");
+            })
+            .singleInstance();
+        builder.registerType<MatchRepository>().as<IMatchRepository>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "matches");
+            })
+            .singleInstance();
 
+        builder.registerInstance(std::make_shared<SchedulerConfiguration>(
+            configuration.value("scheduling", nlohmann::json::object()).get<SchedulerConfiguration>()));
         builder.registerType<MatchDelegate>().singleInstance();
 
-        builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
+        builder.registerType<ReconciliationRepository>().as<IReconciliationRepository>().singleInstance();
+        builder.registerInstance(std::make_shared<ReconciliationConfiguration>(
+            configuration.value("reconciliation", nlohmann::json::object()).get<ReconciliationConfiguration>()));
+        builder.registerType<Reconciler>().singleInstance();
+
+        builder.registerType<GroupRepository>().as<IGroupRepository>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "groups");
+            })
+            .singleInstance();
 
         return builder.build();
     }
@@ -20,6 +20,18 @@ public:
         const std::vector<domain::Team>& teams
     );
 
+    // Round robin of one group, every team meets every other once. Names are G<round>-<match>, unique
+    // within the group; an odd group gives one team a bye per round.
+    std::vector<domain::Match> GenerateGroupStage(
+        const std::string& tournamentId,
+        const std::string& groupId,
+        const std::vector<domain::Team>& teams
+    );
+
+    // The same 63 matches with seed numbers ("1".."32") in place of team ids, arranged so seeds 1 and 2
+    // can only meet in the final. The repository swaps in the qualified teams.
+    std::vector<domain::Match> GenerateSeededBracket(const std::string& tournamentId);
+
 private:
     void GenerateWinnersBracket(
         std::vector<domain::Match>& matches,
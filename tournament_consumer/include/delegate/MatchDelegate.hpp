@@ -5,45 +5,81 @@
 #ifndef CONSUMER_MATCHDELEGATE_HPP
 #define CONSUMER_MATCHDELEGATE_HPP
 
+#include <chrono>
 #include <memory>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
 
 #include "event/TeamAddEvent.hpp"
 #include "event/ScoreUpdateEvent.hpp"
 #include "delegate/BracketGenerator.hpp"
+#include "delegate/MatchScheduler.hpp"
 #include "domain/Match.hpp"
+#include "domain/Tournament.hpp"
 #include "persistence/repository/GroupRepository.hpp"
 #include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/repository/IReconciliationRepository.hpp"
+#include "persistence/repository/IRepository.hpp"
 
 class MatchDelegate {
     std::shared_ptr<IMatchRepository> matchRepository;
     std::shared_ptr<GroupRepository> groupRepository;
+    std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
+    std::shared_ptr<SchedulerConfiguration> schedulerConfiguration;
     std::unique_ptr<BracketGenerator> bracketGenerator;
 
 public:
-    MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<GroupRepository>& groupRepository);
+    MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<GroupRepository>& groupRepository,
+                  const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepository,
+                  const std::shared_ptr<SchedulerConfiguration>& schedulerConfiguration);
     void ProcessTeamAddition(const domain::TeamAddEvent& teamAddEvent);
     void ProcessScoreUpdate(const domain::ScoreUpdateEvent& scoreUpdateEvent);
+    // Where winner and loser of every knockout match go next
+    IReconciliationRepository::Successors KnockoutSuccessors();
 
 private:
+    void ProcessGroupStageTeamAddition(const domain::TeamAddEvent& teamAddEvent, const domain::TournamentFormat& format);
+    void ProcessGroupStageResult(const domain::Match& match);
+    void ScheduleNewMatches(const std::string& tournamentId);
+    void RescheduleAfterOverrun(const domain::Match& match, MatchScheduler::Clock::time_point finishedAt);
+    std::vector<MatchScheduler::Dependency> Dependencies(const std::vector<domain::Match>& matches);
+    std::optional<MatchScheduler> NewScheduler(const std::string& tournamentId, MatchScheduler::Clock::time_point origin,
+                                               const std::vector<domain::Match>& matches);
+    std::vector<domain::Schedule> VenueBookings(const std::string& tournamentId, MatchScheduler::Clock::time_point origin);
     std::string GetWinnerNextMatch(const std::string& matchName);
     std::string GetLoserNextMatch(const std::string& matchName);
-    void AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId, bool isHome);
+    bool AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId);
 };
 
-inline MatchDelegate::MatchDelegate(const std::shared_ptr<IMatchRepository> &matchRepository, const std::shared_ptr<GroupRepository> &groupRepository)
-: matchRepository(matchRepository), groupRepository(groupRepository), bracketGenerator(std::make_unique<BracketGenerator>()) {}
+inline MatchDelegate::MatchDelegate(const std::shared_ptr<IMatchRepository> &matchRepository, const std::shared_ptr<GroupRepository> &groupRepository,
+                                    const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepository,
+                                    const std::shared_ptr<SchedulerConfiguration>& schedulerConfiguration)
+: matchRepository(matchRepository), groupRepository(groupRepository), tournamentRepository(tournamentRepository),
+  schedulerConfiguration(schedulerConfiguration), bracketGenerator(std::make_unique<BracketGenerator>()) {}
 
 inline void MatchDelegate::ProcessTeamAddition(const domain::TeamAddEvent& teamAddEvent) {
     std::cout << "[MatchDelegate] Processing team addition for tournament: " << teamAddEvent.tournamentId << std::endl;
+
+    const auto tournament = tournamentRepository->ReadById(teamAddEvent.tournamentId);
+    if (tournament != nullptr && tournament->Format().Type() == domain::TournamentType::GROUP_STAGE_KNOCKOUT) {
+        ProcessGroupStageTeamAddition(teamAddEvent, tournament->Format());
+        return;
+    }
     
     auto group = groupRepository->FindByTournamentIdAndGroupId(teamAddEvent.tournamentId, teamAddEvent.groupId);
-    if (group != nullptr && group->Teams().size() == 32) {
+    // a redelivered or reconciled event must not create the bracket twice
+    if (group != nullptr && group->Teams().size() == 32 && !matchRepository->MatchesExistForTournament(teamAddEvent.tournamentId)) {
         std::cout << "creating matches for " << teamAddEvent.tournamentId << " with " << group->Teams().size() << " teams" << std::endl;
         // Generate matches using BracketGenerator
         auto matches = bracketGenerator->GenerateMatches(teamAddEvent.tournamentId, group->Teams());
-        // Bulk insert matches into the repository
-        matchRepository->CreateBulk(matches);
+        // the check above can race a replay of the same event, the insert checks again under the stage lock
+        if (matchRepository->CreateBracket(teamAddEvent.tournamentId, matches).empty()) {
+            return;
+        }
+        ScheduleNewMatches(teamAddEvent.tournamentId);
         
         // Automatically play the entire tournament
         std::cout << "[MatchDelegate] Auto-playing entire tournament..." << std::endl;
@@ -115,7 +151,7 @@ inline void MatchDelegate::ProcessTeamAddition(const domain::TeamAddEvent& teamA
                 // Print tournament winner after final match
                 if (i == 1 || (i == 0 && matchName == "F0")) {
                     std::cout << "TOURNAMENT WINNER: " << match->VisitorTeamId() << std::endl;
-                
+                }
             }
         }
         
@@ -134,6 +170,16 @@ inline void MatchDelegate::ProcessScoreUpdate(const domain::ScoreUpdateEvent& sc
         return;
     }
     
+    // results without a recorded time (auto-play, replays) say nothing about when the match ended
+    if (scoreUpdateEvent.scoredAt) {
+        RescheduleAfterOverrun(*match, MatchScheduler::Clock::time_point(std::chrono::seconds(*scoreUpdateEvent.scoredAt)));
+    }
+
+    if (!match->GroupId().empty()) {
+        ProcessGroupStageResult(*match);
+        return;
+    }
+
     // Check if both teams are assigned
     if (match->HomeTeamId().empty() || match->VisitorTeamId().empty()) {
         std::cout << "[MatchDelegate] WARNING: Match " << match->Name() << " does not have both teams assigned yet" << std::endl;
@@ -159,13 +205,9 @@ inline void MatchDelegate::ProcessScoreUpdate(const domain::ScoreUpdateEvent& sc
     std::string winnerNextMatch = GetWinnerNextMatch(match->Name());
     std::string loserNextMatch = GetLoserNextMatch(match->Name());
     
-    // Advance winner to next match
+    // Advance winner to next match; a replayed result leaves a team that already advanced where it is
     if (!winnerNextMatch.empty()) {
-        auto nextMatch = matchRepository->FindByTournamentIdAndName(scoreUpdateEvent.tournamentId, winnerNextMatch);
-        if (nextMatch) {
-            // Assign to first available slot (home if empty, otherwise visitor)
-            bool assignToHome = nextMatch->HomeTeamId().empty();
-            AdvanceTeamToNextMatch(scoreUpdateEvent.tournamentId, winnerNextMatch, winnerTeamId, assignToHome);
+        if (AdvanceTeamToNextMatch(scoreUpdateEvent.tournamentId, winnerNextMatch, winnerTeamId)) {
             std::cout << "[MatchDelegate] Advanced winner " << winnerTeamId << " to match " << winnerNextMatch << std::endl;
         }
     } else {
@@ -174,15 +216,172 @@ inline void MatchDelegate::ProcessScoreUpdate(const domain::ScoreUpdateEvent& sc
     
     // Advance loser to losers bracket (if applicable)
     if (!loserNextMatch.empty()) {
-        auto nextMatch = matchRepository->FindByTournamentIdAndName(scoreUpdateEvent.tournamentId, loserNextMatch);
-        if (nextMatch) {
-            bool assignToHome = nextMatch->HomeTeamId().empty();
-            AdvanceTeamToNextMatch(scoreUpdateEvent.tournamentId, loserNextMatch, loserTeamId, assignToHome);
+        if (AdvanceTeamToNextMatch(scoreUpdateEvent.tournamentId, loserNextMatch, loserTeamId)) {
             std::cout << "[MatchDelegate] Advanced loser " << loserTeamId << " to match " << loserNextMatch << std::endl;
         }
     }
 }
 
+inline void MatchDelegate::ProcessGroupStageTeamAddition(const domain::TeamAddEvent& teamAddEvent, const domain::TournamentFormat& format) {
+    auto group = groupRepository->FindByTournamentIdAndGroupId(teamAddEvent.tournamentId, teamAddEvent.groupId);
+    if (group == nullptr || static_cast<int>(group->Teams().size()) < format.MaxTeamsPerGroup()) {
+        std::cout << teamAddEvent.tournamentId << " group " << teamAddEvent.groupId << " wait for teams, current teams: " << (group ? group->Teams().size() : 0) << std::endl;
+        return;
+    }
+    // a redelivered event for a full group must not schedule its round robin twice
+    if (matchRepository->MatchesExistForGroup(teamAddEvent.tournamentId, teamAddEvent.groupId)) {
+        return;
+    }
+    auto matches = bracketGenerator->GenerateGroupStage(teamAddEvent.tournamentId, teamAddEvent.groupId, group->Teams());
+    if (matchRepository->CreateGroupMatches(teamAddEvent.tournamentId, teamAddEvent.groupId, matches).empty()) {
+        return;
+    }
+    std::cout << "[MatchDelegate] " << matches.size() << " group stage matches created for group " << teamAddEvent.groupId << std::endl;
+    ScheduleNewMatches(teamAddEvent.tournamentId);
+}
+
+inline void MatchDelegate::ProcessGroupStageResult(const domain::Match& match) {
+    const auto tournament = tournamentRepository->ReadById(match.TournamentId());
+    if (tournament == nullptr) {
+        std::cout << "[MatchDelegate] ERROR: Tournament not found: " << match.TournamentId() << std::endl;
+        return;
+    }
+    // Standings, qualifiers and seeding are computed by the database in the same transaction that
+    // inserts the bracket, nothing happens until the last group match has a result
+    const auto created = matchRepository->StartKnockoutStage(
+        match.TournamentId(), tournament->Format().QualifiersPerGroup(), bracketGenerator->GenerateSeededBracket(match.TournamentId()));
+    if (!created.empty()) {
+        std::cout << "[MatchDelegate] Group stage complete, " << created.size() << " knockout matches created for " << match.TournamentId() << std::endl;
+        ScheduleNewMatches(match.TournamentId());
+    }
+}
+
+// Places the matches of the tournament that have no venue yet around the ones already scheduled and
+// the bookings of the other tournaments
+inline void MatchDelegate::ScheduleNewMatches(const std::string& tournamentId) {
+    if (schedulerConfiguration->venues.empty()) {
+        return;
+    }
+    auto matches = matchRepository->FindByTournamentId(tournamentId);
+    const auto now = MatchScheduler::Clock::now();
+    // new schedules start on the next full hour, later ones share the grid of the first
+    const auto nextHour = std::chrono::ceil<std::chrono::hours>(now);
+    const auto origin = MatchScheduler::Origin(matches, nextHour);
+    auto scheduler = NewScheduler(tournamentId, origin, matches);
+    if (!scheduler) {
+        return;
+    }
+    scheduler->Solve(now);
+
+    std::vector<domain::Match> scheduled;
+    for (size_t index = 0; index < matches.size(); ++index) {
+        if (matches[index].MatchSchedule().venue.empty()) {
+            matches[index].MatchSchedule() = scheduler->ScheduleOf(index);
+            scheduled.push_back(matches[index]);
+        }
+    }
+    matchRepository->UpdateSchedules(scheduled);
+    std::cout << "[MatchDelegate] " << scheduled.size() << " matches scheduled for " << tournamentId << std::endl;
+}
+
+// A result recorded after the end of the slot means the match overran, only what conflicts with it moves
+inline void MatchDelegate::RescheduleAfterOverrun(const domain::Match& match, MatchScheduler::Clock::time_point finishedAt) {
+    if (schedulerConfiguration->venues.empty() || match.MatchSchedule().venue.empty()) {
+        return;
+    }
+    const auto scheduledEnd = MatchScheduler::Clock::time_point(std::chrono::seconds(match.MatchSchedule().startsAt)) + schedulerConfiguration->slot;
+    if (finishedAt <= scheduledEnd || finishedAt > scheduledEnd + schedulerConfiguration->maxOverrun) {
+        return;
+    }
+    auto matches = matchRepository->FindByTournamentId(match.TournamentId());
+    const auto overrun = std::ranges::find(matches, match.Id(), [](const domain::Match& candidate) { return candidate.Id(); });
+    if (overrun == matches.end()) {
+        return;
+    }
+    const auto origin = MatchScheduler::Origin(matches, finishedAt);
+    auto scheduler = NewScheduler(match.TournamentId(), origin, matches);
+    if (!scheduler) {
+        return;
+    }
+    std::vector<domain::Match> moved;
+    for (const auto index : scheduler->Overrun(overrun - matches.begin(), finishedAt)) {
+        matches[index].MatchSchedule() = scheduler->ScheduleOf(index);
+        moved.push_back(matches[index]);
+    }
+    matchRepository->UpdateSchedules(moved);
+    if (!moved.empty()) {
+        std::cout << "[MatchDelegate] " << match.Name() << " overran, " << moved.size() << " matches rescheduled" << std::endl;
+    }
+}
+
+// Empty when the venue windows fit no slot of the grid: the matches stay unscheduled, failing the
+// message would only have it redelivered against the same configuration
+inline std::optional<MatchScheduler> MatchDelegate::NewScheduler(const std::string& tournamentId, MatchScheduler::Clock::time_point origin,
+                                                                 const std::vector<domain::Match>& matches) {
+    try {
+        return std::make_optional<MatchScheduler>(*schedulerConfiguration, origin, matches, Dependencies(matches), VenueBookings(tournamentId, origin));
+    } catch (const std::invalid_argument& e) {
+        std::cout << "[MatchDelegate] ERROR: matches of " << tournamentId << " left unscheduled: " << e.what() << std::endl;
+        return std::nullopt;
+    }
+}
+
+// Matches of other tournaments on the configured venues from the origin of the grid on
+inline std::vector<domain::Schedule> MatchDelegate::VenueBookings(const std::string& tournamentId, MatchScheduler::Clock::time_point origin) {
+    const auto from = std::chrono::duration_cast<std::chrono::seconds>(origin.time_since_epoch()) - schedulerConfiguration->slot;
+    return matchRepository->FindVenueBookings(tournamentId, from.count());
+}
+
+// Bracket edges from the advancement rules; the first knockout round waits for the whole group stage
+inline std::vector<MatchScheduler::Dependency> MatchDelegate::Dependencies(const std::vector<domain::Match>& matches) {
+    std::unordered_map<std::string, size_t> knockout;
+    std::vector<size_t> groupStage;
+    for (size_t index = 0; index < matches.size(); ++index) {
+        if (matches[index].GroupId().empty()) {
+            knockout.emplace(matches[index].Name(), index);
+        } else {
+            groupStage.push_back(index);
+        }
+    }
+    std::vector<MatchScheduler::Dependency> dependencies;
+    std::vector<bool> fed(matches.size(), false);
+    const auto link = [&](size_t before, const std::string& name) {
+        if (const auto after = knockout.find(name); after != knockout.end()) {
+            dependencies.emplace_back(before, after->second);
+            fed[after->second] = true;
+        }
+    };
+    for (const auto& [name, index] : knockout) {
+        link(index, GetWinnerNextMatch(name));
+        link(index, GetLoserNextMatch(name));
+    }
+    // the reset final is only played after the first one
+    if (const auto final = knockout.find("F0"); final != knockout.end()) {
+        link(final->second, "F1");
+    }
+    for (const auto& [name, index] : knockout) {
+        if (!fed[index]) {
+            for (const auto before : groupStage) {
+                dependencies.emplace_back(before, index);
+            }
+        }
+    }
+    return dependencies;
+}
+
+inline IReconciliationRepository::Successors MatchDelegate::KnockoutSuccessors() {
+    IReconciliationRepository::Successors successors;
+    for (int i = 0; i <= 30; ++i) {
+        const auto name = "W" + std::to_string(i);
+        successors.emplace(name, std::pair{GetWinnerNextMatch(name), GetLoserNextMatch(name)});
+    }
+    for (int i = 0; i <= 29; ++i) {
+        const auto name = "L" + std::to_string(i);
+        successors.emplace(name, std::pair{GetWinnerNextMatch(name), GetLoserNextMatch(name)});
+    }
+    return successors;
+}
+
 inline std::string MatchDelegate::GetWinnerNextMatch(const std::string& matchName) {
     // Winners bracket advancement (W0-W30)
     if (matchName[0] == 'W') {
@@ -310,23 +509,15 @@ inline std::string MatchDelegate::GetLoserNextMatch(const std::string& matchName
     return "";
 }
 
-inline void MatchDelegate::AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId, bool isHome) {
-    auto nextMatch = matchRepository->FindByTournamentIdAndName(tournamentId, nextMatchName);
-    if (!nextMatch) {
-        std::cout << "[MatchDelegate] ERROR: Next match " << nextMatchName << " not found" << std::endl;
-        return;
+// First free slot (home, then visitor), picked in the same statement that writes it: the live listener and
+// a Reconciler replay can advance into the same match at once. The slot can be recomputed from the
+// scores, so it does not wait for the WAL flush.
+inline bool MatchDelegate::AdvanceTeamToNextMatch(const std::string& tournamentId, const std::string& nextMatchName, const std::string& teamId) {
+    if (!matchRepository->AdvanceTeam(tournamentId, nextMatchName, teamId, Durability::RECOMPUTABLE)) {
+        return false;
     }
-    
-    // Update the next match with the advancing team
-    if (isHome) {
-        nextMatch->HomeTeamId() = teamId;
-    } else {
-        nextMatch->VisitorTeamId() = teamId;
-    }
-    
-    // Save the updated match
-    matchRepository->Update(nextMatch->Id(), *nextMatch);
-    std::cout << "[MatchDelegate] Team " << teamId << " assigned to match " << nextMatchName << " as " << (isHome ? "home" : "visitor") << std::endl;
+    std::cout << "[MatchDelegate] Team " << teamId << " assigned to match " << nextMatchName << std::endl;
+    return true;
 }
 
 #endif //CONSUMER_MATCHDELEGATE_HPP
\ No newline at end of file
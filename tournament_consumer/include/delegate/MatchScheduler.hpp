@@ -0,0 +1,148 @@
+//
+// Created by developer on 10/18/26.
+//
+
+#ifndef TOURNAMENTS_MATCHSCHEDULER_HPP
+#define TOURNAMENTS_MATCHSCHEDULER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "domain/Match.hpp"
+
+struct VenueConfiguration {
+    std::string name;
+    // daily window in UTC, a slot has to fit completely inside it
+    std::chrono::minutes opens{0};
+    std::chrono::minutes closes{24 * 60};
+};
+
+struct SchedulerConfiguration {
+    // without venues generated matches stay unscheduled
+    std::vector<VenueConfiguration> venues;
+    std::chrono::minutes slot{60};
+    // minimum time between the end of a team's match and the start of its next one
+    std::chrono::minutes rest{60};
+    // a result arriving later than this after the slot is a correction, not an overrun
+    std::chrono::minutes maxOverrun{180};
+    int localSearchPasses = 4;
+};
+
+// "HH:MM" to minutes after midnight
+inline std::chrono::minutes parseTimeOfDay(const std::string& time) {
+    const auto separator = time.find(':');
+    if (separator == std::string::npos) {
+        throw std::invalid_argument("Expected HH:MM, got " + time);
+    }
+    return std::chrono::hours(std::stoi(time.substr(0, separator))) + std::chrono::minutes(std::stoi(time.substr(separator + 1)));
+}
+
+inline void from_json(const nlohmann::json& json, VenueConfiguration& venue) {
+    json.at("name").get_to(venue.name);
+    if (json.contains("opens")) {
+        venue.opens = parseTimeOfDay(json["opens"].get<std::string>());
+    }
+    if (json.contains("closes")) {
+        venue.closes = parseTimeOfDay(json["closes"].get<std::string>());
+    }
+}
+
+inline void from_json(const nlohmann::json& json, SchedulerConfiguration& configuration) {
+    configuration.venues = json.value("venues", configuration.venues);
+    configuration.slot = std::chrono::minutes(json.value("slotMinutes", configuration.slot.count()));
+    configuration.rest = std::chrono::minutes(json.value("restMinutes", configuration.rest.count()));
+    configuration.maxOverrun = std::chrono::minutes(json.value("maxOverrunMinutes", configuration.maxOverrun.count()));
+    configuration.localSearchPasses = json.value("localSearchPasses", configuration.localSearchPasses);
+}
+
+// Assigns matches to a venue and a time slot. Time is cut into slots of equal length from an origin, a
+// match takes one slot on one venue. Constraints: a venue plays one match at a time and only inside its
+// daily window, a team rests between its matches, and a match starts only after the matches feeding it
+// (bracket dependencies) finished plus the rest time.
+// Everything is indexed arrays: teams and dependencies are kept as offset/value lists, venue occupancy
+// as one slot x venue grid. Solve places matches greedily in dependency order on the first feasible
+// slot, then local search moves each of them to an earlier free slot while that is feasible.
+// Matches that arrive already scheduled are kept where they are, and so are the bookings of other
+// tournaments: a venue is shared, those slots are simply not free.
+class MatchScheduler {
+public:
+    using Clock = std::chrono::system_clock;
+    // first has to be finished (plus rest) before second starts
+    using Dependency = std::pair<size_t, size_t>;
+
+private:
+    struct Assignment {
+        int32_t slot = -1;
+        int32_t venue = -1;
+        int32_t length = 1;
+    };
+
+    SchedulerConfiguration configuration;
+    int64_t originSeconds;
+    int64_t slotSeconds;
+    int32_t restSlots;
+    int32_t venueCount;
+    std::vector<std::string> venueNames;
+
+    std::vector<int32_t> home;
+    std::vector<int32_t> visitor;
+    std::vector<int32_t> teamOffsets;
+    std::vector<int32_t> teamMatches;
+    std::vector<int32_t> predecessorOffsets;
+    std::vector<int32_t> predecessors;
+    std::vector<int32_t> successorOffsets;
+    std::vector<int32_t> successors;
+
+    std::vector<Assignment> assignments;
+    static constexpr int32_t FREE = -1;
+    static constexpr int32_t BOOKED = -2;
+    // slot * venueCount + venue -> match, FREE, or BOOKED by another tournament
+    std::vector<int32_t> occupancy;
+
+    // First slot starting at or after time
+    int32_t slotOf(Clock::time_point time) const;
+    bool isOpen(int32_t slot, int32_t venue) const;
+    int32_t& cell(int32_t slot, int32_t venue);
+    void occupy(int32_t match, int32_t slot, int32_t venue, int32_t length);
+    void release(int32_t match);
+    // Blocks every slot overlapping a match of another tournament, whose grid may start elsewhere
+    void book(int64_t startsAt, int32_t venue);
+    // Earliest slot allowed by the predecessors of match
+    int32_t earliestSlot(int32_t match, int32_t notBefore) const;
+    // Whether slot keeps the rest time to every other scheduled match of both teams
+    bool restsAt(int32_t match, int32_t slot) const;
+    bool startsBeforeSuccessors(int32_t match, int32_t slot) const;
+    // First venue free and open at slot, -1 when there is none
+    int32_t freeVenue(int32_t slot);
+    void place(int32_t match, int32_t notBefore);
+    bool feasible(int32_t match);
+    void improve(std::vector<int32_t>& placed, int32_t notBefore);
+
+public:
+    // Throws invalid_argument when no slot starting at origin + k * slot fits inside a venue window
+    MatchScheduler(SchedulerConfiguration configuration,
+                   Clock::time_point origin,
+                   const std::vector<domain::Match>& matches,
+                   const std::vector<Dependency>& dependencies,
+                   const std::vector<domain::Schedule>& booked = {});
+
+    // Start of the earliest scheduled match, or fallback when none is scheduled yet
+    static Clock::time_point Origin(const std::vector<domain::Match>& matches, Clock::time_point fallback);
+
+    // Places every match without a schedule, none earlier than notBefore
+    void Solve(Clock::time_point notBefore);
+
+    // `match` ended at finishedAt, after its slot. Only matches that now conflict move, each to its first
+    // feasible slot, and the change ripples through venues, teams and dependencies from there.
+    // Returns the matches that moved.
+    std::vector<size_t> Overrun(size_t match, Clock::time_point finishedAt);
+
+    [[nodiscard]] domain::Schedule ScheduleOf(size_t match) const;
+};
+
+#endif //TOURNAMENTS_MATCHSCHEDULER_HPP
@@ -0,0 +1,187 @@
+#ifndef CONSUMER_RECONCILER_HPP
+#define CONSUMER_RECONCILER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "delegate/MatchDelegate.hpp"
+#include "event/ScoreUpdateEvent.hpp"
+#include "event/TeamAddEvent.hpp"
+#include "persistence/repository/IReconciliationRepository.hpp"
+
+struct ReconciliationConfiguration {
+    // how far back the startup scan looks, the periodic scans continue from where the previous one ended
+    std::chrono::hours startupLookback{24 * 7};
+    std::chrono::seconds interval{300};
+    // rows touched more recently than this may still have their event on the way and are left for the next scan
+    std::chrono::seconds grace{300};
+    size_t batchSize = 100;
+    // tournaments repaired at the same time, each one sequentially
+    size_t parallelism = 2;
+};
+
+inline void from_json(const nlohmann::json& json, ReconciliationConfiguration& configuration) {
+    configuration.startupLookback = std::chrono::hours(json.value("startupLookbackHours", configuration.startupLookback.count()));
+    configuration.interval = std::chrono::seconds(json.value("intervalSeconds", configuration.interval.count()));
+    configuration.grace = std::chrono::seconds(json.value("graceSeconds", configuration.grace.count()));
+    configuration.batchSize = std::max<size_t>(json.value("batchSize", configuration.batchSize), 1);
+    configuration.parallelism = std::max<size_t>(json.value("parallelism", configuration.parallelism), 1);
+}
+
+// Repairs what a lost tournament.team-add or tournament.score-update message left behind: a full group
+// without matches, or a result that never advanced the bracket. The scans are set based and only read
+// rows touched since the previous scan, so a repair costs the broken tournaments, not the whole data set.
+// A repair is the lost event processed again by MatchDelegate, which ignores what is already done.
+// The window only moves forward once no repair in it failed.
+class Reconciler {
+    using Clock = IReconciliationRepository::Clock;
+
+    std::shared_ptr<IReconciliationRepository> reconciliationRepository;
+    std::shared_ptr<MatchDelegate> matchDelegate;
+    ReconciliationConfiguration configuration;
+    std::jthread thread;
+
+    // Everything of one tournament, in the order it has to be applied
+    struct Repairs {
+        std::vector<domain::TeamAddEvent> groups;
+        std::vector<domain::ScoreUpdateEvent> results;
+    };
+
+    // Returns how many repairs failed
+    size_t repair(const std::map<std::string, Repairs>& tournaments) {
+        std::vector<const std::pair<const std::string, Repairs>*> pending;
+        for (const auto& tournament : tournaments) {
+            pending.push_back(&tournament);
+        }
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> failed{0};
+        auto work = [this, &pending, &next, &failed] {
+            for (size_t index = next++; index < pending.size(); index = next++) {
+                const auto& [tournamentId, repairs] = *pending[index];
+                for (const auto& event : repairs.groups) {
+                    try {
+                        matchDelegate->ProcessTeamAddition(event);
+                    } catch (const std::exception& e) {
+                        ++failed;
+                        std::cout << "[Reconciler] ERROR repairing group " << event.groupId << " of " << tournamentId << ": " << e.what() << std::endl;
+                    }
+                }
+                for (const auto& event : repairs.results) {
+                    try {
+                        matchDelegate->ProcessScoreUpdate(event);
+                    } catch (const std::exception& e) {
+                        ++failed;
+                        std::cout << "[Reconciler] ERROR repairing match " << event.matchId << " of " << tournamentId << ": " << e.what() << std::endl;
+                    }
+                }
+            }
+        };
+        std::vector<std::future<void>> workers;
+        for (size_t i = 1; i < std::min(configuration.parallelism, pending.size()); i++) {
+            workers.push_back(std::async(std::launch::async, work));
+        }
+        work();
+        for (auto& worker : workers) {
+            worker.get();
+        }
+        return failed;
+    }
+
+    void run(std::stop_token stop) {
+        auto since = Clock::now() - configuration.startupLookback;
+        std::mutex sleepMutex;
+        std::condition_variable_any wakeUp;
+        while (!stop.stop_requested()) {
+            const auto until = Clock::now() - configuration.grace;
+            try {
+                if (Reconcile(since, until)) {
+                    since = until;
+                }
+            } catch (const std::exception& e) {
+                std::cout << "[Reconciler] ERROR scan failed, retrying next interval: " << e.what() << std::endl;
+            }
+            std::unique_lock lock(sleepMutex);
+            wakeUp.wait_for(lock, stop, configuration.interval, [] { return false; });
+        }
+    }
+
+public:
+    Reconciler(const std::shared_ptr<IReconciliationRepository>& reconciliationRepository, const std::shared_ptr<MatchDelegate>& matchDelegate,
+               const std::shared_ptr<ReconciliationConfiguration>& configuration)
+        : reconciliationRepository(reconciliationRepository), matchDelegate(matchDelegate), configuration(*configuration) {}
+
+    // One scan of (since, until] in pages, each scan continuing after the last row of its previous page,
+    // so a row is replayed at most once per scan. False when a repair failed and the window has to be
+    // scanned again; what replaying the event does not fix is left for the next event on that tournament.
+    bool Reconcile(Clock::time_point since, Clock::time_point until) {
+        const auto successors = matchDelegate->KnockoutSuccessors();
+        ScanPosition groupsAfter;
+        ScanPosition resultsAfter;
+        bool groupsLeft = true;
+        bool resultsLeft = true;
+        size_t repaired = 0;
+        size_t failures = 0;
+        while (groupsLeft || resultsLeft) {
+            std::map<std::string, Repairs> tournaments;
+            size_t found = 0;
+            if (groupsLeft) {
+                const auto groups = reconciliationRepository->FindStalledGroups(since, until, configuration.batchSize, groupsAfter);
+                for (const auto& group : groups) {
+                    tournaments[group.tournamentId].groups.push_back({group.tournamentId, group.groupId, ""});
+                }
+                found += groups.size();
+                // a full page may have more behind it
+                groupsLeft = groups.size() == configuration.batchSize;
+                if (!groups.empty()) {
+                    groupsAfter = groups.back().position;
+                }
+            }
+            if (resultsLeft) {
+                const auto results = reconciliationRepository->FindUnadvancedResults(since, until, configuration.batchSize, successors, resultsAfter);
+                for (const auto& result : results) {
+                    // no scoredAt: a replay happens long after the match, it says nothing about an overrun
+                    tournaments[result.tournamentId].results.push_back(
+                        {result.tournamentId, result.matchId, result.score.homeTeamScore, result.score.visitorTeamScore, std::nullopt});
+                }
+                found += results.size();
+                resultsLeft = results.size() == configuration.batchSize;
+                if (!results.empty()) {
+                    resultsAfter = results.back().position;
+                }
+            }
+            if (found == 0) {
+                break;
+            }
+            const auto failed = repair(tournaments);
+            repaired += found - failed;
+            failures += failed;
+        }
+        if (repaired > 0 || failures > 0) {
+            std::cout << "[Reconciler] " << repaired << " repairs applied, " << failures << " failed" << std::endl;
+        }
+        return failures == 0;
+    }
+
+    // Scans once right away, then every interval, on a background thread
+    void Start() {
+        if (!thread.joinable()) {
+            thread = std::jthread([this](std::stop_token stop) { run(stop); });
+        }
+    }
+};
+
+#endif //CONSUMER_RECONCILER_HPP
@@ -5,6 +5,8 @@
 #ifndef TOURNAMENTS_SCOREUPDATEEVENT_HPP
 #define TOURNAMENTS_SCOREUPDATEEVENT_HPP
 
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <nlohmann/json.hpp>
 
@@ -14,6 +16,9 @@ namespace domain {
         std::string matchId;
         int homeTeamScore;
         int visitorTeamScore;
+        // when the services recorded the score, seconds since epoch UTC; absent on events the consumer
+        // makes up itself and on events queued by older services
+        std::optional<int64_t> scoredAt;
     };
 
     inline void from_json(const nlohmann::json &json, ScoreUpdateEvent &event) {
@@ -21,6 +26,9 @@ namespace domain {
         json.at("matchId").get_to(event.matchId);
         json.at("homeTeamScore").get_to(event.homeTeamScore);
         json.at("visitorTeamScore").get_to(event.visitorTeamScore);
+        if (json.contains("scoredAt")) {
+            event.scoredAt = json["scoredAt"].get<int64_t>();
+        }
     }
 }
 
@@ -13,6 +13,12 @@ int main() {
         const auto container = config::containerSetup();
         std::println("after container");
 
+        auto adminServer = container->resolve<AdminServer>();
+        adminServer->Start();
+        container->resolve<config::ConfigurationWatcher>()->Start();
+        // repairs brackets left behind by lost messages, first at startup then periodically
+        container->resolve<Reconciler>()->Start();
+
         auto teamAddListener = container->resolve<GroupAddTeamListener>();
         auto scoreUpdateListener = container->resolve<MatchScoreUpdateListener>();
 
@@ -3,8 +3,11 @@
 //
 
 #include "delegate/BracketGenerator.hpp"
+#include <algorithm>
 #include <stdexcept>
 
+#include "domain/Tournament.hpp"
+
 std::vector<domain::Match> BracketGenerator::GenerateMatches(
     const std::string& tournamentId,
     const std::vector<domain::Team>& teams
@@ -23,6 +26,72 @@ std::vector<domain::Match> BracketGenerator::GenerateMatches(
     return matches;
 }
 
+std::vector<domain::Match> BracketGenerator::GenerateGroupStage(
+    const std::string& tournamentId,
+    const std::string& groupId,
+    const std::vector<domain::Team>& teams
+) {
+    if (teams.size() < 2) {
+        throw std::invalid_argument("A group stage needs at least 2 teams");
+    }
+
+    // Circle method: the first slot stays, the others rotate one place every round
+    std::vector<int> slots;
+    for (int i = 0; i < static_cast<int>(teams.size()); ++i) {
+        slots.push_back(i);
+    }
+    if (slots.size() % 2 != 0) {
+        slots.push_back(-1); // bye
+    }
+    const int size = static_cast<int>(slots.size());
+
+    std::vector<domain::Match> matches;
+    matches.reserve(teams.size() * (teams.size() - 1) / 2);
+    for (int round = 0; round < size - 1; ++round) {
+        int number = 0;
+        for (int i = 0; i < size / 2; ++i) {
+            const int first = slots[i];
+            const int second = slots[size - 1 - i];
+            if (first < 0 || second < 0) {
+                continue;
+            }
+            // alternate home and visitor so the fixed team is not always at home
+            const bool swap = round % 2 != 0;
+            domain::Match match;
+            match.Name() = "G" + std::to_string(round) + "-" + std::to_string(number++);
+            match.TournamentId() = tournamentId;
+            match.GroupId() = groupId;
+            match.HomeTeamId() = teams[swap ? second : first].Id;
+            match.VisitorTeamId() = teams[swap ? first : second].Id;
+            matches.push_back(match);
+        }
+        std::rotate(slots.begin() + 1, slots.end() - 1, slots.end());
+    }
+    return matches;
+}
+
+std::vector<domain::Match> BracketGenerator::GenerateSeededBracket(const std::string& tournamentId) {
+    // Standard seeding order, each round doubles it by pairing seed s with (2 * size + 1 - s)
+    std::vector<int> order = {1};
+    while (static_cast<int>(order.size()) < domain::KNOCKOUT_TEAMS) {
+        const int size = static_cast<int>(order.size());
+        std::vector<int> next;
+        for (const int seed : order) {
+            next.push_back(seed);
+            next.push_back(2 * size + 1 - seed);
+        }
+        order = std::move(next);
+    }
+
+    std::vector<domain::Team> seeds;
+    for (const int seed : order) {
+        domain::Team team;
+        team.Id = std::to_string(seed);
+        seeds.push_back(team);
+    }
+    return GenerateMatches(tournamentId, seeds);
+}
+
 void BracketGenerator::GenerateWinnersBracket(
     std::vector<domain::Match>& matches,
     const std::string& tournamentId,
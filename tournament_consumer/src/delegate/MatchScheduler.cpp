@@ -0,0 +1,390 @@
+//
+// Created by developer on 10/18/26.
+//
+
+#include "delegate/MatchScheduler.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <queue>
+#include <ranges>
+#include <unordered_map>
+
+namespace {
+    constexpr int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+    // Offsets/values lists (CSR) out of (key, value) pairs
+    void buildAdjacency(size_t keys, const std::vector<std::pair<int32_t, int32_t>>& pairs,
+                        std::vector<int32_t>& offsets, std::vector<int32_t>& values) {
+        offsets.assign(keys + 1, 0);
+        for (const auto& [key, value] : pairs) {
+            ++offsets[key + 1];
+        }
+        for (size_t key = 0; key < keys; ++key) {
+            offsets[key + 1] += offsets[key];
+        }
+        values.resize(pairs.size());
+        std::vector<int32_t> next(offsets.begin(), offsets.end() - 1);
+        for (const auto& [key, value] : pairs) {
+            values[next[key]++] = value;
+        }
+    }
+}
+
+MatchScheduler::MatchScheduler(SchedulerConfiguration configuration,
+                               Clock::time_point origin,
+                               const std::vector<domain::Match>& matches,
+                               const std::vector<Dependency>& dependencies,
+                               const std::vector<domain::Schedule>& booked)
+    : configuration(std::move(configuration)),
+      originSeconds(std::chrono::duration_cast<std::chrono::seconds>(origin.time_since_epoch()).count()),
+      slotSeconds(std::chrono::duration_cast<std::chrono::seconds>(this->configuration.slot).count()) {
+    if (slotSeconds <= 0) {
+        throw std::invalid_argument("Scheduler slot has to be longer than zero");
+    }
+    // Slot starts repeat every day after SECONDS_PER_DAY / gcd(slot, day) slots. Unless one of them fits
+    // a venue window, place() would search forever.
+    const auto cycle = static_cast<int32_t>(SECONDS_PER_DAY / std::gcd(slotSeconds, SECONDS_PER_DAY));
+    const auto fits = [this, cycle](int32_t venue) {
+        for (int32_t slot = 0; slot < cycle; ++slot) {
+            if (isOpen(slot, venue)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (std::ranges::none_of(std::views::iota(0, static_cast<int32_t>(this->configuration.venues.size())), fits)) {
+        throw std::invalid_argument("No slot of the grid fits inside a venue window");
+    }
+    restSlots = static_cast<int32_t>((std::chrono::duration_cast<std::chrono::seconds>(this->configuration.rest).count() + slotSeconds - 1) / slotSeconds);
+    venueCount = static_cast<int32_t>(this->configuration.venues.size());
+    std::unordered_map<std::string, int32_t> venueIndex;
+    for (const auto& venue : this->configuration.venues) {
+        venueIndex.emplace(venue.name, static_cast<int32_t>(venueNames.size()));
+        venueNames.push_back(venue.name);
+    }
+
+    std::unordered_map<std::string, int32_t> teamIndex;
+    const auto indexOf = [&teamIndex](const std::string& teamId) {
+        if (teamId.empty()) {
+            return -1;
+        }
+        return teamIndex.try_emplace(teamId, static_cast<int32_t>(teamIndex.size())).first->second;
+    };
+    const auto count = matches.size();
+    home.resize(count);
+    visitor.resize(count);
+    std::vector<std::pair<int32_t, int32_t>> teamPairs;
+    teamPairs.reserve(count * 2);
+    for (size_t match = 0; match < count; ++match) {
+        home[match] = indexOf(matches[match].HomeTeamId());
+        visitor[match] = indexOf(matches[match].VisitorTeamId());
+        for (const auto team : {home[match], visitor[match]}) {
+            if (team >= 0) {
+                teamPairs.emplace_back(team, static_cast<int32_t>(match));
+            }
+        }
+    }
+    buildAdjacency(teamIndex.size(), teamPairs, teamOffsets, teamMatches);
+
+    std::vector<std::pair<int32_t, int32_t>> forward;
+    std::vector<std::pair<int32_t, int32_t>> backward;
+    forward.reserve(dependencies.size());
+    backward.reserve(dependencies.size());
+    for (const auto& [before, after] : dependencies) {
+        forward.emplace_back(static_cast<int32_t>(before), static_cast<int32_t>(after));
+        backward.emplace_back(static_cast<int32_t>(after), static_cast<int32_t>(before));
+    }
+    buildAdjacency(count, forward, successorOffsets, successors);
+    buildAdjacency(count, backward, predecessorOffsets, predecessors);
+
+    assignments.resize(count);
+    for (size_t match = 0; match < count; ++match) {
+        const auto& schedule = matches[match].MatchSchedule();
+        const auto venue = venueIndex.find(schedule.venue);
+        // a venue that is no longer configured is scheduled again
+        if (schedule.venue.empty() || venue == venueIndex.end() || schedule.startsAt < originSeconds) {
+            continue;
+        }
+        occupy(static_cast<int32_t>(match), static_cast<int32_t>((schedule.startsAt - originSeconds) / slotSeconds), venue->second, 1);
+    }
+    for (const auto& schedule : booked) {
+        if (const auto venue = venueIndex.find(schedule.venue); venue != venueIndex.end()) {
+            book(schedule.startsAt, venue->second);
+        }
+    }
+}
+
+MatchScheduler::Clock::time_point MatchScheduler::Origin(const std::vector<domain::Match>& matches, Clock::time_point fallback) {
+    std::optional<int64_t> earliest;
+    for (const auto& match : matches) {
+        if (!match.MatchSchedule().venue.empty()) {
+            earliest = std::min(earliest.value_or(match.MatchSchedule().startsAt), match.MatchSchedule().startsAt);
+        }
+    }
+    return earliest ? Clock::time_point(std::chrono::seconds(*earliest)) : fallback;
+}
+
+int32_t MatchScheduler::slotOf(Clock::time_point time) const {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch()).count() - originSeconds;
+    return elapsed <= 0 ? 0 : static_cast<int32_t>((elapsed + slotSeconds - 1) / slotSeconds);
+}
+
+bool MatchScheduler::isOpen(int32_t slot, int32_t venue) const {
+    const auto start = originSeconds + slot * slotSeconds;
+    const auto timeOfDay = (start % SECONDS_PER_DAY + SECONDS_PER_DAY) % SECONDS_PER_DAY;
+    const auto& window = configuration.venues[venue];
+    return timeOfDay >= std::chrono::duration_cast<std::chrono::seconds>(window.opens).count()
+        && timeOfDay + slotSeconds <= std::chrono::duration_cast<std::chrono::seconds>(window.closes).count();
+}
+
+int32_t& MatchScheduler::cell(int32_t slot, int32_t venue) {
+    const auto index = static_cast<size_t>(slot) * venueCount + venue;
+    if (index >= occupancy.size()) {
+        occupancy.resize(std::max(index + 1, occupancy.size() * 2), FREE);
+    }
+    return occupancy[index];
+}
+
+void MatchScheduler::occupy(int32_t match, int32_t slot, int32_t venue, int32_t length) {
+    for (int32_t offset = 0; offset < length; ++offset) {
+        cell(slot + offset, venue) = match;
+    }
+    assignments[match] = {slot, venue, length};
+}
+
+void MatchScheduler::release(int32_t match) {
+    auto& assignment = assignments[match];
+    for (int32_t offset = 0; offset < assignment.length; ++offset) {
+        if (auto& owner = cell(assignment.slot + offset, assignment.venue); owner == match) {
+            owner = FREE;
+        }
+    }
+    assignment = {};
+}
+
+void MatchScheduler::book(int64_t startsAt, int32_t venue) {
+    const auto from = std::max<int64_t>(startsAt - originSeconds, 0);
+    const auto until = startsAt + slotSeconds - originSeconds;
+    for (auto slot = from / slotSeconds; slot * slotSeconds < until; ++slot) {
+        if (auto& owner = cell(static_cast<int32_t>(slot), venue); owner == FREE) {
+            owner = BOOKED;
+        }
+    }
+}
+
+int32_t MatchScheduler::earliestSlot(int32_t match, int32_t notBefore) const {
+    auto earliest = notBefore;
+    for (auto index = predecessorOffsets[match]; index < predecessorOffsets[match + 1]; ++index) {
+        const auto& before = assignments[predecessors[index]];
+        if (before.slot >= 0) {
+            earliest = std::max(earliest, before.slot + before.length + restSlots);
+        }
+    }
+    return earliest;
+}
+
+bool MatchScheduler::restsAt(int32_t match, int32_t slot) const {
+    const auto length = assignments[match].slot >= 0 ? assignments[match].length : 1;
+    for (const auto team : {home[match], visitor[match]}) {
+        if (team < 0) {
+            continue;
+        }
+        for (auto index = teamOffsets[team]; index < teamOffsets[team + 1]; ++index) {
+            const auto other = teamMatches[index];
+            const auto& assignment = assignments[other];
+            if (other == match || assignment.slot < 0) {
+                continue;
+            }
+            if (slot + length + restSlots > assignment.slot && assignment.slot + assignment.length + restSlots > slot) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool MatchScheduler::startsBeforeSuccessors(int32_t match, int32_t slot) const {
+    for (auto index = successorOffsets[match]; index < successorOffsets[match + 1]; ++index) {
+        const auto& after = assignments[successors[index]];
+        if (after.slot >= 0 && slot + assignments[match].length + restSlots > after.slot) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t MatchScheduler::freeVenue(int32_t slot) {
+    for (int32_t venue = 0; venue < venueCount; ++venue) {
+        if (isOpen(slot, venue) && cell(slot, venue) == FREE) {
+            return venue;
+        }
+    }
+    return -1;
+}
+
+void MatchScheduler::place(int32_t match, int32_t notBefore) {
+    for (auto slot = earliestSlot(match, notBefore);; ++slot) {
+        if (!restsAt(match, slot)) {
+            continue;
+        }
+        if (const auto venue = freeVenue(slot); venue >= 0) {
+            occupy(match, slot, venue, 1);
+            return;
+        }
+    }
+}
+
+bool MatchScheduler::feasible(int32_t match) {
+    const auto& assignment = assignments[match];
+    if (assignment.slot < 0) {
+        return false;
+    }
+    for (int32_t offset = 0; offset < assignment.length; ++offset) {
+        if (cell(assignment.slot + offset, assignment.venue) != match) {
+            return false;
+        }
+    }
+    return assignment.slot >= earliestSlot(match, 0) && restsAt(match, assignment.slot);
+}
+
+void MatchScheduler::improve(std::vector<int32_t>& placed, int32_t notBefore) {
+    for (int pass = 0; pass < configuration.localSearchPasses; ++pass) {
+        bool improved = false;
+        std::ranges::sort(placed, {}, [this](int32_t match) { return assignments[match].slot; });
+        for (const auto match : placed) {
+            const auto current = assignments[match].slot;
+            for (auto slot = earliestSlot(match, notBefore); slot < current; ++slot) {
+                if (!restsAt(match, slot) || !startsBeforeSuccessors(match, slot)) {
+                    continue;
+                }
+                if (const auto venue = freeVenue(slot); venue >= 0) {
+                    release(match);
+                    occupy(match, slot, venue, 1);
+                    improved = true;
+                    break;
+                }
+            }
+        }
+        if (!improved) {
+            return;
+        }
+    }
+}
+
+void MatchScheduler::Solve(Clock::time_point notBefore) {
+    const auto firstSlot = slotOf(notBefore);
+    const auto count = static_cast<int32_t>(assignments.size());
+
+    // dependency order among the matches still to place, generation order (rounds) breaks ties
+    std::vector<int32_t> pending(count, 0);
+    std::priority_queue<int32_t, std::vector<int32_t>, std::greater<>> ready;
+    for (int32_t match = 0; match < count; ++match) {
+        if (assignments[match].slot >= 0) {
+            continue;
+        }
+        for (auto index = predecessorOffsets[match]; index < predecessorOffsets[match + 1]; ++index) {
+            pending[match] += assignments[predecessors[index]].slot < 0;
+        }
+        if (pending[match] == 0) {
+            ready.push(match);
+        }
+    }
+
+    std::vector<int32_t> placed;
+    while (!ready.empty()) {
+        const auto match = ready.top();
+        ready.pop();
+        place(match, firstSlot);
+        placed.push_back(match);
+        for (auto index = successorOffsets[match]; index < successorOffsets[match + 1]; ++index) {
+            const auto after = successors[index];
+            if (assignments[after].slot < 0 && --pending[after] == 0) {
+                ready.push(after);
+            }
+        }
+    }
+    // a dependency cycle cannot be honoured, its matches are still placed
+    for (int32_t match = 0; match < count; ++match) {
+        if (assignments[match].slot < 0) {
+            place(match, firstSlot);
+            placed.push_back(match);
+        }
+    }
+    improve(placed, firstSlot);
+}
+
+std::vector<size_t> MatchScheduler::Overrun(size_t match, Clock::time_point finishedAt) {
+    const auto overrun = static_cast<int32_t>(match);
+    auto& assignment = assignments[overrun];
+    if (assignment.slot < 0) {
+        return {};
+    }
+    const auto played = std::chrono::duration_cast<std::chrono::seconds>(finishedAt.time_since_epoch()).count()
+        - (originSeconds + assignment.slot * slotSeconds);
+    const auto length = static_cast<int32_t>((played + slotSeconds - 1) / slotSeconds);
+    if (length <= assignment.length) {
+        return {};
+    }
+
+    // matches due to start while the overrun match was still being played lose their venue
+    std::deque<int32_t> work;
+    for (auto offset = assignment.length; offset < length; ++offset) {
+        auto& owner = cell(assignment.slot + offset, assignment.venue);
+        if (owner >= 0 && owner != overrun) {
+            work.push_back(owner);
+        }
+        owner = overrun;
+    }
+    assignment.length = length;
+
+    const auto firstSlot = slotOf(finishedAt);
+    const auto enqueueDependents = [this, &work, firstSlot](int32_t moved) {
+        for (auto index = successorOffsets[moved]; index < successorOffsets[moved + 1]; ++index) {
+            work.push_back(successors[index]);
+        }
+        for (const auto team : {home[moved], visitor[moved]}) {
+            if (team < 0) {
+                continue;
+            }
+            for (auto index = teamOffsets[team]; index < teamOffsets[team + 1]; ++index) {
+                if (const auto other = teamMatches[index]; other != moved && assignments[other].slot >= firstSlot) {
+                    work.push_back(other);
+                }
+            }
+        }
+    };
+    enqueueDependents(overrun);
+
+    std::vector<uint8_t> changed(assignments.size(), 0);
+    while (!work.empty()) {
+        const auto next = work.front();
+        work.pop_front();
+        if (next == overrun || feasible(next)) {
+            continue;
+        }
+        release(next);
+        place(next, firstSlot);
+        changed[next] = 1;
+        enqueueDependents(next);
+    }
+
+    std::vector<size_t> moved;
+    for (size_t index = 0; index < changed.size(); ++index) {
+        if (changed[index]) {
+            moved.push_back(index);
+        }
+    }
+    return moved;
+}
+
+domain::Schedule MatchScheduler::ScheduleOf(size_t match) const {
+    const auto& assignment = assignments[match];
+    if (assignment.slot < 0) {
+        return {};
+    }
+    return {venueNames[assignment.venue], originSeconds + assignment.slot * slotSeconds};
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+#include "cms/Backpressure.hpp"
+
+// Pool de prueba con una espera de checkout fija
+class WaitingConnectionProvider : public IDbConnectionProvider {
+public:
+    std::chrono::microseconds wait{0};
+    using IDbConnectionProvider::Connection;
+
+    PooledConnection Connection() override {
+        return PooledConnection(nullptr, [](IDbConnection*) {});
+    }
+
+    std::chrono::microseconds CheckoutWait() override {
+        return wait;
+    }
+};
+
+class BackpressureTest : public ::testing::Test {
+protected:
+    std::shared_ptr<WaitingConnectionProvider> pool = std::make_shared<WaitingConnectionProvider>();
+    Backpressure backpressure{pool, BackpressureConfiguration{
+        .queueCapacity = 10, .pauseDepth = 8, .pauseWait = std::chrono::milliseconds(200),
+        .resumeDepth = 2, .resumeWait = std::chrono::milliseconds(20)}};
+};
+
+// Validar que la cola llena pausa y que solo se reanuda por debajo de la marca de reanudacion
+TEST_F(BackpressureTest, QueueDepth_PausesAndResumesWithHysteresis) {
+    EXPECT_FALSE(backpressure.Paused(false, 7));
+    EXPECT_TRUE(backpressure.Paused(false, 8));
+
+    EXPECT_TRUE(backpressure.Paused(true, 5));
+    EXPECT_TRUE(backpressure.Paused(true, 3));
+    EXPECT_FALSE(backpressure.Paused(true, 2));
+}
+
+// Validar que la espera del pool pausa aunque la cola este vacia
+TEST_F(BackpressureTest, CheckoutWait_PausesUntilPoolRecovers) {
+    pool->wait = std::chrono::milliseconds(300);
+    EXPECT_TRUE(backpressure.Paused(false, 0));
+
+    pool->wait = std::chrono::milliseconds(100);
+    EXPECT_TRUE(backpressure.Paused(true, 0));
+    EXPECT_FALSE(backpressure.Paused(false, 0));
+
+    pool->wait = std::chrono::milliseconds(10);
+    EXPECT_FALSE(backpressure.Paused(true, 0));
+}
+
+// Validar la lectura de la configuracion y el rechazo de marcas inconsistentes
+TEST_F(BackpressureTest, Configuration_Json) {
+    const auto configuration = nlohmann::json{{"queueCapacity", 32}, {"pauseDepth", 24}, {"resumeDepth", 4}, {"pauseWaitMillis", 500}}
+        .get<BackpressureConfiguration>();
+    EXPECT_EQ(configuration.queueCapacity, 32);
+    EXPECT_EQ(configuration.pauseDepth, 24);
+    EXPECT_EQ(configuration.resumeDepth, 4);
+    EXPECT_EQ(configuration.pauseWait, std::chrono::milliseconds(500));
+    EXPECT_EQ(configuration.resumeWait, std::chrono::milliseconds(50));
+
+    EXPECT_THROW(nlohmann::json({{"queueCapacity", 8}, {"pauseDepth", 16}}).get<BackpressureConfiguration>(), std::invalid_argument);
+    EXPECT_THROW(nlohmann::json({{"pauseDepth", 10}, {"resumeDepth", 20}}).get<BackpressureConfiguration>(), std::invalid_argument);
+}
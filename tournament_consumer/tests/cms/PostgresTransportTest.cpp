@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <pqxx/pqxx>
+
+#include "cms/PostgresTransport.hpp"
+
+// Pruebas contra una base real con la tabla MESSAGE_QUEUE de database/db_script.sql, por ejemplo
+// TOURNAMENTS_TEST_DATABASE="host=localhost port=5432 dbname=tournament_db user=postgres". Sin la variable se omiten.
+class PostgresTransportTest : public ::testing::Test {
+protected:
+    std::string connectionString;
+    std::string queue;
+    std::unique_ptr<pqxx::connection> connection;
+
+    void SetUp() override {
+        const char* database = std::getenv("TOURNAMENTS_TEST_DATABASE");
+        if (database == nullptr) {
+            GTEST_SKIP() << "TOURNAMENTS_TEST_DATABASE no esta definida";
+        }
+        connectionString = database;
+        queue = std::string("test.") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        connection = std::make_unique<pqxx::connection>(connectionString);
+        // la misma sentencia que enqueue_message del productor
+        connection->prepare("enqueue_message", R"(
+            with enqueued as (insert into message_queue (queue, body) values ($1, $2))
+            select pg_notify('message_queue', $1)
+        )");
+        clear();
+    }
+
+    void TearDown() override {
+        if (connection) {
+            clear();
+        }
+    }
+
+    void clear() {
+        pqxx::work tx(*connection);
+        tx.exec("delete from message_queue where queue = $1", pqxx::params{queue});
+        tx.commit();
+    }
+
+    void enqueue(const std::string& body, const std::string& target) {
+        pqxx::work tx(*connection);
+        tx.exec(pqxx::prepped{"enqueue_message"}, pqxx::params{target, body});
+        tx.commit();
+    }
+
+    void enqueue(const std::string& body) {
+        enqueue(body, queue);
+    }
+
+    int rows() {
+        pqxx::read_transaction tx(*connection);
+        return tx.query_value<int>("select count(*) from message_queue where queue = $1", pqxx::params{queue});
+    }
+
+    int deliveries(const std::string& body) {
+        pqxx::read_transaction tx(*connection);
+        return tx.query_value<int>("select deliveries from message_queue where queue = $1 and body = $2", pqxx::params{queue, body});
+    }
+};
+
+TEST_F(PostgresTransportTest, Receive_ClaimsInIdOrderAndDeletesOnAcknowledge) {
+    enqueue("a");
+    enqueue("b");
+    enqueue("c");
+    PostgresTransport transport(connectionString, 2, 10);
+    const auto receiver = transport.Open(queue);
+
+    // Validar que los mensajes llegan en orden de id, tambien a traves de dos claims
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "a");
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "b");
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "c");
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), std::nullopt);
+    // Validar que el claim no borra: solo el acknowledge lo hace, del mas antiguo al mas nuevo
+    EXPECT_EQ(rows(), 3);
+    receiver->Acknowledge();
+    receiver->Acknowledge();
+    EXPECT_EQ(rows(), 1);
+    EXPECT_EQ(deliveries("c"), 1);
+    receiver->Close();
+}
+
+TEST_F(PostgresTransportTest, Close_RedeliversUnacknowledgedInOrder) {
+    enqueue("a");
+    enqueue("b");
+    enqueue("c");
+    PostgresTransport transport(connectionString, 10, 10);
+    auto receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "a");
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "b");
+    receiver->Acknowledge();
+    receiver->Close();
+
+    // Validar que lo no confirmado, reclamado o ya entregado, vuelve a llegar y en orden
+    receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "b");
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "c");
+    EXPECT_EQ(deliveries("b"), 2);
+    EXPECT_EQ(rows(), 2);
+    receiver->Close();
+}
+
+TEST_F(PostgresTransportTest, Receive_SecondReceiverWaitsForTheOwner) {
+    enqueue("a");
+    enqueue("b");
+    PostgresTransport transport(connectionString, 10, 10);
+    const auto first = transport.Open(queue);
+    const auto second = transport.Open(queue);
+    EXPECT_EQ(first->Receive(std::chrono::milliseconds(100)), "a");
+
+    // Validar que un segundo consumidor no adelanta mensajes de la cola mientras otro la tiene
+    EXPECT_EQ(second->Receive(std::chrono::milliseconds(50)), std::nullopt);
+    EXPECT_EQ(deliveries("b"), 0);
+
+    // Validar que al cerrar el primero la cola pasa al segundo desde el mensaje no confirmado
+    first->Close();
+    EXPECT_EQ(second->Receive(std::chrono::milliseconds(100)), "a");
+    EXPECT_EQ(second->Receive(std::chrono::milliseconds(100)), "b");
+    second->Close();
+}
+
+TEST_F(PostgresTransportTest, Receive_WakesOnNotifyOfItsQueue) {
+    PostgresTransport transport(connectionString, 10, 10);
+    const auto receiver = transport.Open(queue);
+    // el primer Receive conecta, escucha y toma la cola
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(10)), std::nullopt);
+
+    const auto started = std::chrono::steady_clock::now();
+    auto received = std::async(std::launch::async, [&receiver] { return receiver->Receive(std::chrono::seconds(10)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    enqueue("other", "test.another.queue");
+    enqueue("a");
+
+    // Validar que el NOTIFY despierta al receptor antes del timeout y que el de otra cola no lo confunde
+    EXPECT_EQ(received.get(), "a");
+    EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::seconds(5));
+    receiver->Close();
+
+    pqxx::work tx(*connection);
+    tx.exec("delete from message_queue where queue = 'test.another.queue'");
+    tx.commit();
+}
+
+TEST_F(PostgresTransportTest, Receive_DropsMessagePastMaxDeliveries) {
+    enqueue("poison");
+    enqueue("b");
+    PostgresTransport transport(connectionString, 1, 2);
+    auto receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "poison");
+    receiver->Close();
+    receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "poison");
+    receiver->Close();
+
+    // Validar que la tercera entrega lo descarta y la cola sigue con el siguiente
+    receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "b");
+    EXPECT_EQ(rows(), 1);
+    receiver->Close();
+}
+
+TEST_F(PostgresTransportTest, Receive_FailingHeadDoesNotChargeTheRowsBehindIt) {
+    enqueue("poison");
+    enqueue("b");
+    enqueue("c");
+    enqueue("d");
+    PostgresTransport transport(connectionString, 10, 2);
+    // como el listener: el mensaje falla, el receptor se cierra sin confirmar y se vuelve a abrir
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        const auto receiver = transport.Open(queue);
+        EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "poison");
+        receiver->Close();
+    }
+
+    // Validar que solo se descarta el mensaje que fallo y los demas siguen sin entregas contadas
+    const auto receiver = transport.Open(queue);
+    EXPECT_EQ(receiver->Receive(std::chrono::milliseconds(100)), "b");
+    EXPECT_EQ(rows(), 3);
+    EXPECT_EQ(deliveries("b"), 1);
+    EXPECT_EQ(deliveries("c"), 0);
+    EXPECT_EQ(deliveries("d"), 0);
+    receiver->Close();
+}
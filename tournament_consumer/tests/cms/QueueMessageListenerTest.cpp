@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cms/QueueMessageListener.hpp"
+
+// Pool de prueba sin espera de checkout
+class IdleConnectionProvider : public IDbConnectionProvider {
+public:
+    using IDbConnectionProvider::Connection;
+
+    PooledConnection Connection() override {
+        return PooledConnection(nullptr, [](IDbConnection*) {});
+    }
+};
+
+// Transporte de prueba que entrega una lista fija de mensajes y, como el broker, devuelve a la cola
+// lo que no se confirmo al cerrar el receptor
+class FakeTransport : public IMessageTransport {
+public:
+    std::deque<std::string> messages;
+    std::vector<std::string> acknowledged;
+    std::string opened;
+    int opens = 0;
+    int failingOpens = 0;
+    bool closed = false;
+
+    class Receiver : public IMessageReceiver {
+        FakeTransport& transport;
+        std::deque<std::string> unacknowledged;
+    public:
+        explicit Receiver(FakeTransport& transport) : transport(transport) {}
+
+        std::optional<std::string> Receive(std::chrono::milliseconds) override {
+            if (transport.messages.empty()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                return std::nullopt;
+            }
+            auto message = transport.messages.front();
+            transport.messages.pop_front();
+            unacknowledged.push_back(message);
+            return message;
+        }
+
+        void Acknowledge() override {
+            transport.acknowledged.push_back(unacknowledged.front());
+            unacknowledged.pop_front();
+        }
+
+        void Close() override {
+            transport.messages.insert(transport.messages.begin(), unacknowledged.begin(), unacknowledged.end());
+            transport.closed = true;
+        }
+    };
+
+    std::unique_ptr<IMessageReceiver> Open(std::string_view queue) override {
+        ++opens;
+        if (failingOpens > 0) {
+            --failingOpens;
+            throw std::runtime_error("broker unavailable");
+        }
+        opened = queue;
+        return std::make_unique<Receiver>(*this);
+    }
+};
+
+class RecordingListener : public QueueMessageListener {
+    void processMessage(const std::string& message) override {
+        std::lock_guard lock(mutex);
+        processed.push_back(message);
+        if (message == failOnce) {
+            failOnce.clear();
+            throw std::runtime_error("database unavailable");
+        }
+    }
+public:
+    std::mutex mutex;
+    std::vector<std::string> processed;
+    std::string failOnce;
+
+    using QueueMessageListener::QueueMessageListener;
+
+    size_t Processed() {
+        std::lock_guard lock(mutex);
+        return processed.size();
+    }
+};
+
+class QueueMessageListenerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<FakeTransport> transport = std::make_shared<FakeTransport>();
+    RecordingListener listener{transport, std::make_shared<Backpressure>(std::make_shared<IdleConnectionProvider>())};
+
+    // Consume hasta procesar `count` mensajes y detiene el listener
+    void ConsumeUntil(size_t count) {
+        std::thread receiving([this] { listener.Start("tournament.team-add"); });
+        const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (listener.Processed() < count && std::chrono::steady_clock::now() < until) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        // la confirmacion llega en la siguiente vuelta del receptor
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        listener.Stop();
+        receiving.join();
+    }
+};
+
+// Validar que los mensajes del transporte se procesan en orden, se confirman y que el receptor se cierra al detener
+TEST_F(QueueMessageListenerTest, ProcessesInOrder_AcknowledgesAndClosesOnStop) {
+    transport->messages = {"first", "second", "third"};
+
+    ConsumeUntil(3);
+
+    EXPECT_EQ(transport->opened, "tournament.team-add");
+    EXPECT_EQ(listener.processed, (std::vector<std::string>{"first", "second", "third"}));
+    EXPECT_EQ(transport->acknowledged, (std::vector<std::string>{"first", "second", "third"}));
+    EXPECT_TRUE(transport->closed);
+}
+
+// Validar que un mensaje fallido no se confirma y se vuelve a entregar antes que los siguientes
+TEST_F(QueueMessageListenerTest, FailedMessage_RedeliveredInOrder) {
+    transport->messages = {"first", "second", "third"};
+    listener.failOnce = "second";
+
+    ConsumeUntil(4);
+
+    EXPECT_EQ(listener.processed, (std::vector<std::string>{"first", "second", "second", "third"}));
+    EXPECT_EQ(transport->acknowledged, (std::vector<std::string>{"first", "second", "third"}));
+    EXPECT_EQ(transport->opens, 2);
+}
+
+// Validar que si abrir el receptor falla el listener lo reintenta en lugar de quedarse detenido
+TEST_F(QueueMessageListenerTest, OpenFails_Reopens) {
+    transport->messages = {"first"};
+    transport->failingOpens = 1;
+
+    ConsumeUntil(1);
+
+    EXPECT_EQ(listener.processed, (std::vector<std::string>{"first"}));
+    EXPECT_EQ(transport->opens, 2);
+}
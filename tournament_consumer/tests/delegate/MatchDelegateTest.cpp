@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "delegate/MatchDelegate.hpp"
+#include "domain/Match.hpp"
+#include "event/ScoreUpdateEvent.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+
+class ConsumerMatchRepository : public IMatchRepository {
+public:
+    MOCK_METHOD(std::vector<domain::Match>, FindByTournamentId, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndMatchId, (const std::string_view& tournamentId, const std::string_view& matchId), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndName, (const std::string_view& tournamentId, const std::string_view& name), (override));
+    MOCK_METHOD(void, UpdateMatchScore, (const std::string_view& matchId, const domain::Score& score), (override));
+    MOCK_METHOD(void, Update, (const std::string_view& matchId, const domain::Match& match, Durability durability), (override));
+    MOCK_METHOD(bool, AdvanceTeam, (const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId, Durability durability),
+                (override));
+    MOCK_METHOD(std::vector<std::string>, CreateBulk, (const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateBracket, (const std::string_view& tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateGroupMatches,
+                (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(void, UpdateSchedules, (const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<domain::Schedule>, FindVenueBookings, (const std::string_view& tournamentId, int64_t from), (override));
+    MOCK_METHOD(bool, MatchesExistForTournament, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(bool, MatchesExistForGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
+    MOCK_METHOD(std::vector<std::string>, StartKnockoutStage,
+                (const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket), (override));
+};
+
+class ConsumerTournamentRepository : public IRepository<domain::Tournament, std::string> {
+public:
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
+};
+
+class ConsumerMatchDelegateTest : public ::testing::Test {
+protected:
+    std::shared_ptr<testing::NiceMock<ConsumerMatchRepository>> matchRepository = std::make_shared<testing::NiceMock<ConsumerMatchRepository>>();
+    std::shared_ptr<MatchDelegate> matchDelegate;
+
+    void SetUp() override {
+        // sin sedes no se reprograma nada
+        matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ConsumerTournamentRepository>(),
+                                                        std::make_shared<SchedulerConfiguration>());
+    }
+
+    static std::shared_ptr<domain::Match> Match(const std::string& id, const std::string& name, const std::string& home, const std::string& visitor) {
+        auto match = std::make_shared<domain::Match>();
+        match->Id() = id;
+        match->TournamentId() = "tournament-1";
+        match->Name() = name;
+        match->HomeTeamId() = home;
+        match->VisitorTeamId() = visitor;
+        return match;
+    }
+};
+
+// Validar que avanzar a un equipo escribe con durabilidad RECOMPUTABLE, el Reconciler puede rehacerlo
+TEST_F(ConsumerMatchDelegateTest, AdvanceTeam_IsRecomputable) {
+    ON_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, std::string_view("match-w0")))
+        .WillByDefault(testing::Return(Match("match-w0", "W0", "team-a", "team-b")));
+
+    EXPECT_CALL(*matchRepository, AdvanceTeam(std::string_view("tournament-1"), std::string_view("W16"), std::string_view("team-a"), Durability::RECOMPUTABLE))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*matchRepository, AdvanceTeam(std::string_view("tournament-1"), std::string_view("L0"), std::string_view("team-b"), Durability::RECOMPUTABLE))
+        .WillOnce(testing::Return(true));
+    // el equipo se asigna con una sola sentencia condicional, nunca leyendo y reescribiendo el partido
+    EXPECT_CALL(*matchRepository, Update(testing::_, testing::_, testing::_)).Times(0);
+
+    domain::ScoreUpdateEvent event;
+    event.tournamentId = "tournament-1";
+    event.matchId = "match-w0";
+    event.homeTeamScore = 2;
+    event.visitorTeamScore = 1;
+    matchDelegate->ProcessScoreUpdate(event);
+}
+
+class ConsumerMatchDelegateOverrunTest : public ConsumerMatchDelegateTest {
+protected:
+    // 2026-10-19 10:00:00 UTC
+    static constexpr int64_t START = 1792368000 + 10 * 3600;
+
+    void SetUp() override {
+        auto configuration = std::make_shared<SchedulerConfiguration>();
+        configuration->venues = {{"Court 1"}};
+        matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ConsumerTournamentRepository>(), configuration);
+
+        auto first = Match("match-w0", "W0", "team-a", "team-b");
+        first->MatchSchedule() = {"Court 1", START};
+        auto second = Match("match-w1", "W1", "team-c", "team-d");
+        second->MatchSchedule() = {"Court 1", START + 3600};
+        ON_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, std::string_view("match-w0"))).WillByDefault(testing::Return(first));
+        ON_CALL(*matchRepository, FindByTournamentId(testing::_)).WillByDefault(testing::Return(std::vector{*first, *second}));
+    }
+
+    static domain::ScoreUpdateEvent Event() {
+        domain::ScoreUpdateEvent event;
+        event.tournamentId = "tournament-1";
+        event.matchId = "match-w0";
+        event.homeTeamScore = 2;
+        event.visitorTeamScore = 1;
+        return event;
+    }
+};
+
+// Validar que el fin del partido es la hora registrada del resultado, no la hora de procesamiento
+TEST_F(ConsumerMatchDelegateOverrunTest, Overrun_UsesScoredAt) {
+    std::vector<domain::Match> moved;
+    EXPECT_CALL(*matchRepository, UpdateSchedules(testing::_)).WillOnce(testing::SaveArg<0>(&moved));
+
+    auto event = Event();
+    event.scoredAt = START + 150 * 60;
+    matchDelegate->ProcessScoreUpdate(event);
+
+    ASSERT_EQ(moved.size(), 1);
+    EXPECT_EQ(moved[0].Id(), "match-w1");
+    EXPECT_GE(moved[0].MatchSchedule().startsAt, START + 3 * 3600);
+}
+
+// Validar que un resultado sin hora registrada no reprograma
+TEST_F(ConsumerMatchDelegateOverrunTest, Overrun_SkippedWithoutScoredAt) {
+    EXPECT_CALL(*matchRepository, UpdateSchedules(testing::_)).Times(0);
+
+    matchDelegate->ProcessScoreUpdate(Event());
+}
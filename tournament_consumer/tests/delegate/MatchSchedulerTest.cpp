@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "delegate/BracketGenerator.hpp"
+#include "delegate/MatchScheduler.hpp"
+#include "domain/Match.hpp"
+#include "domain/Team.hpp"
+
+using namespace std::chrono_literals;
+
+class MatchSchedulerTest : public ::testing::Test {
+protected:
+    BracketGenerator generator;
+    SchedulerConfiguration configuration;
+    // 2026-10-19 00:00:00 UTC
+    MatchScheduler::Clock::time_point origin{std::chrono::seconds(1792368000)};
+
+    void SetUp() override {
+        configuration.venues = {{"Court 1", 9h, 21h}, {"Court 2", 9h, 21h}};
+        configuration.slot = 60min;
+        configuration.rest = 60min;
+    }
+
+    std::vector<domain::Match> Groups(int groups, int teamsPerGroup) {
+        std::vector<domain::Match> matches;
+        for (int group = 0; group < groups; ++group) {
+            std::vector<domain::Team> teams;
+            for (int i = 0; i < teamsPerGroup; ++i) {
+                domain::Team team;
+                team.Id = "team-" + std::to_string(group) + "-" + std::to_string(i);
+                teams.push_back(team);
+            }
+            auto generated = generator.GenerateGroupStage("tournament", "group-" + std::to_string(group), teams);
+            matches.insert(matches.end(), generated.begin(), generated.end());
+        }
+        return matches;
+    }
+
+    static std::vector<domain::Schedule> Schedules(const MatchScheduler& scheduler, size_t count) {
+        std::vector<domain::Schedule> schedules;
+        for (size_t match = 0; match < count; ++match) {
+            schedules.push_back(scheduler.ScheduleOf(match));
+        }
+        return schedules;
+    }
+
+    // Validar restricciones: una cancha un partido a la vez, dentro de su horario y descanso de cada equipo
+    void ExpectValid(const std::vector<domain::Match>& matches, const std::vector<domain::Schedule>& schedules) {
+        const int64_t slot = std::chrono::duration_cast<std::chrono::seconds>(configuration.slot).count();
+        const int64_t rest = std::chrono::duration_cast<std::chrono::seconds>(configuration.rest).count();
+        std::set<std::pair<std::string, int64_t>> used;
+        std::map<std::string, std::vector<int64_t>> starts;
+        for (size_t match = 0; match < matches.size(); ++match) {
+            const auto& schedule = schedules[match];
+            ASSERT_FALSE(schedule.venue.empty()) << "Match " << match << " should be scheduled";
+            EXPECT_TRUE(used.emplace(schedule.venue, schedule.startsAt).second) << "Venue double booked";
+            const auto timeOfDay = schedule.startsAt % 86400;
+            EXPECT_GE(timeOfDay, 9 * 3600);
+            EXPECT_LE(timeOfDay + slot, 21 * 3600);
+            for (const auto& team : {matches[match].HomeTeamId(), matches[match].VisitorTeamId()}) {
+                starts[team].push_back(schedule.startsAt);
+            }
+        }
+        for (auto& [team, times] : starts) {
+            std::ranges::sort(times);
+            for (size_t i = 1; i < times.size(); ++i) {
+                EXPECT_GE(times[i] - times[i - 1], slot + rest) << "Team " << team << " does not rest";
+            }
+        }
+    }
+};
+
+TEST_F(MatchSchedulerTest, SchedulesGroupStageWithinConstraints) {
+    auto matches = Groups(4, 4);
+    MatchScheduler scheduler(configuration, origin, matches, {});
+
+    scheduler.Solve(origin);
+
+    ExpectValid(matches, Schedules(scheduler, matches.size()));
+}
+
+TEST_F(MatchSchedulerTest, DependentMatchStartsAfterFeedersAndRest) {
+    std::vector<domain::Match> matches(3);
+    matches[0].HomeTeamId() = "a";
+    matches[0].VisitorTeamId() = "b";
+    matches[1].HomeTeamId() = "c";
+    matches[1].VisitorTeamId() = "d";
+    MatchScheduler scheduler(configuration, origin, matches, {{0, 2}, {1, 2}});
+
+    scheduler.Solve(origin);
+
+    const auto final = scheduler.ScheduleOf(2);
+    for (size_t feeder : {0, 1}) {
+        EXPECT_GE(final.startsAt, scheduler.ScheduleOf(feeder).startsAt + 2 * 3600);
+    }
+}
+
+TEST_F(MatchSchedulerTest, KeepsMatchesAlreadyScheduled) {
+    auto matches = Groups(1, 4);
+    matches[0].MatchSchedule() = {"Court 2", 1792368000 + 15 * 3600};
+    MatchScheduler scheduler(configuration, origin, matches, {});
+
+    scheduler.Solve(origin);
+
+    EXPECT_EQ(scheduler.ScheduleOf(0).venue, "Court 2");
+    EXPECT_EQ(scheduler.ScheduleOf(0).startsAt, 1792368000 + 15 * 3600);
+    ExpectValid(matches, Schedules(scheduler, matches.size()));
+}
+
+TEST_F(MatchSchedulerTest, ThousandsOfMatchesWellUnderASecond) {
+    configuration.venues = {{"Court 1"}, {"Court 2"}, {"Court 3"}, {"Court 4"}, {"Court 5"}, {"Court 6"}, {"Court 7"}, {"Court 8"}};
+    for (auto& venue : configuration.venues) {
+        venue.opens = 9h;
+        venue.closes = 21h;
+    }
+    auto matches = Groups(64, 8);
+    ASSERT_EQ(matches.size(), 64 * 28);
+
+    const auto started = std::chrono::steady_clock::now();
+    MatchScheduler scheduler(configuration, origin, matches, {});
+    scheduler.Solve(origin);
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+
+    EXPECT_LT(elapsed, 1s);
+    ExpectValid(matches, Schedules(scheduler, matches.size()));
+}
+
+TEST_F(MatchSchedulerTest, OverrunMovesOnlyConflictingMatches) {
+    auto matches = Groups(4, 4);
+    MatchScheduler scheduler(configuration, origin, matches, {});
+    scheduler.Solve(origin);
+    const auto before = Schedules(scheduler, matches.size());
+
+    // el primer partido termina 90 minutos despues de su fin previsto
+    const auto finishedAt = MatchScheduler::Clock::time_point(std::chrono::seconds(before[0].startsAt)) + 150min;
+    const auto moved = scheduler.Overrun(0, finishedAt);
+    const auto after = Schedules(scheduler, matches.size());
+
+    EXPECT_FALSE(moved.empty());
+    EXPECT_LT(moved.size(), matches.size());
+    size_t changed = 0;
+    for (size_t match = 0; match < matches.size(); ++match) {
+        if (before[match].startsAt != after[match].startsAt || before[match].venue != after[match].venue) {
+            ++changed;
+            EXPECT_GE(after[match].startsAt, before[0].startsAt + 3 * 3600) << "Moved matches start after the overrun";
+        }
+    }
+    EXPECT_EQ(changed, moved.size());
+    for (size_t match = 1; match < matches.size(); ++match) {
+        if (after[match].venue == after[0].venue) {
+            EXPECT_TRUE(after[match].startsAt < before[0].startsAt || after[match].startsAt >= before[0].startsAt + 3 * 3600);
+        }
+    }
+}
+
+TEST_F(MatchSchedulerTest, OverrunWithinSlotMovesNothing) {
+    auto matches = Groups(2, 4);
+    MatchScheduler scheduler(configuration, origin, matches, {});
+    scheduler.Solve(origin);
+
+    const auto finishedAt = MatchScheduler::Clock::time_point(std::chrono::seconds(scheduler.ScheduleOf(0).startsAt)) + 55min;
+
+    EXPECT_TRUE(scheduler.Overrun(0, finishedAt).empty());
+}
+
+// Validar que las canchas reservadas por otro torneo no se asignan
+TEST_F(MatchSchedulerTest, SkipsVenuesBookedByOtherTournaments) {
+    auto matches = Groups(2, 4);
+    std::vector<domain::Schedule> booked;
+    // otro torneo ocupa la Cancha 1 todo el primer dia, con su grilla corrida media hora
+    for (int hour = 9; hour < 21; ++hour) {
+        booked.push_back({"Court 1", 1792368000 + hour * 3600 - 1800});
+    }
+    MatchScheduler scheduler(configuration, origin, matches, {}, booked);
+
+    scheduler.Solve(origin);
+
+    const auto schedules = Schedules(scheduler, matches.size());
+    ExpectValid(matches, schedules);
+    for (const auto& schedule : schedules) {
+        if (schedule.venue == "Court 1") {
+            EXPECT_GE(schedule.startsAt, 1792368000 + 21 * 3600);
+        }
+    }
+}
+
+// Validar que una grilla cuyos inicios nunca caen dentro del horario de una cancha se rechaza en vez de buscar sin fin
+TEST_F(MatchSchedulerTest, RejectsGridThatNeverFitsAVenueWindow) {
+    configuration.slot = 45min;
+    configuration.venues = {{"Court 1", 9h, 9h + 45min}};
+    const auto matches = Groups(1, 4);
+
+    // desde las 10:00 los partidos de 45 minutos empiezan a las 9:15, nunca a las 9:00
+    EXPECT_THROW(MatchScheduler(configuration, origin + 10h, matches, {}), std::invalid_argument);
+
+    // desde las 0:00 la grilla pasa por las 9:00
+    MatchScheduler scheduler(configuration, origin, matches, {});
+    scheduler.Solve(origin);
+    for (const auto& schedule : Schedules(scheduler, matches.size())) {
+        EXPECT_EQ(schedule.startsAt % 86400, 9 * 3600);
+    }
+}
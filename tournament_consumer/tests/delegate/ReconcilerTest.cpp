@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "delegate/MatchDelegate.hpp"
+#include "delegate/Reconciler.hpp"
+#include "domain/Match.hpp"
+#include "persistence/repository/IMatchRepository.hpp"
+#include "persistence/repository/IReconciliationRepository.hpp"
+
+using namespace std::chrono_literals;
+
+class MockReconciliationRepository : public IReconciliationRepository {
+public:
+    MOCK_METHOD(std::vector<StalledGroup>, FindStalledGroups,
+                (Clock::time_point since, Clock::time_point until, size_t limit, const ScanPosition& after), (override));
+    MOCK_METHOD(std::vector<StalledResult>, FindUnadvancedResults,
+                (Clock::time_point since, Clock::time_point until, size_t limit, const Successors& successors, const ScanPosition& after), (override));
+};
+
+class ReconcilerMatchRepository : public IMatchRepository {
+public:
+    MOCK_METHOD(std::vector<domain::Match>, FindByTournamentId, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndMatchId, (const std::string_view& tournamentId, const std::string_view& matchId), (override));
+    MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndName, (const std::string_view& tournamentId, const std::string_view& name), (override));
+    MOCK_METHOD(void, UpdateMatchScore, (const std::string_view& matchId, const domain::Score& score), (override));
+    MOCK_METHOD(void, Update, (const std::string_view& matchId, const domain::Match& match, Durability durability), (override));
+    MOCK_METHOD(bool, AdvanceTeam, (const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId, Durability durability),
+                (override));
+    MOCK_METHOD(std::vector<std::string>, CreateBulk, (const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateBracket, (const std::string_view& tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateGroupMatches,
+                (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(void, UpdateSchedules, (const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<domain::Schedule>, FindVenueBookings, (const std::string_view& tournamentId, int64_t from), (override));
+    MOCK_METHOD(bool, MatchesExistForTournament, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(bool, MatchesExistForGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
+    MOCK_METHOD(std::vector<std::string>, StartKnockoutStage,
+                (const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket), (override));
+};
+
+class ReconcilerTournamentRepository : public IRepository<domain::Tournament, std::string> {
+public:
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
+};
+
+class ReconcilerTest : public ::testing::Test {
+protected:
+    std::shared_ptr<testing::NiceMock<MockReconciliationRepository>> reconciliationRepository = std::make_shared<testing::NiceMock<MockReconciliationRepository>>();
+    std::shared_ptr<testing::NiceMock<ReconcilerMatchRepository>> matchRepository = std::make_shared<testing::NiceMock<ReconcilerMatchRepository>>();
+    std::shared_ptr<Reconciler> reconciler;
+    const IReconciliationRepository::Clock::time_point until = IReconciliationRepository::Clock::now();
+    const IReconciliationRepository::Clock::time_point since = until - 1h;
+
+    void SetUp() override {
+        // sin sedes no se reprograma nada y el repositorio de grupos no se usa para resultados
+        auto matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ReconcilerTournamentRepository>(),
+                                                             std::make_shared<SchedulerConfiguration>());
+        reconciler = std::make_shared<Reconciler>(reconciliationRepository, matchDelegate, std::make_shared<ReconciliationConfiguration>());
+        ON_CALL(*reconciliationRepository, FindStalledGroups(testing::_, testing::_, testing::_, testing::_))
+            .WillByDefault(testing::Return(std::vector<StalledGroup>{}));
+    }
+
+    static std::shared_ptr<domain::Match> Match(const std::string& id, const std::string& name, const std::string& home, const std::string& visitor) {
+        auto match = std::make_shared<domain::Match>();
+        match->Id() = id;
+        match->TournamentId() = "tournament-1";
+        match->Name() = name;
+        match->HomeTeamId() = home;
+        match->VisitorTeamId() = visitor;
+        return match;
+    }
+};
+
+// Validar que un resultado sin avanzar se repare: ganador a W16 y perdedor a L0
+TEST_F(ReconcilerTest, UnadvancedResult_AdvancesWinnerAndLoser) {
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(since, until, 100, testing::_, testing::_))
+        .WillOnce(testing::Return(std::vector<StalledResult>{{"tournament-1", "match-w0", {2, 1}}}));
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(std::string_view("tournament-1"), std::string_view("match-w0")))
+        .WillOnce(testing::Return(Match("match-w0", "W0", "team-a", "team-b")));
+
+    EXPECT_CALL(*matchRepository, AdvanceTeam(std::string_view("tournament-1"), std::string_view("W16"), std::string_view("team-a"), testing::_))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*matchRepository, AdvanceTeam(std::string_view("tournament-1"), std::string_view("L0"), std::string_view("team-b"), testing::_))
+        .WillOnce(testing::Return(true));
+
+    EXPECT_TRUE(reconciler->Reconcile(since, until));
+}
+
+// Validar que repetir un resultado ya aplicado no escriba nada mas: la sentencia condicional no asigna
+TEST_F(ReconcilerTest, ReplayedResult_IsIdempotent) {
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(std::vector<StalledResult>{{"tournament-1", "match-w0", {2, 1}}}));
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, testing::_))
+        .WillOnce(testing::Return(Match("match-w0", "W0", "team-a", "team-b")));
+    EXPECT_CALL(*matchRepository, AdvanceTeam(testing::_, testing::_, testing::_, testing::_)).Times(2).WillRepeatedly(testing::Return(false));
+
+    EXPECT_CALL(*matchRepository, Update(testing::_, testing::_, testing::_)).Times(0);
+    EXPECT_CALL(*matchRepository, UpdateSchedules(testing::_)).Times(0);
+
+    EXPECT_TRUE(reconciler->Reconcile(since, until));
+}
+
+// Validar que una reparacion no se tome como partido extendido aunque llegue mucho despues de su horario
+TEST_F(ReconcilerTest, ReplayedResult_DoesNotReschedule) {
+    auto configuration = std::make_shared<SchedulerConfiguration>();
+    configuration->venues = {{"Court 1"}};
+    auto matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ReconcilerTournamentRepository>(), configuration);
+    reconciler = std::make_shared<Reconciler>(reconciliationRepository, matchDelegate, std::make_shared<ReconciliationConfiguration>());
+
+    auto played = Match("match-w0", "W0", "team-a", "team-b");
+    // termino de jugarse hace dos horas, dentro de maxOverrun si la reparacion contara como hora de fin
+    played->MatchSchedule() = {"Court 1", std::chrono::duration_cast<std::chrono::seconds>((until - 3h).time_since_epoch()).count()};
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(std::vector<StalledResult>{{"tournament-1", "match-w0", {2, 1}}}));
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, testing::_)).WillOnce(testing::Return(played));
+
+    EXPECT_CALL(*matchRepository, FindByTournamentId(testing::_)).Times(0);
+    EXPECT_CALL(*matchRepository, UpdateSchedules(testing::_)).Times(0);
+
+    EXPECT_TRUE(reconciler->Reconcile(since, until));
+}
+
+// Validar que una fila que la reparacion no arregla no impida llegar a las siguientes: se pagina por posicion
+TEST_F(ReconcilerTest, UnfixedRows_DoNotHideTheRest) {
+    auto configuration = std::make_shared<ReconciliationConfiguration>();
+    configuration->batchSize = 1;
+    auto matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ReconcilerTournamentRepository>(),
+                                                         std::make_shared<SchedulerConfiguration>());
+    reconciler = std::make_shared<Reconciler>(reconciliationRepository, matchDelegate, configuration);
+
+    const StalledResult unfixable{"tournament-1", "match-w0", {2, 1}, {"2026-10-18 10:00:00", "id-1"}};
+    const StalledResult fixable{"tournament-1", "match-w1", {2, 1}, {"2026-10-18 10:00:01", "id-2"}};
+    const auto after = [](const std::string& id) { return testing::Field(&ScanPosition::id, id); };
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, 1, testing::_, after("")))
+        .WillOnce(testing::Return(std::vector{unfixable}));
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, 1, testing::_, after("id-1")))
+        .WillOnce(testing::Return(std::vector{fixable}));
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, 1, testing::_, after("id-2")))
+        .WillOnce(testing::Return(std::vector<StalledResult>{}));
+    // el primero no tiene sus equipos cargados, asi que la reparacion no lo arregla
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, std::string_view("match-w0")))
+        .WillOnce(testing::Return(Match("match-w0", "W0", "", "")));
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, std::string_view("match-w1")))
+        .WillOnce(testing::Return(Match("match-w1", "W1", "team-c", "team-d")));
+
+    EXPECT_CALL(*matchRepository, AdvanceTeam(testing::_, std::string_view("W16"), std::string_view("team-c"), testing::_)).WillOnce(testing::Return(true));
+    EXPECT_CALL(*matchRepository, AdvanceTeam(testing::_, std::string_view("L0"), std::string_view("team-d"), testing::_)).WillOnce(testing::Return(true));
+
+    EXPECT_TRUE(reconciler->Reconcile(since, until));
+}
+
+// Validar que una reparacion fallida deje la ventana pendiente para el siguiente escaneo
+TEST_F(ReconcilerTest, FailedRepair_KeepsWindow) {
+    EXPECT_CALL(*reconciliationRepository, FindUnadvancedResults(testing::_, testing::_, testing::_, testing::_, testing::_))
+        .WillOnce(testing::Return(std::vector<StalledResult>{{"tournament-1", "match-w0", {2, 1}}}));
+    EXPECT_CALL(*matchRepository, FindByTournamentIdAndMatchId(testing::_, testing::_))
+        .WillOnce(testing::Throw(std::runtime_error("connection lost")));
+
+    EXPECT_FALSE(reconciler->Reconcile(since, until));
+}
+
+// Validar que los sucesores cubran las llaves de ganadores y perdedores
+TEST_F(ReconcilerTest, KnockoutSuccessors_CoverBracket) {
+    auto matchDelegate = std::make_shared<MatchDelegate>(matchRepository, nullptr, std::make_shared<ReconcilerTournamentRepository>(),
+                                                         std::make_shared<SchedulerConfiguration>());
+    const auto successors = matchDelegate->KnockoutSuccessors();
+
+    EXPECT_EQ(successors.size(), 61);
+    EXPECT_EQ(successors.at("W0"), std::make_pair(std::string("W16"), std::string("L0")));
+    EXPECT_EQ(successors.at("W30"), std::make_pair(std::string("F0"), std::string("L22")));
+    EXPECT_EQ(successors.at("L29"), std::make_pair(std::string("F0"), std::string("")));
+}
@@ -0,0 +1,43 @@
+//
+// Bulk loader, streams an NDJSON file (or stdin) through ImportRepository
+// usage: tournament_import [file.ndjson]
+//
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <print>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/repository/ImportRepository.hpp"
+
+int main(int argc, char* argv[]) {
+    std::ifstream configurationFile("configuration.json");
+    nlohmann::json configuration;
+    configurationFile >> configuration;
+
+    std::ifstream inputFile;
+    if (argc > 1) {
+        inputFile.open(argv[1]);
+        if (!inputFile) {
+            std::println(stderr, "cannot open {}", argv[1]);
+            return 1;
+        }
+    }
+    std::istream& input = argc > 1 ? static_cast<std::istream&>(inputFile) : std::cin;
+
+    auto connectionProvider = std::make_shared<PostgresConnectionProvider>(configuration["databaseConfig"]["connectionString"].get<std::string>(), 1);
+    ImportRepository importRepository(connectionProvider);
+
+    try {
+        const auto summary = importRepository.Import([&input](std::string& line) {
+            return static_cast<bool>(std::getline(input, line));
+        });
+        std::println("{}", nlohmann::json(summary).dump(2));
+        return summary.rejected == 0 ? 0 : 2;
+    } catch (const std::exception& e) {
+        std::println(stderr, "import failed: {}", e.what());
+        return 1;
+    }
+}
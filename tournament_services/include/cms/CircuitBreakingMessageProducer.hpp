@@ -0,0 +1,24 @@
+#ifndef SERVICE_CIRCUIT_BREAKING_MESSAGE_PRODUCER_HPP
+#define SERVICE_CIRCUIT_BREAKING_MESSAGE_PRODUCER_HPP
+
+#include <memory>
+#include <string_view>
+
+#include "IQueueMessageProducer.hpp"
+#include "resilience/CircuitBreaker.hpp"
+
+// While the broker is unreachable sends fail immediately instead of each one blocking on the
+// failover transport until its send timeout
+class CircuitBreakingMessageProducer : public IQueueMessageProducer {
+    std::shared_ptr<IQueueMessageProducer> messageProducer;
+    std::shared_ptr<resilience::CircuitBreaker> circuitBreaker;
+public:
+    CircuitBreakingMessageProducer(std::shared_ptr<IQueueMessageProducer> messageProducer, std::shared_ptr<resilience::CircuitBreaker> circuitBreaker)
+        : messageProducer(std::move(messageProducer)), circuitBreaker(std::move(circuitBreaker)) {}
+
+    void SendMessage(const std::string_view& message, const std::string_view& queue) override {
+        circuitBreaker->Execute([&] { messageProducer->SendMessage(message, queue); });
+    }
+};
+
+#endif /* SERVICE_CIRCUIT_BREAKING_MESSAGE_PRODUCER_HPP */
@@ -0,0 +1,32 @@
+#ifndef SERVICE_POSTGRES_MESSAGE_PRODUCER_HPP
+#define SERVICE_POSTGRES_MESSAGE_PRODUCER_HPP
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <pqxx/pqxx>
+
+#include "IQueueMessageProducer.hpp"
+#include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/configuration/PostgresConnection.hpp"
+#include "persistence/configuration/StatementTimeout.hpp"
+
+// Broker-less producer: the message becomes a MESSAGE_QUEUE row and a NOTIFY, both in one round trip
+// on a pooled write connection. The consumer side is PostgresTransport.
+class PostgresMessageProducer : public IQueueMessageProducer {
+    std::shared_ptr<IDbConnectionProvider> connectionProvider;
+public:
+    explicit PostgresMessageProducer(const std::shared_ptr<IDbConnectionProvider>& connectionProvider) : connectionProvider(connectionProvider) {}
+
+    void SendMessage(const std::string_view& message, const std::string_view& queue) override {
+        auto pooled = connectionProvider->Connection(Workload::WRITE);
+        const auto connection = dynamic_cast<PostgresConnection*>(&*pooled);
+
+        pqxx::work tx(*(connection->connection));
+        ApplyStatementTimeout(tx);
+        connection->Exec(tx, "enqueue_message", std::string(queue), std::string(message));
+        tx.commit();
+    }
+};
+
+#endif //SERVICE_POSTGRES_MESSAGE_PRODUCER_HPP
@@ -6,22 +6,31 @@
 #define RESTAPI_CONTAINER_SETUP_HPP
 
 #include <Hypodermic/Hypodermic.h>
-#include <fstream>
 #include <nlohmann/json.hpp>
 #include <memory>
 
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
 #include "RunConfiguration.hpp"
+#include "configuration/AdminConfiguration.hpp"
+#include "configuration/ConfigurationWatcher.hpp"
+#include "configuration/MessagingConfiguration.hpp"
 #include "cms/ConnectionManager.hpp"
 #include "delegate/TeamDelegate.hpp"
+#include "controller/AdminController.hpp"
 #include "controller/HealthController.hpp"
 #include "controller/TeamController.hpp"
 #include "controller/TournamentController.hpp"
 #include "delegate/TournamentDelegate.hpp"
-#include "persistence/configuration/PostgresConnectionProvider.hpp"
+#include "persistence/configuration/CircuitBreakingConnectionProvider.hpp"
+#include "persistence/configuration/ConnectionProviders.hpp"
+#include "persistence/configuration/SlowQueryLog.hpp"
+#include "persistence/decoder/DocumentDecoders.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/GroupRepository.hpp"
+#include "persistence/repository/TeamDictionary.hpp"
+#include "cms/CircuitBreakingMessageProducer.hpp"
+#include "cms/PostgresMessageProducer.hpp"
 #include "cms/QueueMessageProducer.hpp"
 #include "cms/QueueResolver.hpp"
 #include "delegate/IGroupDelegate.hpp"
@@ -33,21 +42,80 @@
 #include "persistence/repository/IMatchRepository.hpp"
 #include "persistence/repository/MatchRepository.hpp"
 #include "controller/MatchController.hpp"
+#include "persistence/repository/IExportRepository.hpp"
+#include "persistence/repository/ExportRepository.hpp"
+#include "delegate/IExportDelegate.hpp"
+#include "delegate/ExportDelegate.hpp"
+#include "controller/ExportController.hpp"
+#include "persistence/repository/IImportRepository.hpp"
+#include "persistence/repository/ImportRepository.hpp"
+#include "delegate/IImportDelegate.hpp"
+#include "delegate/ImportDelegate.hpp"
+#include "controller/ImportController.hpp"
+#include "configuration/FinishedTournamentCache.hpp"
+#include "configuration/IdempotencyStore.hpp"
+#include "configuration/Warmup.hpp"
+#include "persistence/repository/IIdempotencyRepository.hpp"
+#include "persistence/repository/IdempotencyRepository.hpp"
+#include "resilience/AdmissionController.hpp"
+#include "resilience/CircuitBreakerRegistry.hpp"
 
 namespace config {
     inline std::shared_ptr<Hypodermic::Container> containerSetup() {
         Hypodermic::ContainerBuilder builder;
 
-        std::ifstream file("configuration.json");
-        nlohmann::json configuration;
-        file >> configuration;
+        // Sections subscribed below are applied live when configuration.json changes, the rest needs a restart
+        auto watcher = std::make_shared<ConfigurationWatcher>("configuration.json");
+        builder.registerInstance(watcher);
+        const nlohmann::json configuration = *watcher->Current();
         std::shared_ptr<RunConfiguration> appConfig = std::make_shared<RunConfiguration>(configuration["runConfig"]);
         builder.registerInstance(appConfig);
+        builder.registerInstance(std::make_shared<AdminConfiguration>(
+            configuration.value("admin", nlohmann::json::object()).get<AdminConfiguration>()));
+        const auto workers = static_cast<size_t>(appConfig->concurrency);
+        auto admission = std::make_shared<resilience::AdmissionController>(resilience::FitToWorkers(
+            configuration.value("admission", nlohmann::json::object()).get<resilience::AdmissionConfiguration>(), workers));
+        builder.registerInstance(admission);
+        watcher->Subscribe("/admission", [admission, workers](const nlohmann::json& section) {
+            admission->Reconfigure(resilience::FitToWorkers(section.get<resilience::AdmissionConfiguration>(), workers));
+        });
+        auto routeDeadlines = std::make_shared<RouteDeadlines>();
+        routeDeadlines->Reconfigure(configuration.value("routeDeadlines", nlohmann::json::object()));
+        builder.registerInstance(routeDeadlines);
+        watcher->Subscribe("/routeDeadlines", [routeDeadlines](const nlohmann::json& section) {
+            routeDeadlines->Reconfigure(section);
+        });
 
-        std::shared_ptr<PostgresConnectionProvider> postgressConnection = std::make_shared<PostgresConnectionProvider>(
-            configuration["databaseConfig"]["connectionString"].get<std::string>(),
-            configuration["databaseConfig"]["poolSize"].get<size_t>());
-        builder.registerInstance(postgressConnection).as<IDbConnectionProvider>();
+        auto slowQueries = std::make_shared<SlowQueryLog>(
+            configuration["databaseConfig"].value("slowQueries", nlohmann::json::object()).get<SlowQueryConfiguration>());
+        builder.registerInstance(slowQueries);
+        watcher->Subscribe("/databaseConfig/slowQueries", [slowQueries](const nlohmann::json& section) {
+            slowQueries->Reconfigure(section.get<SlowQueryConfiguration>());
+        });
+        auto circuitBreakers = std::make_shared<resilience::CircuitBreakerRegistry>();
+        builder.registerInstance(circuitBreakers);
+        const auto breakerConfiguration = configuration.value("circuitBreakers", nlohmann::json::object());
+        auto activemqBreaker = circuitBreakers->Create("activemq", breakerConfiguration);
+        watcher->Subscribe("/circuitBreakers", [circuitBreakers](const nlohmann::json& section) {
+            circuitBreakers->Reconfigure(section);
+        });
+
+        // One breaker per pool ("postgres.interactive", "postgres.write", "postgres.bulk"), all configured
+        // from "postgres" unless they have their own entry
+        std::shared_ptr<IDbConnectionProvider> databaseConnection = connectionProvider(configuration["databaseConfig"], slowQueries,
+            [&circuitBreakers, &breakerConfiguration](const std::string& pool, std::shared_ptr<IDbConnectionProvider> provider) {
+                const auto name = pool.empty() ? std::string("postgres") : "postgres." + pool;
+                return std::make_shared<CircuitBreakingConnectionProvider>(std::move(provider), circuitBreakers->Create(name, breakerConfiguration));
+            });
+        builder.registerInstance(databaseConnection).as<IDbConnectionProvider>();
+        for (const auto* bounds : {"/databaseConfig/pools", "/databaseConfig/poolSize"}) {
+            // the watcher owns its listeners, a plain pointer back to it avoids a reference cycle
+            watcher->Subscribe(bounds, [current = watcher.get(), databaseConnection](const nlohmann::json&) {
+                resizePools(*databaseConnection, current->Current()->at("databaseConfig"));
+            });
+        }
+        // Fallback for repositories resolved by their concrete type, the registrations below pick one per repository
+        builder.registerInstance(documentDecoder(configuration["databaseConfig"], "default"));
 
         builder.registerType<ConnectionManager>()
             .onActivated([configuration](Hypodermic::ComponentContext&, const std::shared_ptr<ConnectionManager>& instance) {
@@ -65,15 +133,53 @@ namespace config {
             .singleInstance();
         builder.registerType<QueueResolver>().as<IResolver<IQueueMessageProducer> >().named("queueResolver").
                 singleInstance();
+        builder.registerType<PostgresMessageProducer>().singleInstance();
+        // The delegates publish through the configured transport. The Postgres one writes through
+        // databaseConnection, whose write pool already sits behind its own postgres breaker.
+        const auto messaging = configuration.value("messaging", nlohmann::json::object()).get<MessagingConfiguration>();
+        auto queueProducer = [messaging, activemqBreaker](Hypodermic::ComponentContext& context, const std::string& queue)
+            -> std::shared_ptr<IQueueMessageProducer> {
+            if (messaging.transport == Transport::POSTGRES) {
+                return context.resolve<PostgresMessageProducer>();
+            }
+            return std::make_shared<CircuitBreakingMessageProducer>(context.resolveNamed<QueueMessageProducer>(queue), activemqBreaker);
+        };
+
+        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view> >()
+            .as<INameSearch<domain::Team> >()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "teams");
+            })
+            .singleInstance();
+        builder.registerType<GroupRepository>().as<IGroupRepository>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "groups");
+            })
+            .singleInstance();
 
-        builder.registerType<TeamRepository>().as<IRepository<domain::Team, std::string_view> >().singleInstance();
-        builder.registerType<GroupRepository>().as<IGroupRepository>().singleInstance();
+        auto teamDictionary = std::make_shared<TeamDictionary>(
+            databaseConnection, configuration.value("teamDictionary", nlohmann::json::object()).get<TeamDictionaryConfiguration>());
+        builder.registerInstance(teamDictionary).as<ITeamDictionary>();
+        watcher->Subscribe("/teamDictionary", [teamDictionary](const nlohmann::json& section) {
+            teamDictionary->Reconfigure(section.get<TeamDictionaryConfiguration>());
+        });
+
+        auto finishedTournaments = std::make_shared<FinishedTournamentCache>(
+            configuration.value("finishedTournamentCache", nlohmann::json::object()).get<FinishedTournamentCacheConfiguration>());
+        builder.registerInstance(finishedTournaments);
+        watcher->Subscribe("/finishedTournamentCache", [finishedTournaments](const nlohmann::json& section) {
+            finishedTournaments->Reconfigure(section.get<FinishedTournamentCacheConfiguration>());
+        });
 
         builder.registerType<TeamDelegate>().as<ITeamDelegate>().singleInstance();
         builder.registerType<TeamController>().singleInstance();
 
-        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string> >().
-                singleInstance();
+        builder.registerType<TournamentRepository>().as<IRepository<domain::Tournament, std::string> >()
+            .as<INameSearch<domain::Tournament> >()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "tournaments");
+            })
+            .singleInstance();
 
         builder.registerType<TournamentDelegate>()
                .as<ITournamentDelegate>()
@@ -81,21 +187,54 @@ namespace config {
         builder.registerType<TournamentController>().singleInstance();
 
         builder.registerType<GroupDelegate>().as<IGroupDelegate>()
-            .with<IQueueMessageProducer>([](Hypodermic::ComponentContext& context){
-                return context.resolveNamed<QueueMessageProducer>("tournamentAddTeamQueue");
+            .with<IQueueMessageProducer>([queueProducer](Hypodermic::ComponentContext& context){
+                return queueProducer(context, "tournamentAddTeamQueue");
             })
             .singleInstance();
         builder.registerType<GroupController>().singleInstance();
+        builder.registerInstanceFactory([configuration](Hypodermic::ComponentContext& context) {
+            return std::make_shared<Warmup>(
+                context.resolve<TournamentRepository>(),
+                context.resolve<TournamentController>(),
+                context.resolve<GroupController>(),
+                context.resolve<MatchController>(),
+                configuration.value("warmup", nlohmann::json::object()).get<WarmupConfiguration>());
+        }).singleInstance();
         builder.registerType<HealthController>().singleInstance();
+        builder.registerType<AdminController>().singleInstance();
 
-        builder.registerType<MatchRepository>().as<IMatchRepository>().singleInstance();
+        builder.registerType<MatchRepository>().as<IMatchRepository>()
+            .with<IDocumentDecoder>([configuration](Hypodermic::ComponentContext&) {
+                return documentDecoder(configuration["databaseConfig"], "matches");
+            })
+            .singleInstance();
         builder.registerType<MatchDelegate>().as<IMatchDelegate>()
-            .with<IQueueMessageProducer>([](Hypodermic::ComponentContext& context){
-                return context.resolveNamed<QueueMessageProducer>("tournamentScoreUpdateQueue");
+            .with<IQueueMessageProducer>([queueProducer](Hypodermic::ComponentContext& context){
+                return queueProducer(context, "tournamentScoreUpdateQueue");
             })
             .singleInstance();
         builder.registerType<MatchController>().singleInstance();
 
+        builder.registerType<ExportRepository>().as<IExportRepository>().singleInstance();
+        builder.registerType<ExportDelegate>().as<IExportDelegate>().singleInstance();
+        builder.registerType<ExportController>().singleInstance();
+
+        builder.registerType<ImportRepository>().as<IImportRepository>().singleInstance();
+        builder.registerType<ImportDelegate>().as<IImportDelegate>().singleInstance();
+        builder.registerType<ImportController>().singleInstance();
+
+        builder.registerType<IdempotencyRepository>().as<IIdempotencyRepository>().singleInstance();
+        builder.registerInstanceFactory([configuration, watcher](Hypodermic::ComponentContext& context) {
+            constexpr size_t defaultCacheSize = 4096;
+            auto store = std::make_shared<IdempotencyStore>(
+                context.resolve<IIdempotencyRepository>(),
+                configuration.value("idempotency", nlohmann::json::object()).value("cacheSize", defaultCacheSize));
+            watcher->Subscribe("/idempotency/cacheSize", [store](const nlohmann::json& section) {
+                store->Resize(section.get<size_t>());
+            }, defaultCacheSize);
+            return store;
+        }).singleInstance();
+
         return builder.build();
     }
 }
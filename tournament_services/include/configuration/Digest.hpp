@@ -0,0 +1,27 @@
+#ifndef RESTAPI_DIGEST_HPP
+#define RESTAPI_DIGEST_HPP
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <openssl/evp.h>
+
+namespace digest {
+    // Hex SHA-256 of data. Unlike std::hash it is the same on every replica and every build, so it can be
+    // stored or sent to clients and compared later.
+    inline std::string Sha256Hex(std::string_view data) {
+        std::array<unsigned char, EVP_MAX_MD_SIZE> hash{};
+        unsigned int length = 0;
+        EVP_Digest(data.data(), data.size(), hash.data(), &length, EVP_sha256(), nullptr);
+
+        static constexpr char HEX[] = "0123456789abcdef";
+        std::string hex(length * 2, '0');
+        for (unsigned int i = 0; i < length; ++i) {
+            hex[2 * i] = HEX[hash[i] >> 4];
+            hex[2 * i + 1] = HEX[hash[i] & 0x0f];
+        }
+        return hex;
+    }
+}
+
+#endif //RESTAPI_DIGEST_HPP
@@ -0,0 +1,492 @@
+#ifndef TOURNAMENTS_FINISHED_TOURNAMENT_CACHE_HPP
+#define TOURNAMENTS_FINISHED_TOURNAMENT_CACHE_HPP
+
+#include <crow.h>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <zlib.h>
+#include <nlohmann/json.hpp>
+
+#include "configuration/Digest.hpp"
+
+enum class CachedResource { SNAPSHOT, MATCHES, GROUPS };
+
+// One response body, serialized and compressed once
+struct CachedBody {
+    std::string json;
+    std::string gzip;
+    std::string etag;
+};
+
+struct FinishedTournamentCacheConfiguration {
+    size_t memoryBytes = 64 * 1024 * 1024;
+    // bodies pushed out of memory are written here; empty keeps the cache memory only
+    std::string spillDirectory;
+    // how long a body and a finished mark are trusted before the database is asked again; writes
+    // accepted by another replica become visible here within this time
+    std::chrono::seconds timeToLive{300};
+    // how long clients and proxies may reuse a body before revalidating it against its ETag
+    std::chrono::seconds maxAge{60};
+    // tournaments remembered as finished, the oldest marks go first
+    size_t maxFinished = 10000;
+};
+
+inline void from_json(const nlohmann::json& json, FinishedTournamentCacheConfiguration& configuration) {
+    configuration.memoryBytes = json.value("memoryBytes", configuration.memoryBytes);
+    configuration.spillDirectory = json.value("spillDirectory", configuration.spillDirectory);
+    configuration.timeToLive = std::chrono::seconds(json.value("timeToLiveSeconds", configuration.timeToLive.count()));
+    configuration.maxAge = std::chrono::seconds(json.value("maxAgeSeconds", configuration.maxAge.count()));
+    configuration.maxFinished = json.value("maxFinished", configuration.maxFinished);
+}
+
+// Responses of tournaments whose bracket is decided. Such a tournament rarely changes, so its snapshot,
+// groups and matches are kept as final bytes and served without touching the delegates, the database
+// or the JSON layer. A write accepted by this replica evicts the tournament, a team renamed or deleted
+// here evicts the tournaments whose groups list it; writes on other replicas
+// are picked up once timeToLive runs out, and clients revalidate with the ETag after maxAge. Memory is
+// bounded by memoryBytes (least recently used first out, to the spill directory when configured).
+class FinishedTournamentCache {
+    using Key = std::string;
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::shared_ptr<const CachedBody> body;
+        Clock::time_point stored;
+        std::list<Key>::iterator position;
+    };
+
+    // bodies pushed out of memory, written to disk once the mutex is released
+    struct Spill {
+        std::vector<std::pair<Key, Entry>> entries;
+        // Evict calls so far; a later one may have made the bodies stale, then they are not kept
+        uint64_t evictions = 0;
+    };
+
+    FinishedTournamentCacheConfiguration configuration;
+    std::mutex mutex;
+    // when each tournament was marked finished, and the marks in the order they were made
+    std::unordered_map<std::string, Clock::time_point> finished;
+    std::deque<std::pair<std::string, Clock::time_point>> marks;
+    std::list<Key> recency;
+    std::unordered_map<Key, Entry> entries;
+    std::unordered_map<Key, Clock::time_point> spilled;
+    // teams named in each cached groups body, and the other way round
+    std::unordered_map<std::string, std::vector<std::string>> teamsByTournament;
+    std::unordered_map<std::string, std::unordered_set<std::string>> tournamentsByTeam;
+    size_t memoryUsed = 0;
+    uint64_t evictions = 0;
+
+    static Key key(std::string_view tournamentId, CachedResource resource) {
+        static constexpr std::string_view NAMES[] = {"snapshot", "matches", "groups"};
+        return std::string(tournamentId) + "." + std::string(NAMES[static_cast<size_t>(resource)]);
+    }
+
+    // keys become file names, anything but an id-shaped tournament id stays in memory
+    static bool spillable(std::string_view entry) {
+        const auto tournamentId = tournamentOf(entry);
+        return !tournamentId.empty() && tournamentId.find_first_not_of("0123456789abcdefABCDEF-") == std::string_view::npos;
+    }
+
+    static size_t footprint(const CachedBody& body) {
+        return body.json.size() + body.gzip.size() + body.etag.size();
+    }
+
+    std::filesystem::path path(const Key& entry, std::string_view extension) const {
+        return std::filesystem::path(configuration.spillDirectory) / (entry + std::string(extension));
+    }
+
+    void removeFiles(const Key& entry) const {
+        std::error_code ignored;
+        std::filesystem::remove(path(entry, ".json"), ignored);
+        std::filesystem::remove(path(entry, ".json.gz"), ignored);
+    }
+
+    // called with the mutex held
+    bool expired(Clock::time_point since) const {
+        return Clock::now() - since >= configuration.timeToLive;
+    }
+
+    // called with the mutex held
+    bool isFinished(const std::string& tournamentId) const {
+        const auto mark = finished.find(tournamentId);
+        return mark != finished.end() && !expired(mark->second);
+    }
+
+    // called with the mutex held
+    void erase(std::unordered_map<Key, Entry>::iterator entry) {
+        memoryUsed -= footprint(*entry->second.body);
+        recency.erase(entry->second.position);
+        entries.erase(entry);
+    }
+
+    static std::string_view tournamentOf(std::string_view entry) {
+        return entry.substr(0, entry.rfind('.'));
+    }
+
+    // called with the mutex held, when the groups body of a tournament is dropped
+    void forgetTeams(std::string_view tournamentId) {
+        const auto teams = teamsByTournament.find(std::string(tournamentId));
+        if (teams == teamsByTournament.end()) {
+            return;
+        }
+        for (const auto& teamId : teams->second) {
+            if (const auto tournaments = tournamentsByTeam.find(teamId); tournaments != tournamentsByTeam.end()) {
+                tournaments->second.erase(teams->first);
+                if (tournaments->second.empty()) {
+                    tournamentsByTeam.erase(tournaments);
+                }
+            }
+        }
+        teamsByTournament.erase(teams);
+    }
+
+    // called with the mutex held
+    void evict(std::string_view tournamentId) {
+        ++evictions;
+        finished.erase(std::string(tournamentId));
+        forgetTeams(tournamentId);
+        for (const auto resource : {CachedResource::SNAPSHOT, CachedResource::MATCHES, CachedResource::GROUPS}) {
+            const auto entry = key(tournamentId, resource);
+            if (const auto cached = entries.find(entry); cached != entries.end()) {
+                erase(cached);
+            }
+            if (spilled.erase(entry) > 0) {
+                removeFiles(entry);
+            }
+        }
+    }
+
+    // called with the mutex held
+    Spill evictToBudget() {
+        Spill spill{.evictions = evictions};
+        while (memoryUsed > configuration.memoryBytes && !recency.empty()) {
+            const auto oldest = entries.find(recency.back());
+            auto victim = std::make_pair(oldest->first, oldest->second);
+            erase(oldest);
+            if (!configuration.spillDirectory.empty() && spillable(victim.first)) {
+                spill.entries.push_back(std::move(victim));
+            } else if (victim.first == key(tournamentOf(victim.first), CachedResource::GROUPS)) {
+                forgetTeams(tournamentOf(victim.first));
+            }
+        }
+        return spill;
+    }
+
+    // Called without the mutex: the files are written first and only then listed as spilled, so Find
+    // never reads a half written body
+    void write(Spill spill) {
+        if (spill.entries.empty()) {
+            return;
+        }
+        for (const auto& [entry, cached] : spill.entries) {
+            std::ofstream(path(entry, ".json"), std::ios::binary) << cached.body->json;
+            std::ofstream(path(entry, ".json.gz"), std::ios::binary) << cached.body->gzip;
+        }
+        std::lock_guard lock(mutex);
+        for (const auto& [entry, cached] : spill.entries) {
+            if (spill.evictions == evictions) {
+                spilled.insert_or_assign(entry, cached.stored);
+            } else {
+                removeFiles(entry);
+            }
+        }
+    }
+
+    // called with the mutex held
+    Spill insert(const Key& entry, std::shared_ptr<const CachedBody> body, Clock::time_point stored) {
+        if (const auto existing = entries.find(entry); existing != entries.end()) {
+            erase(existing);
+        }
+        recency.push_front(entry);
+        memoryUsed += footprint(*body);
+        entries.emplace(entry, Entry{std::move(body), stored, recency.begin()});
+        return evictToBudget();
+    }
+
+    std::shared_ptr<const CachedBody> load(const Key& entry) const {
+        std::ifstream json(path(entry, ".json"), std::ios::binary);
+        std::ifstream gzip(path(entry, ".json.gz"), std::ios::binary);
+        if (!json || !gzip) {
+            return nullptr;
+        }
+        auto body = std::make_shared<CachedBody>();
+        body->json.assign(std::istreambuf_iterator<char>(json), {});
+        body->gzip.assign(std::istreambuf_iterator<char>(gzip), {});
+        body->etag = Etag(body->json);
+        return body;
+    }
+
+    // Whether an Accept-Encoding header takes gzip, e.g. "gzip, deflate" does and "gzip;q=0" or
+    // "identity" do not. A wildcard counts unless gzip is listed on its own.
+    static bool acceptsGzip(std::string_view header) {
+        std::optional<bool> gzip;
+        bool wildcard = false;
+        while (!header.empty()) {
+            const auto comma = header.find(',');
+            auto coding = header.substr(0, comma);
+            header = comma == std::string_view::npos ? std::string_view{} : header.substr(comma + 1);
+
+            double quality = 1.0;
+            if (const auto semicolon = coding.find(';'); semicolon != std::string_view::npos) {
+                auto parameter = trim(coding.substr(semicolon + 1));
+                if (parameter.size() > 2 && (parameter[0] == 'q' || parameter[0] == 'Q') && parameter[1] == '=') {
+                    parameter.remove_prefix(2);
+                    std::from_chars(parameter.data(), parameter.data() + parameter.size(), quality);
+                }
+                coding = coding.substr(0, semicolon);
+            }
+            coding = trim(coding);
+            if (equalsIgnoringCase(coding, "gzip") || equalsIgnoringCase(coding, "x-gzip")) {
+                gzip = quality > 0;
+            } else if (coding == "*") {
+                wildcard = quality > 0;
+            }
+        }
+        return gzip.value_or(wildcard);
+    }
+
+    // If-None-Match lists one or more ETags, or * for any
+    static bool matchesEtag(std::string_view header, std::string_view etag) {
+        while (!header.empty()) {
+            const auto comma = header.find(',');
+            auto candidate = trim(header.substr(0, comma));
+            header = comma == std::string_view::npos ? std::string_view{} : header.substr(comma + 1);
+            if (candidate.starts_with("W/")) {
+                candidate.remove_prefix(2);
+            }
+            if (candidate == "*" || candidate == etag) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static std::string_view trim(std::string_view value) {
+        const auto first = value.find_first_not_of(" \t");
+        if (first == std::string_view::npos) {
+            return {};
+        }
+        return value.substr(first, value.find_last_not_of(" \t") - first + 1);
+    }
+
+    static bool equalsIgnoringCase(std::string_view value, std::string_view lowercase) {
+        return std::ranges::equal(value, lowercase, [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; });
+    }
+
+public:
+    explicit FinishedTournamentCache(FinishedTournamentCacheConfiguration configuration = {}) : configuration(std::move(configuration)) {
+        if (!this->configuration.spillDirectory.empty()) {
+            // what a previous run spilled may have been evicted by writes on another replica since
+            std::filesystem::remove_all(this->configuration.spillDirectory);
+            std::filesystem::create_directories(this->configuration.spillDirectory);
+        }
+    }
+
+    static std::string Gzip(std::string_view data) {
+        z_stream stream{};
+        if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("deflateInit2 failed");
+        }
+        std::string compressed(deflateBound(&stream, data.size()), '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream.avail_in = static_cast<uInt>(data.size());
+        stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+        stream.avail_out = static_cast<uInt>(compressed.size());
+        const int result = deflate(&stream, Z_FINISH);
+        compressed.resize(stream.total_out);
+        deflateEnd(&stream);
+        if (result != Z_STREAM_END) {
+            throw std::runtime_error("deflate failed");
+        }
+        return compressed;
+    }
+
+    // Same body, same ETag, on every replica and across restarts
+    static std::string Etag(std::string_view json) {
+        return "\"" + digest::Sha256Hex(json) + "\"";
+    }
+
+    // The spill directory is fixed at startup, the rest changes live
+    void Reconfigure(const FinishedTournamentCacheConfiguration& settings) {
+        Spill spill;
+        {
+            std::lock_guard lock(mutex);
+            configuration.memoryBytes = settings.memoryBytes;
+            configuration.timeToLive = settings.timeToLive;
+            configuration.maxAge = settings.maxAge;
+            configuration.maxFinished = settings.maxFinished;
+            spill = evictToBudget();
+        }
+        write(std::move(spill));
+    }
+
+    void MarkFinished(std::string_view tournamentId) {
+        std::lock_guard lock(mutex);
+        const auto now = Clock::now();
+        finished.insert_or_assign(std::string(tournamentId), now);
+        marks.emplace_back(tournamentId, now);
+        // a mark made again later leaves its older entry in marks, that one no longer erases anything
+        while (!marks.empty() && (marks.size() > configuration.maxFinished || expired(marks.front().second))) {
+            const auto& [oldest, markedAt] = marks.front();
+            if (const auto mark = finished.find(oldest); mark != finished.end() && mark->second == markedAt) {
+                finished.erase(mark);
+            }
+            marks.pop_front();
+        }
+    }
+
+    bool IsFinished(std::string_view tournamentId) {
+        std::lock_guard lock(mutex);
+        return isFinished(std::string(tournamentId));
+    }
+
+    std::shared_ptr<const CachedBody> Find(std::string_view tournamentId, CachedResource resource) {
+        const auto entry = key(tournamentId, resource);
+        Clock::time_point stored;
+        uint64_t evictionsBefore;
+        {
+            std::lock_guard lock(mutex);
+            if (const auto cached = entries.find(entry); cached != entries.end()) {
+                if (expired(cached->second.stored)) {
+                    erase(cached);
+                    if (spilled.erase(entry) > 0) {
+                        removeFiles(entry);
+                    }
+                    if (resource == CachedResource::GROUPS) {
+                        forgetTeams(tournamentId);
+                    }
+                    return nullptr;
+                }
+                recency.splice(recency.begin(), recency, cached->second.position);
+                return cached->second.body;
+            }
+            const auto spill = spilled.find(entry);
+            if (spill == spilled.end()) {
+                return nullptr;
+            }
+            if (expired(spill->second)) {
+                spilled.erase(spill);
+                removeFiles(entry);
+                if (resource == CachedResource::GROUPS) {
+                    forgetTeams(tournamentId);
+                }
+                return nullptr;
+            }
+            stored = spill->second;
+            evictionsBefore = evictions;
+        }
+
+        auto body = load(entry);
+        if (body == nullptr) {
+            return nullptr;
+        }
+        Spill spill;
+        {
+            std::lock_guard lock(mutex);
+            // evicted while reading
+            if (evictions != evictionsBefore) {
+                return body;
+            }
+            spill = insert(entry, body, stored);
+        }
+        write(std::move(spill));
+        return body;
+    }
+
+    // Only for tournaments marked finished; returns the stored body, or null when it is not finished.
+    // `teamIds` are the teams whose names the body shows, EvictTeam drops it when one of them changes.
+    std::shared_ptr<const CachedBody> Store(std::string_view tournamentId, CachedResource resource, std::string json,
+                                            const std::vector<std::string>& teamIds = {}) {
+        if (!IsFinished(tournamentId)) {
+            return nullptr;
+        }
+        auto body = std::make_shared<CachedBody>();
+        body->gzip = Gzip(json);
+        body->etag = Etag(json);
+        body->json = std::move(json);
+
+        Spill spill;
+        {
+            std::lock_guard lock(mutex);
+            // evicted while compressing
+            if (!isFinished(std::string(tournamentId))) {
+                return body;
+            }
+            if (!teamIds.empty()) {
+                forgetTeams(tournamentId);
+                teamsByTournament.emplace(tournamentId, teamIds);
+                for (const auto& teamId : teamIds) {
+                    tournamentsByTeam[teamId].emplace(tournamentId);
+                }
+            }
+            spill = insert(key(tournamentId, resource), body, Clock::now());
+        }
+        write(std::move(spill));
+        return body;
+    }
+
+    void Evict(std::string_view tournamentId) {
+        std::lock_guard lock(mutex);
+        evict(tournamentId);
+    }
+
+    // Every cached tournament whose groups show the team
+    void EvictTeam(std::string_view teamId) {
+        std::lock_guard lock(mutex);
+        const auto tournaments = tournamentsByTeam.find(std::string(teamId));
+        if (tournaments == tournamentsByTeam.end()) {
+            return;
+        }
+        // evict() edits the index being walked
+        const std::vector<std::string> affected(tournaments->second.begin(), tournaments->second.end());
+        for (const auto& tournamentId : affected) {
+            evict(tournamentId);
+        }
+    }
+
+    // Gzip bytes to clients that accept them, 304 for a matching If-None-Match
+    crow::response Respond(const crow::request& request, const CachedBody& body) {
+        std::chrono::seconds maxAge;
+        {
+            std::lock_guard lock(mutex);
+            maxAge = configuration.maxAge;
+        }
+        crow::response response;
+        response.add_header("Cache-Control", "public, max-age=" + std::to_string(maxAge.count()));
+        response.add_header("ETag", body.etag);
+        response.add_header("Vary", "Accept-Encoding");
+        if (matchesEtag(request.get_header_value("If-None-Match"), body.etag)) {
+            response.code = crow::NOT_MODIFIED;
+            return response;
+        }
+        response.code = crow::OK;
+        response.add_header("content-type", "application/json");
+        if (acceptsGzip(request.get_header_value("Accept-Encoding"))) {
+            response.add_header("Content-Encoding", "gzip");
+            response.body = body.gzip;
+        } else {
+            response.body = body.json;
+        }
+        return response;
+    }
+};
+
+#endif //TOURNAMENTS_FINISHED_TOURNAMENT_CACHE_HPP
@@ -0,0 +1,191 @@
+#ifndef RESTAPI_IDEMPOTENCY_STORE_HPP
+#define RESTAPI_IDEMPOTENCY_STORE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <crow.h>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "configuration/Digest.hpp"
+#include "persistence/repository/IIdempotencyRepository.hpp"
+
+// Idempotency-Key support for POST and PATCH. The first request with a key reserves it in
+// IDEMPOTENCY_KEYS, executes, and records its response; retries with the same key get that response
+// back without reaching the controller. Completed responses are immutable, so each replica keeps an
+// LRU of them in front of the table. Server errors and 429s are not recorded, a retry executes again.
+class IdempotencyStore {
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr auto HEADER = "Idempotency-Key";
+    static constexpr size_t MAX_KEY_LENGTH = 255;
+    static constexpr auto TIME_TO_LIVE = std::chrono::hours{24};
+    static constexpr auto PURGE_INTERVAL = std::chrono::minutes{10};
+
+    struct Cached {
+        std::string fingerprint;
+        std::shared_ptr<const StoredResponse> response;
+        Clock::time_point storedAt;
+        std::list<std::string>::iterator recency;
+    };
+
+    std::shared_ptr<IIdempotencyRepository> repository;
+    size_t capacity;
+    std::mutex mutex;
+    std::list<std::string> recency;
+    std::unordered_map<std::string, Cached> cache;
+    std::atomic<Clock::rep> nextPurge{0};
+
+    std::optional<Cached> lookup(const std::string& cacheKey) {
+        std::lock_guard lock(mutex);
+        const auto entry = cache.find(cacheKey);
+        if (entry == cache.end()) {
+            return std::nullopt;
+        }
+        if (Clock::now() - entry->second.storedAt > TIME_TO_LIVE) {
+            recency.erase(entry->second.recency);
+            cache.erase(entry);
+            return std::nullopt;
+        }
+        recency.splice(recency.begin(), recency, entry->second.recency);
+        return entry->second;
+    }
+
+    // Cached entries are plain heap objects, never request arena memory, they outlive the request
+    void remember(const std::string& cacheKey, const std::string& fingerprint, StoredResponse response) {
+        std::lock_guard lock(mutex);
+        if (cache.contains(cacheKey) || capacity == 0) {
+            return;
+        }
+        if (cache.size() >= capacity) {
+            cache.erase(recency.back());
+            recency.pop_back();
+        }
+        recency.push_front(cacheKey);
+        cache.emplace(cacheKey, Cached{fingerprint, std::make_shared<const StoredResponse>(std::move(response)), Clock::now(), recency.begin()});
+    }
+
+    void purgeExpired() {
+        const auto now = Clock::now().time_since_epoch().count();
+        auto scheduled = nextPurge.load();
+        if (now < scheduled || !nextPurge.compare_exchange_strong(scheduled, now + std::chrono::duration_cast<Clock::duration>(PURGE_INTERVAL).count())) {
+            return;
+        }
+        try {
+            repository->PurgeExpired();
+        } catch (const std::exception& e) {
+            std::cout << "[IdempotencyStore] ERROR purging keys: " << e.what() << std::endl;
+        }
+    }
+
+    static crow::response replay(const StoredResponse& stored) {
+        crow::response response{stored.status, stored.body};
+        for (const auto& [name, value] : stored.headers) {
+            response.add_header(name, value);
+        }
+        response.add_header("Idempotent-Replayed", "true");
+        return response;
+    }
+
+    // A failed release only delays the retry until the reservation's lease expires, the response
+    // already produced is still what the client gets
+    void release(const std::string& key, const std::string& scope) {
+        try {
+            repository->Release(key, scope);
+        } catch (const std::exception& e) {
+            std::cout << "[IdempotencyStore] ERROR releasing key: " << e.what() << std::endl;
+        }
+    }
+
+    static crow::response inProgress() {
+        crow::response response{crow::CONFLICT, "A request with this Idempotency-Key is in progress"};
+        response.add_header("Retry-After", "1");
+        return response;
+    }
+
+public:
+    IdempotencyStore(std::shared_ptr<IIdempotencyRepository> repository, size_t capacity)
+        : repository(std::move(repository)), capacity(capacity) {}
+
+    void Resize(size_t size) {
+        std::lock_guard lock(mutex);
+        capacity = size;
+        while (cache.size() > capacity) {
+            cache.erase(recency.back());
+            recency.pop_back();
+        }
+    }
+
+    template<typename Invoke>
+    crow::response Execute(const crow::request& request, Invoke&& invoke) {
+        if (request.method != crow::HTTPMethod::Post && request.method != crow::HTTPMethod::Patch) {
+            return invoke();
+        }
+        const auto& key = request.get_header_value(HEADER);
+        if (key.empty()) {
+            return invoke();
+        }
+        if (key.size() > MAX_KEY_LENGTH) {
+            return crow::response{crow::BAD_REQUEST, "Idempotency-Key must be at most 255 characters"};
+        }
+
+        const std::string scope = std::string(crow::method_name(request.method)) + " " + request.url;
+        // compared across replicas and deploys, so a digest stable across builds
+        const std::string fingerprint = digest::Sha256Hex(request.body);
+        const std::string cacheKey = scope + "\n" + key;
+
+        if (const auto cached = lookup(cacheKey)) {
+            if (cached->fingerprint != fingerprint) {
+                return crow::response{422, "Idempotency-Key was already used with a different request"};
+            }
+            return replay(*cached->response);
+        }
+
+        purgeExpired();
+        if (!repository->Reserve(key, scope, fingerprint)) {
+            const auto record = repository->Find(key, scope);
+            if (!record.has_value() || !record->response.has_value()) {
+                return inProgress();
+            }
+            if (record->fingerprint != fingerprint) {
+                return crow::response{422, "Idempotency-Key was already used with a different request"};
+            }
+            remember(cacheKey, record->fingerprint, *record->response);
+            return replay(*record->response);
+        }
+
+        crow::response response;
+        try {
+            response = invoke();
+        } catch (...) {
+            release(key, scope);
+            throw;
+        }
+
+        if (response.code >= crow::INTERNAL_SERVER_ERROR || response.code == crow::TOO_MANY_REQUESTS) {
+            release(key, scope);
+            return response;
+        }
+
+        StoredResponse stored{response.code, {}, response.body};
+        for (const auto& [name, value] : response.headers) {
+            stored.headers.emplace_back(name, value);
+        }
+        try {
+            repository->Complete(key, scope, stored);
+            remember(cacheKey, fingerprint, std::move(stored));
+        } catch (const std::exception& e) {
+            // The work is done, answer it; the reservation is taken over once its lease expires
+            std::cout << "[IdempotencyStore] ERROR recording response: " << e.what() << std::endl;
+        }
+        return response;
+    }
+};
+
+#endif //RESTAPI_IDEMPOTENCY_STORE_HPP
@@ -7,14 +7,95 @@
 
 #include <crow.h>
 #include <Hypodermic/Container.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 #include <functional>
 #include <string>
+#include <nlohmann/json.hpp>
+
+#include "configuration/IdempotencyStore.hpp"
+#include "deadline/RequestDeadline.hpp"
+#include "exception/CircuitOpen.hpp"
+#include "exception/DeadlineExceeded.hpp"
+#include "memory/RequestArena.hpp"
+#include "resilience/AdmissionController.hpp"
+#include "resilience/CircuitBreaker.hpp"
+
+// Routes that do not declare their own budget get this one
+inline constexpr std::chrono::milliseconds DEFAULT_REQUEST_DEADLINE{2000};
+
+// Routes that do not declare their own latency target are judged against this one
+inline constexpr std::chrono::milliseconds DEFAULT_LATENCY_TARGET{250};
+
+// How the dispatch wrapper treats a route: time budget, shed priority, its own concurrency cap and
+// the latency it is expected to answer in
+struct RoutePolicy {
+    std::chrono::milliseconds deadline = DEFAULT_REQUEST_DEADLINE;
+    resilience::Priority priority = resilience::Priority::STANDARD;
+    // requests of this route served at once, 0 leaves it to the shared adaptive limit only
+    size_t concurrency = 0;
+    // slower requests shrink the adaptive limit, 0 keeps the route out of it
+    std::chrono::milliseconds latencyTarget = DEFAULT_LATENCY_TARGET;
+};
+
+// The caps are counted in HTTP workers (runConfig.concurrency), a cap at or above the adaptive limit's
+// share for the class never rejects anything
+namespace route_policy {
+    inline constexpr RoutePolicy STANDARD{};
+    // score writes and health probes, the last traffic to be shed
+    inline constexpr RoutePolicy CRITICAL{DEFAULT_REQUEST_DEADLINE, resilience::Priority::CRITICAL};
+    // groups and matches of a tournament
+    inline constexpr RoutePolicy BRACKET_READ{std::chrono::seconds{5}, resilience::Priority::STANDARD, 0, std::chrono::milliseconds{500}};
+    // whole-table lists, slow by design so they do not feed the adaptive limit
+    inline constexpr RoutePolicy BULK_LIST{std::chrono::seconds{5}, resilience::Priority::BULK, 3, std::chrono::milliseconds{0}};
+    inline constexpr RoutePolicy EXPORT{std::chrono::minutes{2}, resilience::Priority::BULK, 2, std::chrono::milliseconds{0}};
+    inline constexpr RoutePolicy IMPORT{std::chrono::minutes{5}, resilience::Priority::BULK, 1, std::chrono::milliseconds{0}};
+    // profile captures hold a worker for the requested window, one at a time
+    inline constexpr RoutePolicy ADMIN_CAPTURE{std::chrono::seconds{90}, resilience::Priority::STANDARD, 1, std::chrono::milliseconds{0}};
+}
+
+// Deadlines changed at runtime from "routeDeadlines": {"<METHOD> <route path>": millis}, e.g.
+// "GET /tournaments/<string>/matches"; a path serves several methods with different budgets. Routes
+// not listed keep the deadline of their policy.
+class RouteDeadlines {
+    using Overrides = std::map<std::string, std::chrono::milliseconds, std::less<>>;
+    std::atomic<std::shared_ptr<const Overrides>> overrides{std::make_shared<const Overrides>()};
+public:
+    static std::string Key(crow::HTTPMethod method, std::string_view path) {
+        return crow::method_name(method) + " " + std::string(path);
+    }
+
+    void Reconfigure(const nlohmann::json& configuration) {
+        auto next = std::make_shared<Overrides>();
+        for (const auto& [route, millis] : configuration.items()) {
+            const auto space = route.find(' ');
+            if (space == std::string::npos || space == 0 || route.size() == space + 1 || route[space + 1] != '/') {
+                throw std::invalid_argument("routeDeadlines keys are \"<METHOD> <path>\", not \"" + route + "\"");
+            }
+            next->emplace(route, std::chrono::milliseconds{millis.get<int64_t>()});
+        }
+        overrides.store(std::move(next));
+    }
+
+    // `route` as made by Key
+    [[nodiscard]] RoutePolicy Apply(std::string_view route, RoutePolicy policy) const {
+        const auto current = overrides.load();
+        if (const auto deadline = current->find(route); deadline != current->end()) {
+            policy.deadline = deadline->second;
+        }
+        return policy;
+    }
+};
 
 // Route definition storage
 struct RouteDefinition {
     std::string path;
     crow::HTTPMethod method;
+    RoutePolicy policy;
     std::function<void(crow::SimpleApp &, std::shared_ptr<Hypodermic::Container>)> binder;
 };
 
@@ -43,16 +124,62 @@ auto invokeController(Controller* controller, Method method, const crow::request
 
 }
 
+// Admits the request against the route cap and the shared adaptive limit (429 / 503 right away when
+// over budget), then runs the controller inside the request scope: arena and deadline. A server error
+// produced after the deadline passed (cancelled statement, pool wait given up) is reported as a gateway
+// timeout, one caused by an open circuit breaker as service unavailable so clients and the balancer back off.
+template<typename Invoke>
+crow::response invokeInRequestScope(const RoutePolicy& policy, resilience::AdmissionController& admission, resilience::RouteGate& gate, Invoke&& invoke) {
+    const auto permit = admission.TryAdmit(policy.priority, gate, policy.latencyTarget);
+    if (!permit) {
+        crow::response response{permit.error() == resilience::Rejection::ROUTE_LIMIT ? crow::TOO_MANY_REQUESTS : crow::SERVICE_UNAVAILABLE, "Over capacity"};
+        response.add_header("Retry-After", "1");
+        return response;
+    }
+
+    memory::RequestArena arena;
+    deadline::RequestDeadline requestDeadline(policy.deadline);
+    resilience::CircuitBreaker::TakeRejected();
+    try {
+        crow::response response = invoke();
+        if (response.code >= crow::INTERNAL_SERVER_ERROR) {
+            if (resilience::CircuitBreaker::TakeRejected()) {
+                return crow::response{crow::SERVICE_UNAVAILABLE, "Dependency unavailable"};
+            }
+            if (deadline::RequestDeadline::Expired()) {
+                return crow::response{crow::GATEWAY_TIMEOUT, "Deadline exceeded"};
+            }
+        }
+        return response;
+    } catch (const CircuitOpenException&) {
+        return crow::response{crow::SERVICE_UNAVAILABLE, "Dependency unavailable"};
+    } catch (const DeadlineExceededException&) {
+        return crow::response{crow::GATEWAY_TIMEOUT, "Deadline exceeded"};
+    }
+}
+
 // Annotation-style macro
 #define REGISTER_ROUTE(Controller, Method, Path, HttpMethod) \
+    REGISTER_ROUTE_WITH_POLICY(Controller, Method, Path, HttpMethod, route_policy::STANDARD)
+
+#define REGISTER_ROUTE_WITH_POLICY(Controller, Method, Path, HttpMethod, Policy) \
 struct Controller## _##Method##_RouteRegistrator { \
     Controller##_##Method##_RouteRegistrator() { \
-        routeRegistry().push_back({ Path, HttpMethod, \
+        routeRegistry().push_back({ Path, HttpMethod, Policy, \
             [](crow::SimpleApp& app, const std::shared_ptr<Hypodermic::Container>& container) { \
+                    auto admission = container->resolve<resilience::AdmissionController>(); \
+                    auto gate = std::make_shared<resilience::RouteGate>(Policy.concurrency); \
+                    auto idempotency = container->resolve<IdempotencyStore>(); \
+                    auto deadlines = container->resolve<RouteDeadlines>(); \
+                    auto route = RouteDeadlines::Key(HttpMethod, Path); \
                     CROW_ROUTE(app, Path).methods(HttpMethod)( \
-                        [container](const crow::request& request ,auto&&... args) { \
-                        auto controller = container->resolve<Controller>(); \
-                        return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                        [container, admission, gate, idempotency, deadlines, route](const crow::request& request ,auto&&... args) { \
+                        return invokeInRequestScope(deadlines->Apply(route, Policy), *admission, *gate, [&] { \
+                            return idempotency->Execute(request, [&] { \
+                                auto controller = container->resolve<Controller>(); \
+                                return invokeController(controller.get(), &Controller::Method, request, std::forward<decltype(args)>(args)...); \
+                            }); \
+                        }); \
                     } \
                 ); \
             } \
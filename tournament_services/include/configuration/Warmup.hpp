@@ -0,0 +1,110 @@
+#ifndef TOURNAMENTS_WARMUP_HPP
+#define TOURNAMENTS_WARMUP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <crow.h>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/GroupController.hpp"
+#include "controller/MatchController.hpp"
+#include "controller/TournamentController.hpp"
+#include "deadline/RequestDeadline.hpp"
+#include "memory/RequestArena.hpp"
+#include "persistence/repository/TournamentRepository.hpp"
+
+struct WarmupConfiguration {
+    // most recently active tournaments read before the replica reports ready
+    size_t tournaments = 50;
+    // only tournaments active this recently are candidates
+    std::chrono::hours activeWithin{24 * 7};
+    // readiness is not held back longer than this, whatever is left stays cold
+    std::chrono::milliseconds budget{30000};
+};
+
+inline void from_json(const nlohmann::json& json, WarmupConfiguration& configuration) {
+    configuration.tournaments = json.value("tournaments", configuration.tournaments);
+    configuration.budget = std::chrono::milliseconds(json.value("budgetMillis", configuration.budget.count()));
+    configuration.activeWithin = std::chrono::hours(json.value("activeWithinHours", configuration.activeWithin.count()));
+}
+
+// Serves the bracket reads of the most recently active tournaments once, in the background, right
+// after startup: the team dictionary and the finished tournament cache fill up, and the Postgres pages
+// and plans behind those reads are hot. /health/ready stays unavailable until it is done, so the
+// balancer only sends traffic to a warm replica.
+class Warmup {
+    using Clock = std::chrono::steady_clock;
+
+    std::shared_ptr<TournamentRepository> tournamentRepository;
+    std::shared_ptr<TournamentController> tournamentController;
+    std::shared_ptr<GroupController> groupController;
+    std::shared_ptr<MatchController> matchController;
+    WarmupConfiguration configuration;
+    std::atomic<bool> done{false};
+    std::jthread thread;
+
+    void run() {
+        const auto started = Clock::now();
+        const auto until = started + configuration.budget;
+        size_t warmed = 0;
+        try {
+            std::vector<std::string> tournamentIds;
+            {
+                deadline::RequestDeadline deadline(configuration.budget);
+                tournamentIds = tournamentRepository->FindRecentlyActiveIds(configuration.tournaments, configuration.activeWithin);
+            }
+            const crow::request request;
+            for (const auto& tournamentId : tournamentIds) {
+                if (Clock::now() >= until) {
+                    break;
+                }
+                memory::RequestArena arena;
+                deadline::RequestDeadline deadline(route_policy::BRACKET_READ.deadline);
+                try {
+                    // matches first: a finished bracket marks the tournament cacheable for the two reads after it
+                    matchController->getMatches(request, tournamentId);
+                    tournamentController->getTournament(request, tournamentId);
+                    groupController->GetGroups(request, tournamentId);
+                    ++warmed;
+                } catch (const std::exception& e) {
+                    std::cout << "[Warmup] skipping " << tournamentId << ": " << e.what() << std::endl;
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cout << "[Warmup] ERROR, reporting ready with a partial warmup: " << e.what() << std::endl;
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - started);
+        std::cout << "[Warmup] " << warmed << " tournaments warmed in " << elapsed.count() << " ms" << std::endl;
+        done = true;
+    }
+
+public:
+    Warmup(const std::shared_ptr<TournamentRepository>& tournamentRepository,
+           const std::shared_ptr<TournamentController>& tournamentController,
+           const std::shared_ptr<GroupController>& groupController,
+           const std::shared_ptr<MatchController>& matchController,
+           WarmupConfiguration configuration)
+        : tournamentRepository(tournamentRepository), tournamentController(tournamentController),
+          groupController(groupController), matchController(matchController), configuration(configuration) {}
+
+    void Start() {
+        if (configuration.tournaments == 0) {
+            done = true;
+            return;
+        }
+        thread = std::jthread([this] { run(); });
+    }
+
+    [[nodiscard]] bool Done() const {
+        return done.load(std::memory_order_acquire);
+    }
+};
+
+#endif //TOURNAMENTS_WARMUP_HPP
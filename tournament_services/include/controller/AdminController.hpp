@@ -0,0 +1,131 @@
+#ifndef TOURNAMENTS_ADMINCONTROLLER_HPP
+#define TOURNAMENTS_ADMINCONTROLLER_HPP
+
+#include <memory>
+#include <string>
+#include <nlohmann/json.hpp>
+
+#include "configuration/AdminConfiguration.hpp"
+#include "configuration/ConfigurationWatcher.hpp"
+#include "configuration/RouteDefinition.hpp"
+#include "persistence/configuration/SlowQueryLog.hpp"
+#include "profiling/CaptureDuration.hpp"
+#include "profiling/CpuProfiler.hpp"
+#include "profiling/LockProfiler.hpp"
+
+// Operational endpoints for the people running the service, not for API clients. Every route
+// requires "Authorization: Bearer <admin token>".
+class AdminController {
+    std::shared_ptr<SlowQueryLog> slowQueries;
+    std::shared_ptr<config::AdminConfiguration> adminConfiguration;
+    std::shared_ptr<config::ConfigurationWatcher> configurationWatcher;
+
+    [[nodiscard]] bool authorized(const crow::request& request) const {
+        return adminConfiguration->Authorizes(request.get_header_value("Authorization"));
+    }
+
+    static crow::response unauthorized() {
+        crow::response response{crow::UNAUTHORIZED, "Admin token required"};
+        response.add_header("WWW-Authenticate", "Bearer");
+        return response;
+    }
+
+    static crow::response json(const nlohmann::json& body) {
+        crow::response response{crow::OK, body.dump()};
+        response.add_header("content-type", "application/json");
+        return response;
+    }
+
+    static crow::response collapsed(const profiling::CollapsedStacks& stacks) {
+        crow::response response{crow::OK, profiling::Render(stacks)};
+        response.add_header("content-type", "text/plain");
+        return response;
+    }
+
+    public:
+    AdminController(const std::shared_ptr<SlowQueryLog>& slowQueries, const std::shared_ptr<config::AdminConfiguration>& adminConfiguration,
+                    const std::shared_ptr<config::ConfigurationWatcher>& configurationWatcher)
+        : slowQueries(slowQueries), adminConfiguration(adminConfiguration), configurationWatcher(configurationWatcher) {}
+
+    // Active configuration snapshot with secrets masked, its generation and the last reload error
+    crow::response GetConfiguration(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        return json(configurationWatcher->Status());
+    }
+
+    // Applies configuration.json now instead of waiting for the next poll
+    crow::response ReloadConfiguration(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        const auto reloaded = configurationWatcher->Reload();
+        if (!reloaded) {
+            return crow::response{422, reloaded.error()};
+        }
+        return json(configurationWatcher->Status());
+    }
+
+    // Timings of every prepared statement and the latest slow executions, newest first. Their plans are in the Postgres log (auto_explain).
+    crow::response GetSlowQueries(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        return json({
+            {"statements", slowQueries->Statements()},
+            {"recent", slowQueries->Recent()},
+        });
+    }
+
+    // CPU samples for ?seconds=N as collapsed stacks, e.g. `curl ... | flamegraph.pl > cpu.svg`
+    crow::response GetCpuProfile(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        const auto duration = profiling::CaptureDuration(request.url_params.get("seconds"));
+        if (!duration) {
+            return crow::response{crow::BAD_REQUEST, duration.error()};
+        }
+        const auto profile = profiling::CpuProfiler::Capture(*duration);
+        if (!profile) {
+            return crow::response{crow::CONFLICT, profile.error()};
+        }
+        auto response = collapsed(profile->stacks);
+        response.add_header("X-Profile-Samples", std::to_string(profile->samples));
+        response.add_header("X-Profile-Dropped", std::to_string(profile->dropped));
+        return response;
+    }
+
+    // Stacks that waited on a contended lock during ?seconds=N, weighted by microseconds waited
+    crow::response GetLockProfile(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        const auto duration = profiling::CaptureDuration(request.url_params.get("seconds"));
+        if (!duration) {
+            return crow::response{crow::BAD_REQUEST, duration.error()};
+        }
+        const auto stacks = profiling::LockProfiler::Instance().Capture(*duration);
+        if (!stacks) {
+            return crow::response{crow::CONFLICT, stacks.error()};
+        }
+        return collapsed(*stacks);
+    }
+
+    // Contention counters of every profiled lock since start, most waited first
+    crow::response GetLocks(const crow::request& request) {
+        if (!authorized(request)) {
+            return unauthorized();
+        }
+        return json(profiling::LockProfiler::Instance().Statistics());
+    }
+};
+
+REGISTER_ROUTE(AdminController, GetConfiguration, "/admin/config", "GET"_method)
+REGISTER_ROUTE(AdminController, ReloadConfiguration, "/admin/config/reload", "POST"_method)
+REGISTER_ROUTE(AdminController, GetSlowQueries, "/admin/slow-queries", "GET"_method)
+REGISTER_ROUTE_WITH_POLICY(AdminController, GetCpuProfile, "/admin/profile/cpu", "GET"_method, route_policy::ADMIN_CAPTURE)
+REGISTER_ROUTE_WITH_POLICY(AdminController, GetLockProfile, "/admin/profile/locks", "GET"_method, route_policy::ADMIN_CAPTURE)
+REGISTER_ROUTE(AdminController, GetLocks, "/admin/locks", "GET"_method)
+#endif //TOURNAMENTS_ADMINCONTROLLER_HPP
@@ -0,0 +1,18 @@
+#ifndef RESTAPI_EXPORT_CONTROLLER_HPP
+#define RESTAPI_EXPORT_CONTROLLER_HPP
+
+#include <string>
+#include <memory>
+#include <crow.h>
+
+#include "delegate/IExportDelegate.hpp"
+
+class ExportController {
+    std::shared_ptr<IExportDelegate> exportDelegate;
+public:
+    explicit ExportController(const std::shared_ptr<IExportDelegate>& exportDelegate);
+    crow::response ExportTournament(const crow::request& request, const std::string& tournamentId);
+    crow::response ExportAll(const crow::request& request);
+};
+
+#endif /* RESTAPI_EXPORT_CONTROLLER_HPP */
@@ -10,6 +10,7 @@
 #include <crow.h>
 #include <nlohmann/json.hpp>
 
+#include "configuration/FinishedTournamentCache.hpp"
 #include "configuration/RouteDefinition.hpp"
 #include "delegate/IGroupDelegate.hpp"
 #include "domain/Group.hpp"
@@ -18,10 +19,11 @@
 class GroupController
 {
     std::shared_ptr<IGroupDelegate> groupDelegate;
+    std::shared_ptr<FinishedTournamentCache> finishedTournaments;
 public:
-    GroupController(const std::shared_ptr<IGroupDelegate>& delegate);
+    GroupController(const std::shared_ptr<IGroupDelegate>& delegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments);
     ~GroupController();
-    crow::response GetGroups(const std::string& tournamentId);
+    crow::response GetGroups(const crow::request& request, const std::string& tournamentId);
     crow::response GetGroup(const std::string& tournamentId, const std::string& groupId);
     crow::response CreateGroup(const crow::request& request, const std::string& tournamentId);
     crow::response UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId);
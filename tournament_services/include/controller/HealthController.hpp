@@ -5,14 +5,76 @@
 #ifndef TOURNAMENTS_HEALTHCONTROLLER_HPP
 #define TOURNAMENTS_HEALTHCONTROLLER_HPP
 
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
 #include "configuration/RouteDefinition.hpp"
+#include "configuration/Warmup.hpp"
+#include "resilience/AdmissionController.hpp"
+#include "resilience/CircuitBreakerRegistry.hpp"
 
 class HealthController {
+    std::shared_ptr<resilience::CircuitBreakerRegistry> circuitBreakers;
+    std::shared_ptr<resilience::AdmissionController> admission;
+    std::shared_ptr<Warmup> warmup;
     public:
+    HealthController(const std::shared_ptr<resilience::CircuitBreakerRegistry>& circuitBreakers, const std::shared_ptr<resilience::AdmissionController>& admission,
+                     const std::shared_ptr<Warmup>& warmup)
+        : circuitBreakers(circuitBreakers), admission(admission), warmup(warmup) {}
+
     crow::response GetHealth(){
         return crow::response{crow::OK, "Services running"};
     }
+
+    // Not ready while warming up, the balancer only routes to warm replicas. Dependency circuits do not
+    // count: every replica shares the database and the broker, so an outage would take all of them out
+    // of rotation at once and turn degraded answers into none. They are listed here and in /metrics.
+    crow::response GetReadiness() {
+        nlohmann::json dependencies = nlohmann::json::object();
+        for (const auto& snapshot : circuitBreakers->Snapshots()) {
+            dependencies[snapshot.name] = snapshot.state;
+        }
+        const bool ready = warmup->Done();
+        const nlohmann::json body = {{"status", ready ? "ready" : "unavailable"}, {"warmup", ready ? "done" : "running"}, {"dependencies", dependencies}};
+        crow::response response{ready ? crow::OK : crow::SERVICE_UNAVAILABLE, body.dump()};
+        response.add_header("content-type", "application/json");
+        return response;
+    }
+
+    // Prometheus text exposition of the circuit breakers and admission control
+    crow::response GetMetrics() {
+        const auto snapshots = circuitBreakers->Snapshots();
+        std::string body;
+        const auto family = [&](std::string_view metric, std::string_view type, auto value) {
+            body += std::format("# TYPE {} {}\n", metric, type);
+            for (const auto& snapshot : snapshots) {
+                body += std::format("{}{{name=\"{}\"}} {}\n", metric, snapshot.name, value(snapshot));
+            }
+        };
+        family("circuit_breaker_state", "gauge", [](const auto& snapshot) { return static_cast<int>(snapshot.state); });
+        family("circuit_breaker_failures_total", "counter", [](const auto& snapshot) { return snapshot.failures; });
+        family("circuit_breaker_rejected_total", "counter", [](const auto& snapshot) { return snapshot.rejected; });
+        family("circuit_breaker_opened_total", "counter", [](const auto& snapshot) { return snapshot.opened; });
+
+        const auto admitted = admission->Snapshot();
+        body += std::format("# TYPE admission_limit gauge\nadmission_limit {:.1f}\n", admitted.limit);
+        body += std::format("# TYPE admission_in_flight gauge\nadmission_in_flight {}\n", admitted.inFlight);
+        for (const auto& [metric, counts] : {std::pair{"admission_admitted_total", admitted.admitted}, std::pair{"admission_rejected_total", admitted.rejected}}) {
+            body += std::format("# TYPE {} counter\n", metric);
+            for (const auto priority : {resilience::Priority::CRITICAL, resilience::Priority::STANDARD, resilience::Priority::BULK}) {
+                body += std::format("{}{{priority=\"{}\"}} {}\n", metric, nlohmann::json(priority).get<std::string>(), counts[static_cast<size_t>(priority)]);
+            }
+        }
+        crow::response response{crow::OK, body};
+        response.add_header("content-type", "text/plain; version=0.0.4");
+        return response;
+    }
 };
 
-REGISTER_ROUTE(HealthController, GetHealth, "/health", "GET"_method)
-#endif //TOURNAMENTS_HEALTHCONTROLLER_HPP
\ No newline at end of file
+REGISTER_ROUTE_WITH_POLICY(HealthController, GetHealth, "/health", "GET"_method, route_policy::CRITICAL)
+REGISTER_ROUTE_WITH_POLICY(HealthController, GetReadiness, "/health/ready", "GET"_method, route_policy::CRITICAL)
+REGISTER_ROUTE_WITH_POLICY(HealthController, GetMetrics, "/metrics", "GET"_method, route_policy::CRITICAL)
+#endif //TOURNAMENTS_HEALTHCONTROLLER_HPP
@@ -0,0 +1,16 @@
+#ifndef RESTAPI_IMPORT_CONTROLLER_HPP
+#define RESTAPI_IMPORT_CONTROLLER_HPP
+
+#include <memory>
+#include <crow.h>
+
+#include "delegate/IImportDelegate.hpp"
+
+class ImportController {
+    std::shared_ptr<IImportDelegate> importDelegate;
+public:
+    explicit ImportController(const std::shared_ptr<IImportDelegate>& importDelegate);
+    crow::response Import(const crow::request& request);
+};
+
+#endif /* RESTAPI_IMPORT_CONTROLLER_HPP */
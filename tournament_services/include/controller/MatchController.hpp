@@ -7,15 +7,17 @@
 #include <memory>
 #include <regex>
 
+#include "configuration/FinishedTournamentCache.hpp"
 #include "delegate/IMatchDelegate.hpp"
 #include "domain/Constants.hpp"
 
 class MatchController {
     std::shared_ptr<IMatchDelegate> matchDelegate;
+    std::shared_ptr<FinishedTournamentCache> finishedTournaments;
 public:
-    explicit MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate);
+    MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments);
     crow::response getMatch(const std::string& tournamentId, const std::string& matchId);
-    crow::response getMatches(const std::string& tournamentId);
+    crow::response getMatches(const crow::request& request, const std::string& tournamentId);
     crow::response updateMatchScore(const crow::request& request, const std::string& tournamentId, const std::string& matchId);
 };
 
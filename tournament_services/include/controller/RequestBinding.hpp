@@ -0,0 +1,120 @@
+#ifndef RESTAPI_REQUEST_BINDING_HPP
+#define RESTAPI_REQUEST_BINDING_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace binding {
+    inline constexpr std::string_view INVALID_JSON = "Invalid JSON format";
+
+    enum class Type { OBJECT, ARRAY, STRING, INTEGER };
+
+    // One constraint on the body, addressed by JSON pointer. The pointer is parsed once when the
+    // endpoint schema is built, not on every request.
+    class Rule {
+        nlohmann::json::json_pointer pointer;
+        Type type;
+        std::string message;
+        bool required = true;
+        std::optional<int64_t> minimum;
+        std::optional<size_t> minLength;
+        std::optional<Type> elementType;
+
+        static bool is(const nlohmann::json& value, Type type) {
+            switch (type) {
+                case Type::OBJECT: return value.is_object();
+                case Type::ARRAY: return value.is_array();
+                case Type::STRING: return value.is_string();
+                case Type::INTEGER: return value.is_number_integer();
+            }
+            return false;
+        }
+    public:
+        Rule(std::string_view path, Type type, std::string_view message)
+            : pointer(std::string(path)), type(type), message(message) {}
+
+        Rule Optional() && { required = false; return std::move(*this); }
+        Rule Minimum(int64_t value) && { minimum = value; return std::move(*this); }
+        Rule MinLength(size_t value) && { minLength = value; return std::move(*this); }
+        Rule Each(Type value) && { elementType = value; return std::move(*this); }
+
+        [[nodiscard]] std::optional<std::string_view> Check(const nlohmann::json& body) const {
+            if (!body.contains(pointer)) {
+                return required ? std::optional<std::string_view>(message) : std::nullopt;
+            }
+            const auto& value = body.at(pointer);
+            if (!is(value, type)) {
+                return message;
+            }
+            if (minimum && value.get<int64_t>() < *minimum) {
+                return message;
+            }
+            if (minLength) {
+                const auto length = value.is_string() ? value.get_ref<const std::string&>().size() : value.size();
+                if (length < *minLength) {
+                    return message;
+                }
+            }
+            if (elementType) {
+                for (const auto& element : value) {
+                    if (!is(element, *elementType)) {
+                        return message;
+                    }
+                }
+            }
+            return std::nullopt;
+        }
+    };
+
+    // Rules are checked in declaration order and the first violation becomes the 400 body
+    using Schema = std::vector<Rule>;
+
+    inline std::optional<std::string_view> Validate(const nlohmann::json& body, const Schema& schema) {
+        for (const auto& rule : schema) {
+            if (auto violation = rule.Check(body)) {
+                return violation;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Parses the body exactly once (no accept() pre-pass), validates it against the endpoint schema
+    // and converts it into the request type with its from_json. The error is the 400 response body.
+    template<typename Type>
+    std::expected<Type, std::string> Bind(std::string_view body, const Schema& schema) {
+        auto json = nlohmann::json::parse(body, nullptr, false);
+        if (json.is_discarded()) {
+            return std::unexpected(std::string(INVALID_JSON));
+        }
+        if (auto violation = Validate(json, schema)) {
+            return std::unexpected(std::string(*violation));
+        }
+        try {
+            return json.template get<Type>();
+        } catch (const nlohmann::json::exception& e) {
+            return std::unexpected(std::string(INVALID_JSON));
+        }
+    }
+
+    // Unsigned query parameter: fallback when absent, nullopt when it is not a plain number
+    inline std::optional<size_t> QueryNumber(const char* value, size_t fallback) {
+        if (value == nullptr) {
+            return fallback;
+        }
+        const std::string_view text(value);
+        size_t number = 0;
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+        if (error != std::errc() || end != text.data() + text.size()) {
+            return std::nullopt;
+        }
+        return number;
+    }
+}
+
+#endif //RESTAPI_REQUEST_BINDING_HPP
@@ -11,16 +11,19 @@
 #include <memory>
 #include <regex>
 
+#include "configuration/FinishedTournamentCache.hpp"
 #include "delegate/ITeamDelegate.hpp"
 #include "domain/Constants.hpp"
 
 class TeamController {
     std::shared_ptr<ITeamDelegate> teamDelegate;
+    // cached groups show team names, a renamed or deleted team takes its tournaments out
+    std::shared_ptr<FinishedTournamentCache> finishedTournaments;
 public:
-    explicit TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate);
+    TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments);
 
     [[nodiscard]] crow::response getTeam(const std::string& teamId) const;
-    [[nodiscard]] crow::response getAllTeams() const;
+    [[nodiscard]] crow::response getAllTeams(const crow::request& request) const;
     [[nodiscard]] crow::response createTeam(const crow::request& request) const;
     [[nodiscard]] crow::response updateTeam(const crow::request& request, const std::string& teamId) const;
     [[nodiscard]] crow::response deleteTeam(const std::string& teamId) const;
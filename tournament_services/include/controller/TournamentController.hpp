@@ -9,19 +9,21 @@
 #include <memory>
 #include <crow.h>
 
+#include "configuration/FinishedTournamentCache.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "domain/Constants.hpp"
 
 class TournamentController {
     std::shared_ptr<ITournamentDelegate> tournamentDelegate;
+    std::shared_ptr<FinishedTournamentCache> finishedTournaments;
 public:
-    TournamentController(const std::shared_ptr<ITournamentDelegate>& delegate);
+    TournamentController(const std::shared_ptr<ITournamentDelegate>& delegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments);
     ~TournamentController();
 
-    crow::response getTournament(const std::string& tournamentId);
+    crow::response getTournament(const crow::request& request, const std::string& tournamentId);
     crow::response updateTournament(const crow::request& request, const std::string& tournamentId);
     crow::response CreateTournament(const crow::request& request);
-    crow::response ReadAll();
+    crow::response ReadAll(const crow::request& request);
     crow::response deleteTournament(const std::string& tournamentId);
 };
 
@@ -0,0 +1,23 @@
+#ifndef SERVICE_EXPORT_DELEGATE_HPP
+#define SERVICE_EXPORT_DELEGATE_HPP
+
+#include <memory>
+#include <string_view>
+#include <expected>
+
+#include "delegate/IExportDelegate.hpp"
+#include "domain/Tournament.hpp"
+#include "exception/Error.hpp"
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/IExportRepository.hpp"
+
+class ExportDelegate : public IExportDelegate {
+    std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
+    std::shared_ptr<IExportRepository> exportRepository;
+public:
+    ExportDelegate(const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepository, const std::shared_ptr<IExportRepository>& exportRepository);
+    std::expected<void, Error> ExportTournament(std::string_view tournamentId, ExportFormat format, const ExportSink& sink) override;
+    std::expected<void, Error> ExportAll(ExportFormat format, const ExportSink& sink) override;
+};
+
+#endif /* SERVICE_EXPORT_DELEGATE_HPP */
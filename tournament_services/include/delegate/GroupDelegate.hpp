@@ -12,6 +12,7 @@
 #include "persistence/repository/IGroupRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/ITeamDictionary.hpp"
 #include "exception/Error.hpp"
 #include "domain/Constants.hpp"
 #include "cms/IQueueMessageProducer.hpp"
@@ -21,11 +22,12 @@ class GroupDelegate : public IGroupDelegate{
     std::shared_ptr<IGroupRepository> groupRepository;
     std::shared_ptr<TeamRepository> teamRepository;
     std::shared_ptr<IQueueMessageProducer> messageProducer;
+    std::shared_ptr<ITeamDictionary> teamDictionary;
 
 public:
-    GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer);
+    GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer, const std::shared_ptr<ITeamDictionary>& teamDictionary);
     std::expected<std::shared_ptr<domain::Group>, Error> GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) override;
-    std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GetGroups(const std::string_view& tournamentId) override;
+    std::expected<std::vector<domain::Group>, Error> GetGroups(const std::string_view& tournamentId) override;
     std::expected<std::string, Error> CreateGroup(const std::string_view& tournamentId, const domain::Group& group) override;
     std::expected<void, Error> UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId) override;
     std::expected<void, Error> UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& team) override;
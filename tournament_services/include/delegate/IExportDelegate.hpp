@@ -0,0 +1,17 @@
+#ifndef SERVICE_IEXPORT_DELEGATE_HPP
+#define SERVICE_IEXPORT_DELEGATE_HPP
+
+#include <string_view>
+#include <expected>
+
+#include "persistence/repository/IExportRepository.hpp"
+#include "exception/Error.hpp"
+
+class IExportDelegate {
+public:
+    virtual ~IExportDelegate() = default;
+    virtual std::expected<void, Error> ExportTournament(std::string_view tournamentId, ExportFormat format, const ExportSink& sink) = 0;
+    virtual std::expected<void, Error> ExportAll(ExportFormat format, const ExportSink& sink) = 0;
+};
+
+#endif /* SERVICE_IEXPORT_DELEGATE_HPP */
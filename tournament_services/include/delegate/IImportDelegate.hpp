@@ -0,0 +1,16 @@
+#ifndef SERVICE_IIMPORT_DELEGATE_HPP
+#define SERVICE_IIMPORT_DELEGATE_HPP
+
+#include <string_view>
+#include <expected>
+
+#include "persistence/repository/IImportRepository.hpp"
+#include "exception/Error.hpp"
+
+class IImportDelegate {
+public:
+    virtual ~IImportDelegate() = default;
+    virtual std::expected<ImportSummary, Error> Import(std::string_view ndjson) = 0;
+};
+
+#endif /* SERVICE_IIMPORT_DELEGATE_HPP */
@@ -15,7 +15,8 @@ public:
     virtual ~ITeamDelegate() = default;
 
     virtual std::expected<std::shared_ptr<domain::Team>, Error> GetTeam(std::string_view id) = 0;
-    virtual std::expected<std::vector<std::shared_ptr<domain::Team>>, Error> GetAllTeams() = 0;
+    virtual std::expected<std::vector<domain::Team>, Error> GetAllTeams() = 0;
+    virtual std::expected<std::vector<domain::Team>, Error> SearchTeams(std::string_view query, size_t limit) = 0;
     virtual std::expected<std::string, Error> CreateTeam(const domain::Team& team) = 0;
     virtual std::expected<std::string, Error> UpdateTeam(const domain::Team& team) = 0;
     virtual std::expected<void, Error> DeleteTeam(std::string_view id) = 0;
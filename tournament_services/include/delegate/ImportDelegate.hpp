@@ -0,0 +1,19 @@
+#ifndef SERVICE_IMPORT_DELEGATE_HPP
+#define SERVICE_IMPORT_DELEGATE_HPP
+
+#include <memory>
+#include <string_view>
+#include <expected>
+
+#include "delegate/IImportDelegate.hpp"
+#include "exception/Error.hpp"
+#include "persistence/repository/IImportRepository.hpp"
+
+class ImportDelegate : public IImportDelegate {
+    std::shared_ptr<IImportRepository> importRepository;
+public:
+    explicit ImportDelegate(const std::shared_ptr<IImportRepository>& importRepository);
+    std::expected<ImportSummary, Error> Import(std::string_view ndjson) override;
+};
+
+#endif /* SERVICE_IMPORT_DELEGATE_HPP */
@@ -19,7 +19,7 @@ class MatchDelegate : public IMatchDelegate {
 public:
     explicit MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer);
     std::expected<std::shared_ptr<domain::Match>, Error> GetMatch(std::string_view tournamentId, std::string_view matchId) override;
-    std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> GetMatches(std::string_view tournamentId) override;
+    std::expected<std::vector<domain::Match>, Error> GetMatches(std::string_view tournamentId) override;
     std::expected<std::string, Error> UpdateMatchScore(const domain::Match& match) override;
 };  
 
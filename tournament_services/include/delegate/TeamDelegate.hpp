@@ -7,15 +7,19 @@
 #include <expected>
 
 #include "domain/Team.hpp"
+#include "persistence/repository/INameSearch.hpp"
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamDictionary.hpp"
 #include "exception/Error.hpp"
 #include "delegate/ITeamDelegate.hpp"
 
 class TeamDelegate : public ITeamDelegate { // changed: now implements ITeamDelegate
 public:
-    TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string_view>> repository);
+    TeamDelegate(std::shared_ptr<IRepository<domain::Team, std::string_view>> repository, std::shared_ptr<ITeamDictionary> teamDictionary,
+                 std::shared_ptr<INameSearch<domain::Team>> teamSearch);
 
-    std::expected<std::vector<std::shared_ptr<domain::Team>>, Error> GetAllTeams() override;
+    std::expected<std::vector<domain::Team>, Error> GetAllTeams() override;
+    std::expected<std::vector<domain::Team>, Error> SearchTeams(std::string_view query, size_t limit) override;
     std::expected<std::shared_ptr<domain::Team>, Error> GetTeam(std::string_view id) override;
     std::expected<std::string, Error> CreateTeam(const domain::Team& team) override;
     std::expected<std::string, Error> UpdateTeam(const domain::Team& team) override;
@@ -23,4 +27,6 @@ public:
 
 private:
     std::shared_ptr<IRepository<domain::Team, std::string_view>> teamRepository;
+    std::shared_ptr<ITeamDictionary> teamDictionary;
+    std::shared_ptr<INameSearch<domain::Team>> teamSearch;
 };
\ No newline at end of file
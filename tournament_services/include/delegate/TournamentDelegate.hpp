@@ -9,15 +9,18 @@
 
 #include "domain/Tournament.hpp"
 #include "exception/Error.hpp"
+#include "persistence/repository/INameSearch.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "delegate/ITournamentDelegate.hpp"
 #include "domain/Constants.hpp"
 
 class TournamentDelegate : public ITournamentDelegate {
 public:
-    TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> repository);
+    TournamentDelegate(std::shared_ptr<IRepository<domain::Tournament, std::string>> repository,
+                       std::shared_ptr<INameSearch<domain::Tournament>> tournamentSearch);
 
-    std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error> ReadAll() override;
+    std::expected<std::vector<domain::Tournament>, Error> ReadAll() override;
+    std::expected<std::vector<domain::Tournament>, Error> SearchTournaments(std::string_view query, size_t limit) override;
     std::expected<std::shared_ptr<domain::Tournament>, Error> GetTournament(std::string_view id) override;
     std::expected<std::string, Error> CreateTournament(const domain::Tournament& tournament) override;
     std::expected<std::string, Error> UpdateTournament(const domain::Tournament& tournament) override;
@@ -25,6 +28,7 @@ public:
 
 private:
     std::shared_ptr<IRepository<domain::Tournament, std::string>> tournamentRepository;
+    std::shared_ptr<INameSearch<domain::Tournament>> tournamentSearch;
 };
 
 
@@ -16,6 +16,9 @@ int main() {
     }
 
     auto appConfig = container->resolve<config::RunConfiguration>();
+    container->resolve<config::ConfigurationWatcher>()->Start();
+    // readiness stays unavailable until this is done, liveness answers right away
+    container->resolve<Warmup>()->Start();
 
     app.port(appConfig->port)
         .concurrency(appConfig->concurrency)
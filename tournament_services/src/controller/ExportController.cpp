@@ -0,0 +1,114 @@
+#define CONTENT_TYPE_HEADER "content-type"
+#define CONTENT_DISPOSITION_HEADER "content-disposition"
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/ExportController.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string_view>
+
+#include "exception/Error.hpp"
+
+namespace {
+  // Spooled exports are served by Crow after the handler returns, so they are swept on later exports
+  constexpr auto SPOOL_RETENTION = std::chrono::minutes(15);
+  std::atomic<unsigned long> spoolSequence{0};
+
+  std::filesystem::path spoolDirectory() {
+    auto directory = std::filesystem::temp_directory_path() / "tournament_exports";
+    std::filesystem::create_directories(directory);
+    return directory;
+  }
+
+  void sweepSpool(const std::filesystem::path& directory) {
+    std::error_code error;
+    const auto threshold = std::filesystem::file_time_type::clock::now() - SPOOL_RETENTION;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+      if (entry.is_regular_file(error) && entry.last_write_time(error) < threshold) {
+        std::filesystem::remove(entry.path(), error);
+      }
+    }
+  }
+}
+
+ExportController::ExportController(const std::shared_ptr<IExportDelegate>& exportDelegate) : exportDelegate(exportDelegate) {}
+
+static int mapErrorToStatus(const Error err) {
+  switch (err) {
+    case Error::NOT_FOUND: return crow::NOT_FOUND;
+    case Error::INVALID_FORMAT: return crow::BAD_REQUEST;
+    default: return crow::INTERNAL_SERVER_ERROR;
+  }
+}
+
+// ?format=ndjson (default) or ?format=csv
+static std::optional<ExportFormat> formatFromRequest(const crow::request& request) {
+  const char* format = request.url_params.get("format");
+  if (format == nullptr || std::string_view{format} == "ndjson") {
+    return ExportFormat::NDJSON;
+  }
+  if (std::string_view{format} == "csv") {
+    return ExportFormat::CSV;
+  }
+  return std::nullopt;
+}
+
+// Crow has no chunked body callback, rows are written to a spool file as they come off the
+// COPY stream and Crow sends that file in fixed-size chunks, keeping memory flat for any export size.
+template<typename Export>
+static crow::response spoolExport(ExportFormat format, const std::string& fileName, Export&& runExport) {
+  const auto directory = spoolDirectory();
+  sweepSpool(directory);
+
+  const std::string extension = format == ExportFormat::CSV ? ".csv" : ".ndjson";
+  const auto path = directory / (fileName + "-" + std::to_string(spoolSequence++) + extension);
+
+  std::expected<void, Error> result;
+  {
+    std::ofstream spool(path, std::ios::binary | std::ios::trunc);
+    result = runExport([&spool](std::string_view line) {
+      spool.write(line.data(), static_cast<std::streamsize>(line.size()));
+    });
+  }
+  if (!result) {
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    return crow::response{mapErrorToStatus(result.error()), "Error"};
+  }
+
+  crow::response response{crow::OK};
+  response.set_static_file_info_unsafe(path.string());
+  response.set_header(CONTENT_TYPE_HEADER, format == ExportFormat::CSV ? "text/csv" : "application/x-ndjson");
+  response.set_header(CONTENT_DISPOSITION_HEADER, "attachment; filename=\"" + fileName + extension + "\"");
+  return response;
+}
+
+crow::response ExportController::ExportTournament(const crow::request& request, const std::string& tournamentId) {
+  const auto format = formatFromRequest(request);
+  if (!format) {
+    return crow::response{crow::BAD_REQUEST, "Unsupported export format"};
+  }
+
+  return spoolExport(*format, "tournament", [&](const ExportSink& sink) {
+    return exportDelegate->ExportTournament(tournamentId, *format, sink);
+  });
+}
+
+crow::response ExportController::ExportAll(const crow::request& request) {
+  const auto format = formatFromRequest(request);
+  if (!format) {
+    return crow::response{crow::BAD_REQUEST, "Unsupported export format"};
+  }
+
+  return spoolExport(*format, "tournaments", [&](const ExportSink& sink) {
+    return exportDelegate->ExportAll(*format, sink);
+  });
+}
+
+REGISTER_ROUTE_WITH_POLICY(ExportController, ExportTournament, "/tournaments/<string>/export", "GET"_method, route_policy::EXPORT)
+REGISTER_ROUTE_WITH_POLICY(ExportController, ExportAll, "/exports/tournaments", "GET"_method, route_policy::EXPORT)
@@ -3,6 +3,7 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "controller/GroupController.hpp"
+#include "controller/RequestBinding.hpp"
 
 #include "configuration/RouteDefinition.hpp"
 #include "domain/Utilities.hpp"
@@ -12,7 +13,22 @@
 #include "exception/Error.hpp"
 #include <iostream>
 
-GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate) : groupDelegate(std::move(delegate)) {}
+namespace {
+    const binding::Schema GROUP_SCHEMA = {
+        binding::Rule("", binding::Type::OBJECT, "Request body must be a JSON object"),
+        binding::Rule("/name", binding::Type::STRING, "name is required").MinLength(1),
+        binding::Rule("/id", binding::Type::STRING, "id must be a string").Optional(),
+        binding::Rule("/tournamentId", binding::Type::STRING, "tournamentId must be a string").Optional(),
+        binding::Rule("/teams", binding::Type::ARRAY, "teams must be an array of objects").Optional().Each(binding::Type::OBJECT),
+    };
+
+    const binding::Schema TEAMS_SCHEMA = {
+        binding::Rule("", binding::Type::ARRAY, "Request body must be an array of teams").Each(binding::Type::OBJECT),
+    };
+}
+
+GroupController::GroupController(const std::shared_ptr<IGroupDelegate>& delegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments)
+    : groupDelegate(std::move(delegate)), finishedTournaments(finishedTournaments) {}
 
 GroupController::~GroupController()
 {
@@ -28,10 +44,22 @@ static int mapErrorToStatus(const Error err) {
   }
 }
 
-crow::response GroupController::GetGroups(const std::string& tournamentId){
+crow::response GroupController::GetGroups(const crow::request& request, const std::string& tournamentId){
+    if (const auto cached = finishedTournaments->Find(tournamentId, CachedResource::GROUPS)) {
+        return finishedTournaments->Respond(request, *cached);
+    }
     auto groups = this->groupDelegate->GetGroups(tournamentId);
     if (groups) {
         const nlohmann::json body = *groups;
+        std::vector<std::string> teamIds;
+        for (const auto& group : *groups) {
+            for (const auto& team : group.Teams()) {
+                teamIds.push_back(team.Id);
+            }
+        }
+        if (const auto stored = finishedTournaments->Store(tournamentId, CachedResource::GROUPS, body.dump(), teamIds)) {
+            return finishedTournaments->Respond(request, *stored);
+        }
         crow::response response{crow::OK, body.dump()};
         response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
         return response;
@@ -51,11 +79,14 @@ crow::response GroupController::GetGroup(const std::string& tournamentId, const
 }
 
 crow::response GroupController::CreateGroup(const crow::request& request, const std::string& tournamentId){
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Group group = requestBody;
+    auto group = binding::Bind<domain::Group>(request.body, GROUP_SCHEMA);
+    if (!group) {
+        return crow::response{crow::BAD_REQUEST, group.error()};
+    }
 
-    auto groupId = groupDelegate->CreateGroup(tournamentId, group);
+    auto groupId = groupDelegate->CreateGroup(tournamentId, *group);
     if (groupId) {
+        finishedTournaments->Evict(tournamentId);
         crow::response response;
         response.add_header("location", *groupId);
         response.code = crow::CREATED;
@@ -65,11 +96,14 @@ crow::response GroupController::CreateGroup(const crow::request& request, const
 }
 
 crow::response GroupController::UpdateGroup(const crow::request& request, const std::string& tournamentId, const std::string& groupId) {
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Group group = requestBody;
+    auto group = binding::Bind<domain::Group>(request.body, GROUP_SCHEMA);
+    if (!group) {
+        return crow::response{crow::BAD_REQUEST, group.error()};
+    }
 
-    auto result = groupDelegate->UpdateGroup(tournamentId, group, groupId);
+    auto result = groupDelegate->UpdateGroup(tournamentId, *group, groupId);
     if (result) {
+        finishedTournaments->Evict(tournamentId);
         crow::response response{crow::NO_CONTENT};
         return response;
     }
@@ -77,11 +111,14 @@ crow::response GroupController::UpdateGroup(const crow::request& request, const
 }
 
 crow::response GroupController::AddTeams(const crow::request& request, const std::string& tournamentId, const std::string& groupId) {
-    auto requestBody = nlohmann::json::parse(request.body);
-    std::vector<domain::Team> teams = requestBody.get<std::vector<domain::Team>>();
+    auto teams = binding::Bind<std::vector<domain::Team>>(request.body, TEAMS_SCHEMA);
+    if (!teams) {
+        return crow::response{crow::BAD_REQUEST, teams.error()};
+    }
 
-    const auto result = groupDelegate->UpdateTeams(tournamentId, groupId, teams);
+    const auto result = groupDelegate->UpdateTeams(tournamentId, groupId, *teams);
     if (result) {
+        finishedTournaments->Evict(tournamentId);
         crow::response response{crow::NO_CONTENT};
         return response;
     }
@@ -91,6 +128,7 @@ crow::response GroupController::AddTeams(const crow::request& request, const std
 crow::response GroupController::RemoveGroup(const std::string& tournamentId, const std::string& groupId) {
     auto result = this->groupDelegate->RemoveGroup(tournamentId, groupId);
     if (result) {
+        finishedTournaments->Evict(tournamentId);
         crow::response response{crow::NO_CONTENT};
         response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
         return response;
@@ -98,8 +136,8 @@ crow::response GroupController::RemoveGroup(const std::string& tournamentId, con
     return crow::response{ mapErrorToStatus(result.error()), "Error" };
 }
 
-REGISTER_ROUTE(GroupController, GetGroups, "/tournaments/<string>/groups", "GET"_method) 
-REGISTER_ROUTE(GroupController, GetGroup, "/tournaments/<string>/groups/<string>", "GET"_method)
+REGISTER_ROUTE_WITH_POLICY(GroupController, GetGroups, "/tournaments/<string>/groups", "GET"_method, route_policy::BRACKET_READ)
+REGISTER_ROUTE_WITH_POLICY(GroupController, GetGroup, "/tournaments/<string>/groups/<string>", "GET"_method, route_policy::BRACKET_READ)
 REGISTER_ROUTE(GroupController, CreateGroup, "/tournaments/<string>/groups", "POST"_method)
 REGISTER_ROUTE(GroupController, UpdateGroup, "/tournaments/<string>/groups/<string>", "PATCH"_method)
 REGISTER_ROUTE(GroupController, AddTeams, "/tournaments/<string>/groups/<string>/teams", "PATCH"_method)
@@ -0,0 +1,33 @@
+#define JSON_CONTENT_TYPE "application/json"
+#define CONTENT_TYPE_HEADER "content-type"
+
+#include "configuration/RouteDefinition.hpp"
+#include "controller/ImportController.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include "exception/Error.hpp"
+
+ImportController::ImportController(const std::shared_ptr<IImportDelegate>& importDelegate) : importDelegate(importDelegate) {}
+
+static int mapErrorToStatus(const Error err) {
+  switch (err) {
+    case Error::INVALID_FORMAT: return crow::BAD_REQUEST;
+    default: return crow::INTERNAL_SERVER_ERROR;
+  }
+}
+
+// Body is NDJSON, one team, tournament or group per line (see ImportRepository)
+crow::response ImportController::Import(const crow::request& request) {
+  auto res = importDelegate->Import(request.body);
+  if (!res) {
+    return crow::response{mapErrorToStatus(res.error()), "Error"};
+  }
+
+  const nlohmann::json body = *res;
+  crow::response response{crow::OK, body.dump()};
+  response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
+  return response;
+}
+
+REGISTER_ROUTE_WITH_POLICY(ImportController, Import, "/imports", "POST"_method, route_policy::IMPORT)
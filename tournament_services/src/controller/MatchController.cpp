@@ -5,11 +5,25 @@
 #include "controller/MatchController.hpp"
 
 #include "configuration/RouteDefinition.hpp"
+#include "controller/RequestBinding.hpp"
 #include "domain/Utilities.hpp"
 #include "exception/Error.hpp"
 #include <iostream>
 
-MatchController::MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate) : matchDelegate(matchDelegate) {}
+namespace {
+  const binding::Schema UPDATE_MATCH_SCORE_SCHEMA = {
+    binding::Rule("/score", binding::Type::OBJECT, "Missing or invalid score object"),
+    binding::Rule("/score/homeTeamScore", binding::Type::INTEGER, "score must contain integer homeTeamScore and visitorTeamScore"),
+    binding::Rule("/score/visitorTeamScore", binding::Type::INTEGER, "score must contain integer homeTeamScore and visitorTeamScore"),
+    binding::Rule("/score/homeTeamScore", binding::Type::INTEGER, "Scores must be non-negative").Minimum(0),
+    binding::Rule("/score/visitorTeamScore", binding::Type::INTEGER, "Scores must be non-negative").Minimum(0),
+    binding::Rule("/id", binding::Type::STRING, "id must be a string").Optional(),
+    binding::Rule("/tournamentId", binding::Type::STRING, "tournamentId must be a string").Optional(),
+  };
+}
+
+MatchController::MatchController(const std::shared_ptr<IMatchDelegate>& matchDelegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments)
+  : matchDelegate(matchDelegate), finishedTournaments(finishedTournaments) {}
 
 static int mapErrorToStatus(const Error err) {
   switch (err) {
@@ -21,15 +35,21 @@ static int mapErrorToStatus(const Error err) {
 }
 
 
-crow::response MatchController::getMatches(const std::string& tournamentId) {
+crow::response MatchController::getMatches(const crow::request& request, const std::string& tournamentId) {
+  if (const auto cached = finishedTournaments->Find(tournamentId, CachedResource::MATCHES)) {
+    return finishedTournaments->Respond(request, *cached);
+  }
   auto res = matchDelegate->GetMatches(tournamentId);
   if (res) {
     nlohmann::json arr = nlohmann::json::array();
-    for (const auto& matchptr : *res) {
-      if (matchptr) {
-        arr.push_back(*matchptr);
-      } else {
-        arr.push_back(nullptr);
+    for (const auto& match : *res) {
+      arr.push_back(match);
+    }
+    // the match list is where a decided bracket is noticed, from then on snapshot and groups are cached too
+    if (domain::IsBracketFinished(*res)) {
+      finishedTournaments->MarkFinished(tournamentId);
+      if (const auto stored = finishedTournaments->Store(tournamentId, CachedResource::MATCHES, arr.dump())) {
+        return finishedTournaments->Respond(request, *stored);
       }
     }
     auto response = crow::response{crow::OK, arr.dump()};
@@ -54,58 +74,32 @@ crow::response MatchController::getMatch(const std::string& tournamentId, const
 
 crow::response MatchController::updateMatchScore(const crow::request& request, const std::string& tournamentId, const std::string& matchId) {
   crow::response response;
-  if (!nlohmann::json::accept(request.body)) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Invalid JSON format";
-    return response;
-  }
-
-  auto requestBody = nlohmann::json::parse(request.body);
-
-  // Basic JSON shape validation for score
-  if (!requestBody.contains("score") || !requestBody["score"].is_object()) {
+  auto matchObj = binding::Bind<domain::Match>(request.body, UPDATE_MATCH_SCORE_SCHEMA);
+  if (!matchObj) {
     response.code = crow::BAD_REQUEST;
-    response.body = "Missing or invalid score object";
+    response.body = matchObj.error();
     return response;
   }
 
-  auto& scoreJson = requestBody["score"];
-  if (!scoreJson.contains("homeTeamScore") || !scoreJson.contains("visitorTeamScore") ||
-      !scoreJson["homeTeamScore"].is_number_integer() || !scoreJson["visitorTeamScore"].is_number_integer()) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "score must contain integer homeTeamScore and visitorTeamScore";
-    return response;
-  }
-
-  int home = scoreJson["homeTeamScore"].get<int>();
-  int visitor = scoreJson["visitorTeamScore"].get<int>();
-  if (home < 0 || visitor < 0) {
-    response.code = crow::BAD_REQUEST;
-    response.body = "Scores must be non-negative";
-    return response;
-  }
-
-  // Deserialize into domain::Match (assumes nlohmann conversion exists)
-  domain::Match matchObj = requestBody;
-
   // Ensure tournamentId matches path or is filled
-  if (!matchObj.TournamentId().empty() && matchObj.TournamentId() != tournamentId) {
+  if (!matchObj->TournamentId().empty() && matchObj->TournamentId() != tournamentId) {
     response.code = crow::BAD_REQUEST;
     response.body = "Tournament ID in body does not match path";
     return response;
   }
-  matchObj.TournamentId() = tournamentId;
+  matchObj->TournamentId() = tournamentId;
 
   // Allow empty ID (client didn't set it) or ID equal to path; reject otherwise
-  if (!matchObj.Id().empty() && matchObj.Id() != matchId) {
+  if (!matchObj->Id().empty() && matchObj->Id() != matchId) {
     response.code = crow::BAD_REQUEST;
     response.body = "Match ID in body does not match path";
     return response;
   }
-  matchObj.Id() = matchId;
+  matchObj->Id() = matchId;
 
-  auto res = matchDelegate->UpdateMatchScore(matchObj);
+  auto res = matchDelegate->UpdateMatchScore(*matchObj);
   if (res) {
+    finishedTournaments->Evict(tournamentId);
     response.code = crow::OK;
     response.body = *res;
     response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
@@ -117,6 +111,6 @@ crow::response MatchController::updateMatchScore(const crow::request& request, c
   return response;
 }
 
-REGISTER_ROUTE(MatchController, getMatches, "/tournaments/<string>/matches", "GET"_method)
-REGISTER_ROUTE(MatchController, getMatch, "/tournaments/<string>/matches/<string>", "GET"_method)
-REGISTER_ROUTE(MatchController, updateMatchScore, "/tournaments/<string>/matches/<string>", "PATCH"_method)
+REGISTER_ROUTE_WITH_POLICY(MatchController, getMatches, "/tournaments/<string>/matches", "GET"_method, route_policy::BRACKET_READ)
+REGISTER_ROUTE_WITH_POLICY(MatchController, getMatch, "/tournaments/<string>/matches/<string>", "GET"_method, route_policy::BRACKET_READ)
+REGISTER_ROUTE_WITH_POLICY(MatchController, updateMatchScore, "/tournaments/<string>/matches/<string>", "PATCH"_method, route_policy::CRITICAL)
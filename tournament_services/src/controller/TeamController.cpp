@@ -3,13 +3,23 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TeamController.hpp"
+#include "controller/RequestBinding.hpp"
 
 #include "configuration/RouteDefinition.hpp"
 #include "domain/Utilities.hpp"
 #include "exception/Error.hpp"
 #include <iostream>
 
-TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate) : teamDelegate(teamDelegate) {}
+namespace {
+  const binding::Schema TEAM_SCHEMA = {
+    binding::Rule("", binding::Type::OBJECT, "Request body must be a JSON object"),
+    binding::Rule("/name", binding::Type::STRING, "name is required").MinLength(1),
+    binding::Rule("/id", binding::Type::STRING, "id must be a string").Optional(),
+  };
+}
+
+TeamController::TeamController(const std::shared_ptr<ITeamDelegate>& teamDelegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments)
+  : teamDelegate(teamDelegate), finishedTournaments(finishedTournaments) {}
 
 static int mapErrorToStatus(const Error err) {
   switch (err) {
@@ -21,7 +31,7 @@ static int mapErrorToStatus(const Error err) {
 }
 
 crow::response TeamController::getTeam(const std::string& teamId) const {
-  if (!std::regex_match(teamId, ID_VALUE)) {
+  if (!IsValidId(teamId)) {
     return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
   }
 
@@ -36,16 +46,21 @@ crow::response TeamController::getTeam(const std::string& teamId) const {
   }
 }
 
-crow::response TeamController::getAllTeams() const {
-  auto res = teamDelegate->GetAllTeams();
+crow::response TeamController::getAllTeams(const crow::request& request) const {
+  // ?q= answers the registration typeahead from the trigram index, otherwise the full list
+  const char* query = request.url_params.get("q");
+  std::optional<size_t> limit;
+  if (query != nullptr) {
+    limit = binding::QueryNumber(request.url_params.get("limit"), DEFAULT_SEARCH_LIMIT);
+    if (!limit) {
+      return crow::response{crow::BAD_REQUEST, "limit must be a positive number"};
+    }
+  }
+  auto res = query != nullptr ? teamDelegate->SearchTeams(query, *limit) : teamDelegate->GetAllTeams();
   if (res) {
     nlohmann::json arr = nlohmann::json::array();
-    for (const auto& teamptr : *res) {
-      if (teamptr) {
-        arr.push_back(*teamptr);
-      } else {
-        arr.push_back(nullptr);
-      }
+    for (const auto& team : *res) {
+      arr.push_back(team);
     }
     auto response = crow::response{crow::OK, arr.dump()};
     response.add_header("Content-Type", "application/json");
@@ -58,14 +73,14 @@ crow::response TeamController::getAllTeams() const {
 crow::response TeamController::createTeam(const crow::request& request) const {
   crow::response response;
 
-  if (!nlohmann::json::accept(request.body)) {
+  auto team = binding::Bind<domain::Team>(request.body, TEAM_SCHEMA);
+  if (!team) {
     response.code = crow::BAD_REQUEST;
+    response.body = team.error();
     return response;
   }
-  auto requestBody = nlohmann::json::parse(request.body);
-  domain::Team team = requestBody;
 
-  auto res = teamDelegate->CreateTeam(team);
+  auto res = teamDelegate->CreateTeam(*team);
   if (res) {
     response.code = crow::CREATED;
     response.body = *res;
@@ -80,24 +95,23 @@ crow::response TeamController::createTeam(const crow::request& request) const {
 
 crow::response TeamController::updateTeam(const crow::request& request, const std::string& teamId) const {
   crow::response response;
-  if (!nlohmann::json::accept(request.body)) {
+  auto teamObj = binding::Bind<domain::Team>(request.body, TEAM_SCHEMA);
+  if (!teamObj) {
     response.code = crow::BAD_REQUEST;
-    response.body = "Invalid JSON format";
+    response.body = teamObj.error();
     return response;
   }
 
-  auto requestBody = nlohmann::json::parse(request.body);
-  domain::Team teamObj = requestBody;
-
-  if (!teamObj.Id.empty()) {
+  if (!teamObj->Id.empty()) {
     response.code = crow::BAD_REQUEST;
     response.body = "ID is not editable";
     return response;
   }
-  teamObj.Id = teamId;
+  teamObj->Id = teamId;
 
-  auto res = teamDelegate->UpdateTeam(teamObj);
+  auto res = teamDelegate->UpdateTeam(*teamObj);
   if (res) {
+    finishedTournaments->EvictTeam(teamId);
     response.code = crow::OK;
     response.body = *res;
     response.add_header("Content-Type", "application/json");
@@ -112,7 +126,7 @@ crow::response TeamController::updateTeam(const crow::request& request, const st
 crow::response TeamController::deleteTeam(const std::string& teamId) const {
   crow::response response;
 
-  if (!std::regex_match(teamId, ID_VALUE)) {
+  if (!IsValidId(teamId)) {
     response.code = crow::BAD_REQUEST;
     response.body = "Invalid ID format";
     return response;
@@ -120,6 +134,7 @@ crow::response TeamController::deleteTeam(const std::string& teamId) const {
 
   auto res = teamDelegate->DeleteTeam(teamId);
   if (res) {
+    finishedTournaments->EvictTeam(teamId);
     response.code = crow::NO_CONTENT;
     response.body = "";
   } else {
@@ -131,7 +146,7 @@ crow::response TeamController::deleteTeam(const std::string& teamId) const {
 }
 
 REGISTER_ROUTE(TeamController, getTeam, "/teams/<string>", "GET"_method)
-REGISTER_ROUTE(TeamController, getAllTeams, "/teams", "GET"_method)
+REGISTER_ROUTE_WITH_POLICY(TeamController, getAllTeams, "/teams", "GET"_method, route_policy::BULK_LIST)
 REGISTER_ROUTE(TeamController, createTeam, "/teams", "POST"_method)
 REGISTER_ROUTE(TeamController, updateTeam, "/teams/<string>", "PATCH"_method)
 REGISTER_ROUTE(TeamController, deleteTeam, "/teams/<string>", "DELETE"_method)
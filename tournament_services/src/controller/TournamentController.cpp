@@ -7,6 +7,7 @@
 
 #include "configuration/RouteDefinition.hpp"
 #include "controller/TournamentController.hpp"
+#include "controller/RequestBinding.hpp"
 #include "exception/Error.hpp"
 #include "domain/Tournament.hpp"
 #include "domain/Utilities.hpp"
@@ -16,8 +17,21 @@
 #include <nlohmann/json.hpp>
 #include <iostream>
 
-TournamentController::TournamentController(const std::shared_ptr<ITournamentDelegate>& delegate)
-    : tournamentDelegate(delegate) {}
+namespace {
+    const binding::Schema TOURNAMENT_SCHEMA = {
+        binding::Rule("", binding::Type::OBJECT, "Request body must be a JSON object"),
+        binding::Rule("/name", binding::Type::STRING, "name is required").MinLength(1),
+        binding::Rule("/id", binding::Type::STRING, "id must be a string").Optional(),
+        binding::Rule("/format", binding::Type::OBJECT, "format must be an object").Optional(),
+        binding::Rule("/format/numberOfGroups", binding::Type::INTEGER, "format.numberOfGroups must be a positive integer").Optional().Minimum(1),
+        binding::Rule("/format/maxTeamsPerGroup", binding::Type::INTEGER, "format.maxTeamsPerGroup must be a positive integer").Optional().Minimum(1),
+        binding::Rule("/format/qualifiersPerGroup", binding::Type::INTEGER, "format.qualifiersPerGroup must be a positive integer").Optional().Minimum(1),
+        binding::Rule("/format/type", binding::Type::STRING, "format.type must be a string").Optional(),
+    };
+}
+
+TournamentController::TournamentController(const std::shared_ptr<ITournamentDelegate>& delegate, const std::shared_ptr<FinishedTournamentCache>& finishedTournaments)
+    : tournamentDelegate(delegate), finishedTournaments(finishedTournaments) {}
 
 TournamentController::~TournamentController() {}
 
@@ -30,14 +44,20 @@ static int mapErrorToStatus(const Error err) {
     }
 }
 
-crow::response TournamentController::getTournament(const std::string& tournamentId) {
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
+crow::response TournamentController::getTournament(const crow::request& request, const std::string& tournamentId) {
+    if (!IsValidId(tournamentId)) {
         return crow::response{crow::BAD_REQUEST, "Invalid ID format"};
     }
+    if (const auto cached = finishedTournaments->Find(tournamentId, CachedResource::SNAPSHOT)) {
+        return finishedTournaments->Respond(request, *cached);
+    }
 
     auto res = tournamentDelegate->GetTournament(tournamentId);
     if (res) {
         nlohmann::json body = *res;
+        if (const auto stored = finishedTournaments->Store(tournamentId, CachedResource::SNAPSHOT, body.dump())) {
+            return finishedTournaments->Respond(request, *stored);
+        }
         auto response = crow::response{crow::OK, body.dump()};
         response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
         return response;
@@ -46,16 +66,21 @@ crow::response TournamentController::getTournament(const std::string& tournament
     }
 }
 
-crow::response TournamentController::ReadAll() {
-    auto res = tournamentDelegate->ReadAll();
+crow::response TournamentController::ReadAll(const crow::request& request) {
+    // ?q= answers the registration typeahead from the trigram index, otherwise the full list
+    const char* query = request.url_params.get("q");
+    std::optional<size_t> limit;
+    if (query != nullptr) {
+        limit = binding::QueryNumber(request.url_params.get("limit"), DEFAULT_SEARCH_LIMIT);
+        if (!limit) {
+            return crow::response{crow::BAD_REQUEST, "limit must be a positive number"};
+        }
+    }
+    auto res = query != nullptr ? tournamentDelegate->SearchTournaments(query, *limit) : tournamentDelegate->ReadAll();
     if (res) {
         nlohmann::json arr = nlohmann::json::array();
-        for (const auto& tournamentptr : *res) {
-            if (tournamentptr) {
-                arr.push_back(*tournamentptr);
-            } else {
-                arr.push_back(nullptr);
-            }
+        for (const auto& tournament : *res) {
+            arr.push_back(tournament);
         }
         auto response = crow::response{crow::OK, arr.dump()};
         response.add_header(CONTENT_TYPE_HEADER, JSON_CONTENT_TYPE);
@@ -68,14 +93,14 @@ crow::response TournamentController::ReadAll() {
 crow::response TournamentController::CreateTournament(const crow::request& request) {
     crow::response response;
 
-    if (!nlohmann::json::accept(request.body)) {
+    auto tournament = binding::Bind<domain::Tournament>(request.body, TOURNAMENT_SCHEMA);
+    if (!tournament) {
         response.code = crow::BAD_REQUEST;
+        response.body = tournament.error();
         return response;
     }
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Tournament tournament = requestBody;
 
-    auto res = tournamentDelegate->CreateTournament(tournament);
+    auto res = tournamentDelegate->CreateTournament(*tournament);
     if (res) {
         response.code = crow::CREATED;
         response.add_header("Location", *res);
@@ -90,24 +115,23 @@ crow::response TournamentController::CreateTournament(const crow::request& reque
 
 crow::response TournamentController::updateTournament(const crow::request& request, const std::string& tournamentId) {
     crow::response response;
-    if (!nlohmann::json::accept(request.body)) {
+    auto tournamentObj = binding::Bind<domain::Tournament>(request.body, TOURNAMENT_SCHEMA);
+    if (!tournamentObj) {
         response.code = crow::BAD_REQUEST;
-        response.body = "Invalid JSON format";
+        response.body = tournamentObj.error();
         return response;
     }
 
-    auto requestBody = nlohmann::json::parse(request.body);
-    domain::Tournament tournamentObj = requestBody;
-
-    if (!tournamentObj.Id().empty()) {
+    if (!tournamentObj->Id().empty()) {
         response.code = crow::BAD_REQUEST;
         response.body = "ID is not editable";
         return response;
     }
-    tournamentObj.Id() = tournamentId;
+    tournamentObj->Id() = tournamentId;
 
-    auto res = tournamentDelegate->UpdateTournament(tournamentObj);
+    auto res = tournamentDelegate->UpdateTournament(*tournamentObj);
     if (res) {
+        finishedTournaments->Evict(tournamentId);
         response.code = crow::NO_CONTENT;
         response.body = "";
     } else {
@@ -121,7 +145,7 @@ crow::response TournamentController::updateTournament(const crow::request& reque
 crow::response TournamentController::deleteTournament(const std::string& tournamentId) {
     crow::response response;
 
-    if (!std::regex_match(tournamentId, ID_VALUE)) {
+    if (!IsValidId(tournamentId)) {
         response.code = crow::BAD_REQUEST;
         response.body = "Invalid ID format";
         return response;
@@ -129,6 +153,7 @@ crow::response TournamentController::deleteTournament(const std::string& tournam
 
     auto res = tournamentDelegate->DeleteTournament(tournamentId);
     if (res) {
+        finishedTournaments->Evict(tournamentId);
         response.code = crow::NO_CONTENT;
         response.body = "";
     } else {
@@ -143,4 +168,4 @@ REGISTER_ROUTE(TournamentController, getTournament, "/tournaments/<string>", "GE
 REGISTER_ROUTE(TournamentController, updateTournament, "/tournaments/<string>", "PATCH"_method)
 REGISTER_ROUTE(TournamentController, deleteTournament, "/tournaments/<string>", "DELETE"_method)
 REGISTER_ROUTE(TournamentController, CreateTournament, "/tournaments", "POST"_method)
-REGISTER_ROUTE(TournamentController, ReadAll, "/tournaments", "GET"_method)
\ No newline at end of file
+REGISTER_ROUTE_WITH_POLICY(TournamentController, ReadAll, "/tournaments", "GET"_method, route_policy::BULK_LIST)
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "delegate/ExportDelegate.hpp"
+
+#include <expected>
+#include <regex>
+#include <string>
+
+#include "exception/Error.hpp"
+#include "domain/Constants.hpp"
+
+ExportDelegate::ExportDelegate(const std::shared_ptr<IRepository<domain::Tournament, std::string>>& tournamentRepository, const std::shared_ptr<IExportRepository>& exportRepository)
+    : tournamentRepository(tournamentRepository), exportRepository(exportRepository) {}
+
+std::expected<void, Error> ExportDelegate::ExportTournament(std::string_view tournamentId, ExportFormat format, const ExportSink& sink) {
+    // The id ends up quoted inside a COPY statement, only well formed UUIDs get that far
+    if (!IsValidId(tournamentId)) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+    try {
+        if (!tournamentRepository->ReadById(std::string{tournamentId})) {
+            return std::unexpected(Error::NOT_FOUND);
+        }
+        exportRepository->ExportTournament(tournamentId, format, sink);
+        return {};
+    } catch (const std::exception& e) {
+        return std::unexpected(Error::UNKNOWN_ERROR);
+    }
+}
+
+std::expected<void, Error> ExportDelegate::ExportAll(ExportFormat format, const ExportSink& sink) {
+    try {
+        exportRepository->ExportAll(format, sink);
+        return {};
+    } catch (const std::exception& e) {
+        return std::unexpected(Error::UNKNOWN_ERROR);
+    }
+}
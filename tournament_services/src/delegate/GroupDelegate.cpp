@@ -11,12 +11,12 @@
 #include <format>
 #include <pqxx/pqxx>
 
-GroupDelegate::GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer)
-    : tournamentRepository(tournamentRepository), groupRepository(groupRepository), teamRepository(teamRepository), messageProducer(messageProducer){}
+GroupDelegate::GroupDelegate(const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IGroupRepository>& groupRepository, const std::shared_ptr<TeamRepository>& teamRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer, const std::shared_ptr<ITeamDictionary>& teamDictionary)
+    : tournamentRepository(tournamentRepository), groupRepository(groupRepository), teamRepository(teamRepository), messageProducer(messageProducer), teamDictionary(teamDictionary){}
 
-std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
+std::expected<std::vector<domain::Group>, Error> GroupDelegate::GetGroups(const std::string_view& tournamentId) {
     // Validacion de formato de UUID para tournamentId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE)) {
+    if (!IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo
@@ -26,7 +26,10 @@ std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GroupDelegate:
     }
     // Validacion extra
     try {
-        return this->groupRepository->FindByTournamentId(tournamentId);
+        auto groups = this->groupRepository->FindByTournamentId(tournamentId);
+        // Los documentos solo guardan el id de cada equipo
+        ResolveTeamNames(*teamDictionary, groups);
+        return groups;
     } catch (const std::exception& e) {
         // Error general al leer la base de datos
         return std::unexpected(Error::UNKNOWN_ERROR);
@@ -35,7 +38,7 @@ std::expected<std::vector<std::shared_ptr<domain::Group>>, Error> GroupDelegate:
 
 std::expected<std::shared_ptr<domain::Group>, Error> GroupDelegate::GetGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!IsValidId(tournamentId) || !IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo 
@@ -50,7 +53,8 @@ std::expected<std::shared_ptr<domain::Group>, Error> GroupDelegate::GetGroup(con
     }
     // Validacion extra
     try {
-        return groupRepository->FindByTournamentIdAndGroupId(tournamentId, groupId);
+        ResolveTeamNames(*teamDictionary, *group);
+        return group;
     } catch (const std::exception& e) {
         return std::unexpected(Error::UNKNOWN_ERROR);
     }
@@ -58,7 +62,7 @@ std::expected<std::shared_ptr<domain::Group>, Error> GroupDelegate::GetGroup(con
 
 std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_view& tournamentId, const domain::Group& group) {
     // Validacion de formato de UUID para tournamentId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE)) {
+    if (!IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de formato del grupo
@@ -71,14 +75,14 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
         return std::unexpected(Error::NOT_FOUND);
     }
     // Validacion de cantidad maxima de equipos en el grupo
-    if (group.Teams().size() > 32) {
+    if (static_cast<int>(group.Teams().size()) > domain::GroupCapacity(tournament->Format())) {
         return std::unexpected(Error::UNPROCESSABLE_ENTITY);
     }
     // Validacion de equipos si los hay
     if (!group.Teams().empty()) {
         for (auto& t : group.Teams()) {
             // Validacion de formato UUID de cada equipo
-            if (!std::regex_match(t.Id, ID_VALUE)) {
+            if (!IsValidId(t.Id)) {
                 return std::unexpected(Error::INVALID_FORMAT);
             }
             // Validacion de existencia de cada equipo
@@ -96,24 +100,22 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
     
     try {
         auto id = groupRepository->Create(g);
+        // Validacion de duplicado (ON CONFLICT no devuelve fila)
+        if (!id) {
+            return std::unexpected(id.error());
+        }
         
         // Si hay equipos, agregarlos usando UpdateTeams
         if (!group.Teams().empty()) {
-            auto updateResult = UpdateTeams(tournamentId, id, group.Teams());
+            auto updateResult = UpdateTeams(tournamentId, *id, group.Teams());
             if (!updateResult) {
                 // Si falla agregar equipos, eliminar el grupo creado
-                groupRepository->Delete(id);
+                groupRepository->Delete(*id);
                 return std::unexpected(updateResult.error());
             }
         }
         
-        return id;
-    } catch (const pqxx::unique_violation& e) {
-        // Validacion de duplicado
-        if (e.sqlstate() == "23505") {
-            return std::unexpected(Error::DUPLICATE);
-        }
-        return std::unexpected(Error::UNKNOWN_ERROR);
+        return *id;
     } catch (const std::exception& e) {
         // Validacion extra
         return std::unexpected(Error::UNKNOWN_ERROR);
@@ -122,7 +124,7 @@ std::expected<std::string, Error> GroupDelegate::CreateGroup(const std::string_v
 
 std::expected<void, Error> GroupDelegate::UpdateGroup(const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!IsValidId(tournamentId) || !IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de formato del grupo
@@ -160,7 +162,7 @@ std::expected<void, Error> GroupDelegate::UpdateGroup(const std::string_view& to
 }
 std::expected<void, Error> GroupDelegate::RemoveGroup(const std::string_view& tournamentId, const std::string_view& groupId) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!IsValidId(tournamentId) || !IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo
@@ -183,7 +185,7 @@ std::expected<void, Error> GroupDelegate::RemoveGroup(const std::string_view& to
 
 std::expected<void, Error> GroupDelegate::UpdateTeams(const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams) {
     // Validacion de formato de UUID para tournamentId y groupId
-    if (!std::regex_match(std::string(tournamentId), ID_VALUE) || !std::regex_match(std::string(groupId), ID_VALUE)) {
+    if (!IsValidId(tournamentId) || !IsValidId(groupId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     // Validacion de existencia del torneo
@@ -197,12 +199,12 @@ std::expected<void, Error> GroupDelegate::UpdateTeams(const std::string_view& to
         return std::unexpected(Error::NOT_FOUND);
     }
     // Validacion de cantidad maxima de equipos en el grupo
-    if (group->Teams().size() + teams.size() > 32) {
+    if (static_cast<int>(group->Teams().size() + teams.size()) > domain::GroupCapacity(tournament->Format())) {
         return std::unexpected(Error::UNPROCESSABLE_ENTITY);
     }
     for (const auto& team : teams) {
         // Validacion de formato UUID de cada equipo
-        if (!std::regex_match(team.Id, ID_VALUE)) {
+        if (!IsValidId(team.Id)) {
             return std::unexpected(Error::INVALID_FORMAT);
         }
         // Validacion de duplicados
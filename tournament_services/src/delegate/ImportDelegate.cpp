@@ -0,0 +1,35 @@
+#include "delegate/ImportDelegate.hpp"
+
+#include <expected>
+#include <string>
+
+#include "exception/Error.hpp"
+
+ImportDelegate::ImportDelegate(const std::shared_ptr<IImportRepository>& importRepository) : importRepository(importRepository) {}
+
+std::expected<ImportSummary, Error> ImportDelegate::Import(std::string_view ndjson) {
+    if (ndjson.empty()) {
+        return std::unexpected(Error::INVALID_FORMAT);
+    }
+
+    // Hands the body to the repository one line at a time instead of parsing it as a whole
+    size_t position = 0;
+    const ImportSource source = [ndjson, &position](std::string& line) {
+        if (position >= ndjson.size()) {
+            return false;
+        }
+        auto end = ndjson.find('\n', position);
+        if (end == std::string_view::npos) {
+            end = ndjson.size();
+        }
+        line.assign(ndjson.substr(position, end - position));
+        position = end + 1;
+        return true;
+    };
+
+    try {
+        return importRepository->Import(source);
+    } catch (const std::exception& e) {
+        return std::unexpected(Error::UNKNOWN_ERROR);
+    }
+}
@@ -1,5 +1,6 @@
 #include "delegate/MatchDelegate.hpp"
 
+#include <chrono>
 #include <expected>
 #include <iostream>
 #include <regex>
@@ -13,8 +14,8 @@
 MatchDelegate::MatchDelegate(const std::shared_ptr<IMatchRepository>& matchRepository, const std::shared_ptr<TournamentRepository>& tournamentRepository, const std::shared_ptr<IQueueMessageProducer>& messageProducer)
     : matchRepository(matchRepository), tournamentRepository(tournamentRepository), messageProducer(messageProducer) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> MatchDelegate::GetMatches(std::string_view tournamentId) {
-    if (!std::regex_match(std::string{tournamentId}, ID_VALUE)) {
+std::expected<std::vector<domain::Match>, Error> MatchDelegate::GetMatches(std::string_view tournamentId) {
+    if (!IsValidId(tournamentId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     if (!tournamentRepository->ReadById(tournamentId.data())) {
@@ -24,8 +25,8 @@ std::expected<std::vector<std::shared_ptr<domain::Match>>, Error> MatchDelegate:
 }
 
 std::expected<std::shared_ptr<domain::Match>, Error> MatchDelegate::GetMatch(std::string_view tournamentId, std::string_view matchId) {
-    if (!std::regex_match(std::string{tournamentId}, ID_VALUE) || 
-        !std::regex_match(std::string{matchId}, ID_VALUE)) {
+    if (!IsValidId(tournamentId) || 
+        !IsValidId(matchId)) {
         return std::unexpected(Error::INVALID_FORMAT);
     }
     if (!tournamentRepository->ReadById(tournamentId.data())) {
@@ -35,8 +36,8 @@ std::expected<std::shared_ptr<domain::Match>, Error> MatchDelegate::GetMatch(std
 }
 
 std::expected<std::string, Error> MatchDelegate::UpdateMatchScore(const domain::Match& match) {
-  if (!std::regex_match(std::string{match.TournamentId()}, ID_VALUE) ||
-    !std::regex_match(std::string{match.Id()}, ID_VALUE)) {
+  if (!IsValidId(match.TournamentId()) ||
+    !IsValidId(match.Id())) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -59,6 +60,8 @@ std::expected<std::string, Error> MatchDelegate::UpdateMatchScore(const domain::
     message->emplace("matchId", match.Id());
     message->emplace("homeTeamScore", score.homeTeamScore);
     message->emplace("visitorTeamScore", score.visitorTeamScore);
+    // the consumer tells an overrun from this, not from when it gets to the event
+    message->emplace("scoredAt", std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
     messageProducer->SendMessage(message->dump(), "tournament.score-update");
   } catch (const std::exception& e) {
     std::cout << "[MatchDelegate] ERROR sending message: " << e.what() << std::endl;
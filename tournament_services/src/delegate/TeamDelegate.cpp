@@ -10,10 +10,12 @@
 #include "domain/Constants.hpp"
 
 TeamDelegate::TeamDelegate(
-    std::shared_ptr<IRepository<domain::Team, std::string_view>> repository)
-    : teamRepository(std::move(repository)) {}
+    std::shared_ptr<IRepository<domain::Team, std::string_view>> repository,
+    std::shared_ptr<ITeamDictionary> teamDictionary,
+    std::shared_ptr<INameSearch<domain::Team>> teamSearch)
+    : teamRepository(std::move(repository)), teamDictionary(std::move(teamDictionary)), teamSearch(std::move(teamSearch)) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>
+std::expected<std::vector<domain::Team>, Error>
 TeamDelegate::GetAllTeams() {
   try {
     auto teams = teamRepository->ReadAll();
@@ -24,8 +26,21 @@ TeamDelegate::GetAllTeams() {
   }
 }
 
+std::expected<std::vector<domain::Team>, Error>
+TeamDelegate::SearchTeams(std::string_view query, size_t limit) {
+  if (!IsValidSearch(query, limit)) {
+    return std::unexpected(Error::INVALID_FORMAT);
+  }
+  try {
+    return teamSearch->SearchByName(query, limit);
+
+  } catch (const std::exception& e) {
+    return std::unexpected(Error::UNKNOWN_ERROR);
+  }
+}
+
 std::expected<std::shared_ptr<domain::Team>, Error> TeamDelegate::GetTeam(std::string_view id) {
-  if (!std::regex_match(std::string{id}, ID_VALUE)) {
+  if (!IsValidId(id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -54,17 +69,8 @@ std::expected<std::string, Error> TeamDelegate::CreateTeam(
   }
 
   try {
-    auto id_view = teamRepository->Create(team);
-    if (id_view.empty()) {
-      return std::unexpected(Error::UNKNOWN_ERROR);
-    }
-    return std::string{id_view};
-
-  } catch (const pqxx::unique_violation& e) {
-    if (e.sqlstate() == "23505") {
-      return std::unexpected(Error::DUPLICATE);
-    }
-    return std::unexpected(Error::UNKNOWN_ERROR);
+    // Duplicate names come back as Error::DUPLICATE from the repository, no exception involved
+    return teamRepository->Create(team);
 
   } catch (const std::exception& e) {
     return std::unexpected(Error::UNKNOWN_ERROR);
@@ -73,7 +79,7 @@ std::expected<std::string, Error> TeamDelegate::CreateTeam(
 
 std::expected<std::string, Error> TeamDelegate::UpdateTeam(
     const domain::Team& team) {
-  if (team.Id.empty() || !std::regex_match(team.Id, ID_VALUE)) {
+  if (team.Id.empty() || !IsValidId(team.Id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
 
@@ -82,6 +88,8 @@ std::expected<std::string, Error> TeamDelegate::UpdateTeam(
     if (updated_view.empty()) {
       return std::unexpected(Error::NOT_FOUND);
     }
+    // Groups show the new name right away on this replica, the others pick it up when their entry expires
+    teamDictionary->Invalidate(team.Id);
     return std::string{updated_view};
   } catch (const pqxx::data_exception& e) {
     if (e.sqlstate() == "22P02") {
@@ -96,6 +104,7 @@ std::expected<std::string, Error> TeamDelegate::UpdateTeam(
 std::expected<void, Error> TeamDelegate::DeleteTeam(std::string_view id) {
   try {
     teamRepository->Delete(id);
+    teamDictionary->Invalidate(id);
     return {};
 
   } catch (const pqxx::data_exception& e) {
@@ -9,10 +9,11 @@
 #include "exception/Error.hpp"
 
 TournamentDelegate::TournamentDelegate(
-    std::shared_ptr<IRepository<domain::Tournament, std::string>> repository)
-    : tournamentRepository(std::move(repository)) {}
+    std::shared_ptr<IRepository<domain::Tournament, std::string>> repository,
+    std::shared_ptr<INameSearch<domain::Tournament>> tournamentSearch)
+    : tournamentRepository(std::move(repository)), tournamentSearch(std::move(tournamentSearch)) {}
 
-std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>
+std::expected<std::vector<domain::Tournament>, Error>
 TournamentDelegate::ReadAll() {
 
   try {
@@ -24,8 +25,21 @@ TournamentDelegate::ReadAll() {
   }
 }
 
+std::expected<std::vector<domain::Tournament>, Error>
+TournamentDelegate::SearchTournaments(std::string_view query, size_t limit) {
+  if (!IsValidSearch(query, limit)) {
+    return std::unexpected(Error::INVALID_FORMAT);
+  }
+  try {
+    return tournamentSearch->SearchByName(query, limit);
+
+  } catch (const std::exception& e) {
+    return std::unexpected(Error::UNKNOWN_ERROR);
+  }
+}
+
 std::expected<std::shared_ptr<domain::Tournament>, Error> TournamentDelegate::GetTournament(std::string_view id) {
-  if (!std::regex_match(std::string(id), ID_VALUE)) {
+  if (!IsValidId(id)) {
     return std::unexpected(Error::INVALID_FORMAT);
   }
   try {
@@ -53,20 +67,15 @@ std::expected<std::string, Error> TournamentDelegate::CreateTournament(
     if (!tournament.Id().empty() || tournament.Name().empty()) {
       return std::unexpected(Error::INVALID_FORMAT);
     }
+    // A group stage has to produce exactly the teams of the knockout bracket
+    if (!domain::IsValidFormat(tournament.Format())) {
+      return std::unexpected(Error::INVALID_FORMAT);
+    }
 
 
   try {
-    auto id_view = tournamentRepository->Create(tournament);
-    if (id_view.empty()) {
-      return std::unexpected(Error::UNKNOWN_ERROR);
-    }
-    return std::string{id_view};
-
-  } catch (const pqxx::unique_violation& e) {
-    if (e.sqlstate() == "23505") {
-      return std::unexpected(Error::DUPLICATE);
-    }
-    return std::unexpected(Error::UNKNOWN_ERROR);
+    // Duplicate names come back as Error::DUPLICATE from the repository, no exception involved
+    return tournamentRepository->Create(tournament);
 
   } catch (const std::exception& e) {
     return std::unexpected(Error::UNKNOWN_ERROR);
@@ -75,7 +84,7 @@ std::expected<std::string, Error> TournamentDelegate::CreateTournament(
 
 std::expected<std::string, Error> TournamentDelegate::UpdateTournament(
     const domain::Tournament& tournament) {
-    if (!std::regex_match(std::string(tournament.Id()), ID_VALUE)) {
+    if (!IsValidId(tournament.Id()) || !domain::IsValidFormat(tournament.Format())) {
       return std::unexpected(Error::INVALID_FORMAT);
     }
 
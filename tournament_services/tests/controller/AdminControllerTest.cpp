@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include <crow.h>
+#include <chrono>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+#include "controller/AdminController.hpp"
+
+class AdminControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<SlowQueryLog> slowQueries = std::make_shared<SlowQueryLog>();
+  std::shared_ptr<config::AdminConfiguration> adminConfiguration = std::make_shared<config::AdminConfiguration>();
+  std::shared_ptr<AdminController> adminController;
+  crow::request request;
+
+  void SetUp() override {
+    adminConfiguration->token = "secret";
+    adminController = std::make_shared<AdminController>(slowQueries, adminConfiguration, nullptr);
+    slowQueries->Record("insert_team", std::chrono::milliseconds(150));
+  }
+};
+
+// Validar que las consultas lentas exigen el token de administracion
+TEST_F(AdminControllerTest, SlowQueries_WithoutToken_Unauthorized) {
+  crow::response response = adminController->GetSlowQueries(request);
+
+  EXPECT_EQ(response.code, crow::UNAUTHORIZED);
+  EXPECT_EQ(response.body.find("insert_team"), std::string::npos);
+
+  request.add_header("Authorization", "Bearer wrong");
+  EXPECT_EQ(adminController->GetSlowQueries(request).code, crow::UNAUTHORIZED);
+}
+
+// Validar que con el token se devuelven las estadisticas y las ejecuciones lentas
+TEST_F(AdminControllerTest, SlowQueries_WithToken_ReturnsRecent) {
+  request.add_header("Authorization", "Bearer secret");
+
+  crow::response response = adminController->GetSlowQueries(request);
+
+  ASSERT_EQ(response.code, crow::OK);
+  const auto body = nlohmann::json::parse(response.body);
+  EXPECT_EQ(body["recent"][0]["statement"], "insert_team");
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <expected>
+#include <fstream>
+#include <sstream>
+
+#include "delegate/IExportDelegate.hpp"
+#include "controller/ExportController.hpp"
+#include "exception/Error.hpp"
+
+class ExportDelegateMock : public IExportDelegate {
+public:
+  MOCK_METHOD((std::expected<void, Error>), ExportTournament,
+              (std::string_view tournamentId, ExportFormat format, const ExportSink& sink), (override));
+  MOCK_METHOD((std::expected<void, Error>), ExportAll, (ExportFormat format, const ExportSink& sink), (override));
+};
+
+class ExportControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<ExportDelegateMock> exportDelegateMock;
+  std::shared_ptr<ExportController> exportController;
+
+  void SetUp() override {
+    exportDelegateMock = std::make_shared<ExportDelegateMock>();
+    exportController = std::make_shared<ExportController>(exportDelegateMock);
+  }
+
+  static std::string readSpool(const crow::response& response) {
+    std::ifstream spool(response.file_info.path, std::ios::binary);
+    std::stringstream content;
+    content << spool.rdbuf();
+    return content.str();
+  }
+};
+
+// Validar que la exportacion NDJSON se escribe al archivo servido por Crow. Response 200
+TEST_F(ExportControllerTest, ExportTournament_Ndjson) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  crow::request request;
+
+  EXPECT_CALL(*exportDelegateMock, ExportTournament(std::string_view(tournamentId), ExportFormat::NDJSON, testing::_))
+    .WillOnce([](std::string_view, ExportFormat, const ExportSink& sink) {
+      sink("{\"type\":\"tournament\"}\n");
+      sink("{\"type\":\"group\"}\n");
+      return std::expected<void, Error>{};
+    });
+
+  crow::response response = exportController->ExportTournament(request, tournamentId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ("application/x-ndjson", response.get_header_value("content-type"));
+  EXPECT_EQ("{\"type\":\"tournament\"}\n{\"type\":\"group\"}\n", readSpool(response));
+}
+
+// Validar seleccion de formato CSV por query string. Response 200
+TEST_F(ExportControllerTest, ExportAll_Csv) {
+  crow::request request;
+  request.url_params = crow::query_string{"/exports/tournaments?format=csv"};
+
+  EXPECT_CALL(*exportDelegateMock, ExportAll(ExportFormat::CSV, testing::_))
+    .WillOnce([](ExportFormat, const ExportSink& sink) {
+      sink("type,id,tournamentId,name,document\n");
+      return std::expected<void, Error>{};
+    });
+
+  crow::response response = exportController->ExportAll(request);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ("text/csv", response.get_header_value("content-type"));
+  EXPECT_EQ("type,id,tournamentId,name,document\n", readSpool(response));
+}
+
+// Validar formato no soportado. Response 400
+TEST_F(ExportControllerTest, ExportAll_UnsupportedFormat) {
+  crow::request request;
+  request.url_params = crow::query_string{"/exports/tournaments?format=xml"};
+
+  EXPECT_CALL(*exportDelegateMock, ExportAll(testing::_, testing::_)).Times(0);
+
+  crow::response response = exportController->ExportAll(request);
+
+  EXPECT_EQ(crow::BAD_REQUEST, response.code);
+}
+
+// Validar torneo inexistente. Response 404
+TEST_F(ExportControllerTest, ExportTournament_NotFound) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  crow::request request;
+
+  EXPECT_CALL(*exportDelegateMock, ExportTournament(testing::_, testing::_, testing::_))
+    .WillOnce(testing::Return(std::expected<void, Error>{std::unexpected(Error::NOT_FOUND)}));
+
+  crow::response response = exportController->ExportTournament(request, tournamentId);
+
+  EXPECT_EQ(crow::NOT_FOUND, response.code);
+}
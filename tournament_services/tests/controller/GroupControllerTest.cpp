@@ -17,7 +17,7 @@ class GroupDelegateMock : public IGroupDelegate {
     public:
     MOCK_METHOD((std::expected<std::shared_ptr<domain::Group>, Error>), GetGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<std::string, Error>), CreateGroup, (const std::string_view& tournamentId, const domain::Group& group), (override));
-    MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Group>>, Error>), GetGroups, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::vector<domain::Group>, Error>), GetGroups, (const std::string_view& tournamentId), (override));
     MOCK_METHOD((std::expected<void, Error>), UpdateGroup, (const std::string_view& tournamentId, const domain::Group& group, const std::string_view& groupId), (override)); 
     MOCK_METHOD((std::expected<void, Error>), RemoveGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD((std::expected<void, Error>), UpdateTeams, (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Team>& teams), (override));
@@ -30,7 +30,7 @@ class GroupControllerTest : public ::testing::Test {
 
     void SetUp() override {
         groupDelegateMock = std::make_shared<GroupDelegateMock>();
-        groupController = std::make_shared<GroupController>(groupDelegateMock);
+        groupController = std::make_shared<GroupController>(groupDelegateMock, std::make_shared<FinishedTournamentCache>());
     }
 };
 
@@ -98,6 +98,39 @@ TEST_F(GroupControllerTest, CreateGroup_Conflict) {
     EXPECT_EQ("Error", response.body);
 }
 
+// Validar que un cuerpo que no es JSON responde 400 sin llegar a GroupDelegate
+TEST_F(GroupControllerTest, CreateGroup_InvalidJson) {
+    std::string tournamentId = "12345678-1234-1234-1234-123456789abc";
+
+    EXPECT_CALL(*groupDelegateMock, CreateGroup(testing::_, testing::_)).Times(0);
+
+    crow::request request;
+    request.body = "{\"name\": ";
+
+    crow::response response = groupController->CreateGroup(request, tournamentId);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ("Invalid JSON format", response.body);
+}
+
+// Validar que el esquema rechaza un grupo sin nombre. Response 400
+TEST_F(GroupControllerTest, CreateGroup_MissingName) {
+    std::string tournamentId = "12345678-1234-1234-1234-123456789abc";
+
+    EXPECT_CALL(*groupDelegateMock, CreateGroup(testing::_, testing::_)).Times(0);
+
+    nlohmann::json requestJson = {
+        {"teams", nlohmann::json::array()}
+    };
+    crow::request request;
+    request.body = requestJson.dump();
+
+    crow::response response = groupController->CreateGroup(request, tournamentId);
+
+    EXPECT_EQ(crow::BAD_REQUEST, response.code);
+    EXPECT_EQ("name is required", response.body);
+}
+
 // Tests de GetGroup
 
 // Validar que el valor que se le transfiera a GroupDelegate es el esperado. Simular el resultado con un objeto y validar la respuesta HTTP 200
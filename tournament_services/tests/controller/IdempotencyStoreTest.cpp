@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <memory>
+#include <optional>
+
+#include "configuration/IdempotencyStore.hpp"
+
+class IdempotencyRepositoryMock : public IIdempotencyRepository {
+public:
+  MOCK_METHOD(bool, Reserve, (std::string_view key, std::string_view scope, std::string_view fingerprint), (override));
+  MOCK_METHOD(std::optional<IdempotencyRecord>, Find, (std::string_view key, std::string_view scope), (override));
+  MOCK_METHOD(void, Complete, (std::string_view key, std::string_view scope, const StoredResponse& response), (override));
+  MOCK_METHOD(void, Release, (std::string_view key, std::string_view scope), (override));
+  MOCK_METHOD(void, PurgeExpired, (), (override));
+};
+
+class IdempotencyStoreTest : public ::testing::Test {
+protected:
+  std::shared_ptr<testing::NiceMock<IdempotencyRepositoryMock>> repositoryMock;
+  std::shared_ptr<IdempotencyStore> store;
+  crow::request request;
+  int executions = 0;
+
+  void SetUp() override {
+    repositoryMock = std::make_shared<testing::NiceMock<IdempotencyRepositoryMock>>();
+    store = std::make_shared<IdempotencyStore>(repositoryMock, 16);
+    request.method = crow::HTTPMethod::Post;
+    request.url = "/teams";
+    request.body = R"({"name":"Team A"})";
+    request.add_header("Idempotency-Key", "key-1");
+  }
+
+  crow::response created() {
+    ++executions;
+    crow::response response{crow::CREATED, "550e8400-e29b-41d4-a716-446655440000"};
+    response.add_header("Content-Type", "text/plain");
+    return response;
+  }
+};
+
+// Validar que sin Idempotency-Key la peticion se ejecuta sin tocar la tabla
+TEST_F(IdempotencyStoreTest, WithoutKey_Executes) {
+  request.headers.clear();
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).Times(0);
+
+  crow::response response = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(response.code, crow::CREATED);
+  EXPECT_EQ(executions, 1);
+}
+
+// Validar que la primera peticion se ejecuta y su respuesta queda registrada
+TEST_F(IdempotencyStoreTest, FirstRequest_ExecutesAndRecords) {
+  EXPECT_CALL(*repositoryMock, Reserve(std::string_view("key-1"), std::string_view("POST /teams"), testing::_))
+    .WillOnce(testing::Return(true));
+  EXPECT_CALL(*repositoryMock, Complete(std::string_view("key-1"), std::string_view("POST /teams"),
+      testing::Field(&StoredResponse::status, crow::CREATED)));
+
+  crow::response response = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(response.code, crow::CREATED);
+  EXPECT_EQ(executions, 1);
+}
+
+// Validar que el reintento con la misma llave devuelve la respuesta original sin ejecutar otra vez
+TEST_F(IdempotencyStoreTest, Retry_ReplaysFromCache) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(true));
+
+  store->Execute(request, [&] { return created(); });
+  crow::response replayed = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(executions, 1);
+  EXPECT_EQ(replayed.code, crow::CREATED);
+  EXPECT_EQ(replayed.body, "550e8400-e29b-41d4-a716-446655440000");
+  EXPECT_EQ(replayed.get_header_value("Idempotent-Replayed"), "true");
+}
+
+// Validar que el reintento en otra replica se responde desde la tabla
+TEST_F(IdempotencyStoreTest, Retry_ReplaysFromTable) {
+  StoredResponse stored{crow::CREATED, {{"Content-Type", "text/plain"}}, "550e8400-e29b-41d4-a716-446655440000"};
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(false));
+  EXPECT_CALL(*repositoryMock, Find(std::string_view("key-1"), std::string_view("POST /teams")))
+    .WillOnce(testing::Return(IdempotencyRecord{digest::Sha256Hex(request.body), stored}));
+
+  crow::response response = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(executions, 0);
+  EXPECT_EQ(response.code, crow::CREATED);
+  EXPECT_EQ(response.get_header_value("Content-Type"), "text/plain");
+}
+
+// Validar que mientras la primera peticion sigue ejecutando el reintento recibe 409
+TEST_F(IdempotencyStoreTest, Retry_InProgress) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(false));
+  EXPECT_CALL(*repositoryMock, Find(testing::_, testing::_))
+    .WillOnce(testing::Return(IdempotencyRecord{"fingerprint", std::nullopt}));
+
+  crow::response response = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(executions, 0);
+  EXPECT_EQ(response.code, crow::CONFLICT);
+}
+
+// Validar que reutilizar la llave con otro cuerpo responde 422
+TEST_F(IdempotencyStoreTest, Retry_DifferentBody) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(true));
+  store->Execute(request, [&] { return created(); });
+
+  request.body = R"({"name":"Team B"})";
+  crow::response response = store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(executions, 1);
+  EXPECT_EQ(response.code, 422);
+}
+
+// Validar que un error del servidor libera la llave para que el reintento ejecute de nuevo
+TEST_F(IdempotencyStoreTest, ServerError_Releases) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(true));
+  EXPECT_CALL(*repositoryMock, Release(std::string_view("key-1"), std::string_view("POST /teams")));
+  EXPECT_CALL(*repositoryMock, Complete(testing::_, testing::_, testing::_)).Times(0);
+
+  crow::response response = store->Execute(request, [] { return crow::response{crow::INTERNAL_SERVER_ERROR, "Error"}; });
+
+  EXPECT_EQ(response.code, crow::INTERNAL_SERVER_ERROR);
+}
+
+// Validar que si liberar la llave falla se responde igual el error original
+TEST_F(IdempotencyStoreTest, ServerError_FailedRelease_KeepsResponse) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).WillOnce(testing::Return(true));
+  EXPECT_CALL(*repositoryMock, Release(testing::_, testing::_)).WillOnce(testing::Throw(std::runtime_error("connection lost")));
+
+  crow::response response = store->Execute(request, [] { return crow::response{crow::SERVICE_UNAVAILABLE, "Dependency unavailable"}; });
+
+  EXPECT_EQ(response.code, crow::SERVICE_UNAVAILABLE);
+}
+
+// Validar que la huella del cuerpo es estable entre compilaciones (SHA-256)
+TEST_F(IdempotencyStoreTest, Fingerprint_IsSha256) {
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_,
+      std::string_view("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"))).WillOnce(testing::Return(true));
+  request.body.clear();
+
+  store->Execute(request, [&] { return created(); });
+}
+
+// Validar que los GET no usan la llave
+TEST_F(IdempotencyStoreTest, Get_Ignored) {
+  request.method = crow::HTTPMethod::Get;
+  EXPECT_CALL(*repositoryMock, Reserve(testing::_, testing::_, testing::_)).Times(0);
+
+  store->Execute(request, [&] { return created(); });
+  store->Execute(request, [&] { return created(); });
+
+  EXPECT_EQ(executions, 2);
+}
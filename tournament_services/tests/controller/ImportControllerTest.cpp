@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <crow.h>
+#include <expected>
+#include <nlohmann/json.hpp>
+
+#include "delegate/IImportDelegate.hpp"
+#include "controller/ImportController.hpp"
+#include "exception/Error.hpp"
+
+class ImportDelegateMock : public IImportDelegate {
+public:
+  MOCK_METHOD((std::expected<ImportSummary, Error>), Import, (std::string_view ndjson), (override));
+};
+
+class ImportControllerTest : public ::testing::Test {
+protected:
+  std::shared_ptr<ImportDelegateMock> importDelegateMock;
+  std::shared_ptr<ImportController> importController;
+
+  void SetUp() override {
+    importDelegateMock = std::make_shared<ImportDelegateMock>();
+    importController = std::make_shared<ImportController>(importDelegateMock);
+  }
+};
+
+// Validar que el resumen de la importacion se devuelve como JSON. Response 200
+TEST_F(ImportControllerTest, Import_Ok) {
+  crow::request request;
+  request.body = "{\"type\":\"team\",\"name\":\"A\"}\n{\"name\":\"B\"}\n";
+
+  ImportSummary summary;
+  summary.lines = 2;
+  summary.staged = 1;
+  summary.rejected = 1;
+  summary.teamsCreated = 1;
+  summary.errors.push_back("line 2: missing type");
+
+  EXPECT_CALL(*importDelegateMock, Import(std::string_view(request.body)))
+    .WillOnce(testing::Return(summary));
+
+  crow::response response = importController->Import(request);
+
+  EXPECT_EQ(response.code, crow::OK);
+  EXPECT_EQ(response.get_header_value("content-type"), "application/json");
+  auto body = nlohmann::json::parse(response.body);
+  EXPECT_EQ(body["lines"], 2);
+  EXPECT_EQ(body["rejected"], 1);
+  EXPECT_EQ(body["teamsCreated"], 1);
+  EXPECT_EQ(body["errors"].size(), 1);
+}
+
+// Validar que un cuerpo vacio responde 400
+TEST_F(ImportControllerTest, Import_EmptyBody) {
+  crow::request request;
+
+  EXPECT_CALL(*importDelegateMock, Import(testing::_))
+    .WillOnce(testing::Return(std::unexpected(Error::INVALID_FORMAT)));
+
+  crow::response response = importController->Import(request);
+
+  EXPECT_EQ(response.code, crow::BAD_REQUEST);
+}
+
+// Validar que un fallo del repositorio responde 500
+TEST_F(ImportControllerTest, Import_Failure) {
+  crow::request request;
+  request.body = "{\"type\":\"team\",\"name\":\"A\"}\n";
+
+  EXPECT_CALL(*importDelegateMock, Import(testing::_))
+    .WillOnce(testing::Return(std::unexpected(Error::UNKNOWN_ERROR)));
+
+  crow::response response = importController->Import(request);
+
+  EXPECT_EQ(response.code, crow::INTERNAL_SERVER_ERROR);
+}
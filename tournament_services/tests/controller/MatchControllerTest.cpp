@@ -12,7 +12,7 @@
 class MatchDelegateMock : public IMatchDelegate {
 public:
   MOCK_METHOD((std::expected<std::shared_ptr<domain::Match>, Error>), GetMatch, (std::string_view tournamentId, std::string_view matchId), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>), GetMatches,
+  MOCK_METHOD((std::expected<std::vector<domain::Match>, Error>), GetMatches,
               (std::string_view tournamentId), (override));
   MOCK_METHOD((std::expected<std::string, Error>), UpdateMatchScore,
               (const domain::Match&), (override));
@@ -21,11 +21,13 @@ public:
 class MatchControllerTest : public ::testing::Test {
 protected:
   std::shared_ptr<MatchDelegateMock> matchDelegateMock;
+  std::shared_ptr<FinishedTournamentCache> finishedTournaments = std::make_shared<FinishedTournamentCache>();
   std::shared_ptr<MatchController> matchController;
+  crow::request request;
 
   void SetUp() override {
     matchDelegateMock = std::make_shared<MatchDelegateMock>();
-    matchController = std::make_shared<MatchController>(matchDelegateMock);
+    matchController = std::make_shared<MatchController>(matchDelegateMock, finishedTournaments);
   }
 };
 
@@ -103,7 +105,7 @@ TEST_F(MatchControllerTest, GetMatch_TournamentNotFound) {
 // Validar respuesta exitosa con lista de matches. Response 200
 TEST_F(MatchControllerTest, GetMatches_Ok) {
   std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
-  std::vector<std::shared_ptr<domain::Match>> matches;
+  std::vector<domain::Match> matches;
   
   auto match1 = std::make_shared<domain::Match>();
   match1->Id() = "match-id-001";
@@ -123,14 +125,14 @@ TEST_F(MatchControllerTest, GetMatches_Ok) {
   match2->MatchScore().homeTeamScore = 2;
   match2->MatchScore().visitorTeamScore = 2;
   
-  matches.push_back(match1);
-  matches.push_back(match2);
+  matches.push_back(*match1);
+  matches.push_back(*match2);
 
   EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
     .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::in_place, matches}));
+        std::expected<std::vector<domain::Match>, Error>{std::in_place, matches}));
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(request, tournamentId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -151,13 +153,13 @@ TEST_F(MatchControllerTest, GetMatches_Ok) {
 // Validar respuesta exitosa con lista vacia de matches. Response 200
 TEST_F(MatchControllerTest, GetMatches_Empty) {
   std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
-  std::vector<std::shared_ptr<domain::Match>> emptyMatches;
+  std::vector<domain::Match> emptyMatches;
 
   EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
     .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::in_place, emptyMatches}));
+        std::expected<std::vector<domain::Match>, Error>{std::in_place, emptyMatches}));
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(request, tournamentId);
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -170,13 +172,89 @@ TEST_F(MatchControllerTest, GetMatches_TournamentNotFound) {
 
   EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
     .WillOnce(testing::Return(
-        std::expected<std::vector<std::shared_ptr<domain::Match>>, Error>{std::unexpected(Error::NOT_FOUND)}));
+        std::expected<std::vector<domain::Match>, Error>{std::unexpected(Error::NOT_FOUND)}));
 
-  crow::response response = matchController->getMatches(tournamentId);
+  crow::response response = matchController->getMatches(request, tournamentId);
 
   EXPECT_EQ(crow::NOT_FOUND, response.code);
 }
 
+// Validar que un torneo terminado se sirve desde cache sin consultar el delegate, comprimido y revalidable
+TEST_F(MatchControllerTest, GetMatches_FinishedServedFromCache) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  domain::Match final;
+  final.Id() = "match-id-f0";
+  final.TournamentId() = tournamentId;
+  final.Name() = "F0";
+  final.HomeTeamId() = "team-home";
+  final.VisitorTeamId() = "team-visitor";
+  final.MatchScore().visitorTeamScore = 1;
+
+  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
+    .Times(1)
+    .WillOnce(testing::Return(
+        std::expected<std::vector<domain::Match>, Error>{std::in_place, std::vector<domain::Match>{final}}));
+
+  crow::response first = matchController->getMatches(request, tournamentId);
+  crow::request gzipRequest;
+  gzipRequest.add_header("Accept-Encoding", "gzip, deflate");
+  crow::response second = matchController->getMatches(gzipRequest, tournamentId);
+
+  EXPECT_EQ(crow::OK, first.code);
+  EXPECT_EQ(nlohmann::json::parse(first.body)[0]["name"], "F0");
+  EXPECT_EQ(crow::OK, second.code);
+  EXPECT_EQ(second.get_header_value("Content-Encoding"), "gzip");
+  EXPECT_EQ(second.get_header_value("Cache-Control"), "public, max-age=60");
+  EXPECT_EQ(second.get_header_value("ETag"), FinishedTournamentCache::Etag(first.body));
+  EXPECT_TRUE(finishedTournaments->IsFinished(tournamentId));
+
+  crow::request conditional;
+  conditional.add_header("If-None-Match", first.get_header_value("ETag"));
+  EXPECT_EQ(crow::NOT_MODIFIED, matchController->getMatches(conditional, tournamentId).code);
+}
+
+// Validar que gzip con q=0 se respeta y el cuerpo se envia sin comprimir
+TEST_F(MatchControllerTest, GetMatches_FinishedGzipRefused) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  domain::Match final;
+  final.Name() = "F0";
+  final.HomeTeamId() = "team-home";
+  final.VisitorTeamId() = "team-visitor";
+  final.MatchScore().homeTeamScore = 2;
+
+  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
+    .WillOnce(testing::Return(
+        std::expected<std::vector<domain::Match>, Error>{std::in_place, std::vector<domain::Match>{final}}));
+
+  crow::request refusing;
+  refusing.add_header("Accept-Encoding", "gzip;q=0, identity");
+  crow::response response = matchController->getMatches(refusing, tournamentId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_TRUE(response.get_header_value("Content-Encoding").empty());
+  EXPECT_EQ(nlohmann::json::parse(response.body)[0]["name"], "F0");
+}
+
+// Validar que un torneo sin final decidida no se guarda en cache
+TEST_F(MatchControllerTest, GetMatches_UnfinishedNotCached) {
+  std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+  domain::Match final;
+  final.Name() = "F0";
+  final.HomeTeamId() = "team-home";
+
+  EXPECT_CALL(*matchDelegateMock, GetMatches(std::string_view(tournamentId)))
+    .Times(2)
+    .WillRepeatedly(testing::Return(
+        std::expected<std::vector<domain::Match>, Error>{std::in_place, std::vector<domain::Match>{final}}));
+
+  matchController->getMatches(request, tournamentId);
+  crow::response response = matchController->getMatches(request, tournamentId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_TRUE(response.get_header_value("Cache-Control").empty());
+  EXPECT_FALSE(finishedTournaments->IsFinished(tournamentId));
+}
+
 // Tests de UpdateMatchScore
 
 // Validar actualizacion exitosa del score. Response 200
@@ -13,7 +13,9 @@ class TeamDelegateMock : public ITeamDelegate {
 public:
   MOCK_METHOD((std::expected<std::shared_ptr<domain::Team>, Error>), GetTeam,
               (std::string_view id), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>), GetAllTeams, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Team>, Error>), GetAllTeams, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Team>, Error>), SearchTeams,
+              (std::string_view query, size_t limit), (override));
   MOCK_METHOD((std::expected<std::string, Error>), CreateTeam, (const domain::Team&), (override));
   MOCK_METHOD((std::expected<std::string, Error>), UpdateTeam, (const domain::Team&), (override));
   MOCK_METHOD((std::expected<void, Error>), DeleteTeam, (std::string_view id), (override));
@@ -22,11 +24,12 @@ public:
 class TeamControllerTest : public ::testing::Test {
 protected:
   std::shared_ptr<TeamDelegateMock> teamDelegateMock;
+  std::shared_ptr<FinishedTournamentCache> finishedTournaments = std::make_shared<FinishedTournamentCache>();
   std::shared_ptr<TeamController> teamController;
 
   void SetUp() override {
     teamDelegateMock = std::make_shared<TeamDelegateMock>();
-    teamController = std::make_shared<TeamController>(teamDelegateMock);
+    teamController = std::make_shared<TeamController>(teamDelegateMock, finishedTournaments);
   }
 };
 
@@ -102,7 +105,7 @@ TEST_F(TeamControllerTest, GetTeamById_NotFound) {
 
 // Validar respuesta exitosa con lista de equipos. Response 200
 TEST_F(TeamControllerTest, GetAllTeams_Ok) {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+  std::vector<domain::Team> teams;
   
   auto team1 = std::make_shared<domain::Team>();
   team1->Id = "550e8400-e29b-41d4-a716-446655440001";
@@ -112,13 +115,13 @@ TEST_F(TeamControllerTest, GetAllTeams_Ok) {
   team2->Id = "550e8400-e29b-41d4-a716-446655440002";
   team2->Name = "Team Two";
   
-  teams.push_back(team1);
-  teams.push_back(team2);
+  teams.push_back(*team1);
+  teams.push_back(*team2);
 
   EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-    .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>{std::in_place, teams}));
+    .WillOnce(testing::Return(std::expected<std::vector<domain::Team>, Error>{std::in_place, teams}));
 
-  crow::response response = teamController->getAllTeams();
+  crow::response response = teamController->getAllTeams(crow::request{});
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
@@ -131,18 +134,61 @@ TEST_F(TeamControllerTest, GetAllTeams_Ok) {
 
 // Validar respuesta exitosa con lista vacia. Response 200
 TEST_F(TeamControllerTest, GetAllTeams_Empty) {
-  std::vector<std::shared_ptr<domain::Team>> emptyTeams;
+  std::vector<domain::Team> emptyTeams;
 
   EXPECT_CALL(*teamDelegateMock, GetAllTeams())
-    .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Team>>, Error>{std::in_place, emptyTeams}));
+    .WillOnce(testing::Return(std::expected<std::vector<domain::Team>, Error>{std::in_place, emptyTeams}));
 
-  crow::response response = teamController->getAllTeams();
+  crow::response response = teamController->getAllTeams(crow::request{});
   auto jsonResponse = nlohmann::json::parse(response.body);
 
   EXPECT_EQ(crow::OK, response.code);
   ASSERT_EQ(jsonResponse.size(), 0);
 }
 
+// Validar que ?q= use la busqueda por nombre con el limite por defecto. Response 200
+TEST_F(TeamControllerTest, GetAllTeams_Search) {
+  domain::Team team;
+  team.Id = "550e8400-e29b-41d4-a716-446655440001";
+  team.Name = "Tigres";
+
+  EXPECT_CALL(*teamDelegateMock, GetAllTeams()).Times(0);
+  EXPECT_CALL(*teamDelegateMock, SearchTeams(std::string_view("tig"), DEFAULT_SEARCH_LIMIT))
+    .WillOnce(testing::Return(std::expected<std::vector<domain::Team>, Error>{std::in_place, std::vector{team}}));
+
+  crow::request request;
+  request.url_params = crow::query_string("?q=tig");
+  crow::response response = teamController->getAllTeams(request);
+  auto jsonResponse = nlohmann::json::parse(response.body);
+
+  EXPECT_EQ(crow::OK, response.code);
+  ASSERT_EQ(jsonResponse.size(), 1);
+  EXPECT_EQ(jsonResponse[0]["name"].get<std::string>(), "Tigres");
+}
+
+// Validar que un limit que no es numero se rechace. Response 400
+TEST_F(TeamControllerTest, GetAllTeams_SearchInvalidLimit) {
+  EXPECT_CALL(*teamDelegateMock, SearchTeams(testing::_, testing::_)).Times(0);
+
+  crow::request request;
+  request.url_params = crow::query_string("?q=tig&limit=abc");
+  crow::response response = teamController->getAllTeams(request);
+
+  EXPECT_EQ(crow::BAD_REQUEST, response.code);
+}
+
+// Validar que sin ?q= el limit no se valida y se devuelve la lista completa. Response 200
+TEST_F(TeamControllerTest, GetAllTeams_LimitIgnoredWithoutSearch) {
+  EXPECT_CALL(*teamDelegateMock, GetAllTeams())
+    .WillOnce(testing::Return(std::expected<std::vector<domain::Team>, Error>{std::in_place}));
+
+  crow::request request;
+  request.url_params = crow::query_string("?limit=abc");
+  crow::response response = teamController->getAllTeams(request);
+
+  EXPECT_EQ(crow::OK, response.code);
+}
+
 // Tests de UpdateTeam
 
 // Validacion del JSON y actualizacion exitosa. Response 200
@@ -166,6 +212,28 @@ TEST_F(TeamControllerTest, UpdateTeam_Ok) {
   EXPECT_EQ(teamRequestBody.at("name").get<std::string>(), capturedTeam.Name);
 }
 
+// Validar que renombrar un equipo saca de la cache los grupos de torneos terminados que lo muestran
+TEST_F(TeamControllerTest, UpdateTeam_EvictsCachedGroups) {
+  std::string teamId = "550e8400-e29b-41d4-a716-446655440000";
+  std::string tournamentId = "660e8400-e29b-41d4-a716-446655440000";
+  std::string otherTournamentId = "770e8400-e29b-41d4-a716-446655440000";
+  finishedTournaments->MarkFinished(tournamentId);
+  finishedTournaments->MarkFinished(otherTournamentId);
+  finishedTournaments->Store(tournamentId, CachedResource::GROUPS, R"([{"teams":[{"name":"Old Name"}]}])", {teamId});
+  finishedTournaments->Store(otherTournamentId, CachedResource::GROUPS, "[]", {"880e8400-e29b-41d4-a716-446655440000"});
+
+  EXPECT_CALL(*teamDelegateMock, UpdateTeam(testing::_))
+    .WillOnce(testing::Return(std::expected<std::string, Error>{std::in_place, teamId}));
+
+  crow::request teamRequest;
+  teamRequest.body = R"({"name": "New Name"})";
+  crow::response response = teamController->updateTeam(teamRequest, teamId);
+
+  EXPECT_EQ(crow::OK, response.code);
+  EXPECT_EQ(nullptr, finishedTournaments->Find(tournamentId, CachedResource::GROUPS));
+  EXPECT_NE(nullptr, finishedTournaments->Find(otherTournamentId, CachedResource::GROUPS));
+}
+
 // Validacion del JSON y equipo no encontrado. Response 404
 TEST_F(TeamControllerTest, UpdateTeam_NotFound) {
   std::string teamId = "550e8400-e29b-41d4-a716-446655440001";
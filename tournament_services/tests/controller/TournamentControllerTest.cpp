@@ -10,7 +10,9 @@ class TournamentDelegateMock : public ITournamentDelegate {
 public:
   MOCK_METHOD((std::expected<std::shared_ptr<domain::Tournament>, Error>), GetTournament,
               (std::string_view id), (override));
-  MOCK_METHOD((std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>), ReadAll, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Tournament>, Error>), ReadAll, (), (override));
+  MOCK_METHOD((std::expected<std::vector<domain::Tournament>, Error>), SearchTournaments,
+              (std::string_view query, size_t limit), (override));
   MOCK_METHOD((std::expected<std::string, Error>), CreateTournament, (const domain::Tournament&), (override));
   MOCK_METHOD((std::expected<std::string, Error>), UpdateTournament, (const domain::Tournament&), (override));
   MOCK_METHOD((std::expected<void, Error>), DeleteTournament, (std::string_view id), (override));
@@ -23,7 +25,7 @@ protected:
 
   void SetUp() override {
     tournamentDelegateMock = std::make_shared<TournamentDelegateMock>();
-    tournamentController = std::make_shared<TournamentController>(tournamentDelegateMock);
+    tournamentController = std::make_shared<TournamentController>(tournamentDelegateMock, std::make_shared<FinishedTournamentCache>());
   }
 };
 
@@ -62,6 +64,22 @@ TEST_F(TournamentControllerTest, CreateTournament_Conflict) {
   EXPECT_EQ(response.code, crow::CONFLICT);
 }
 
+// Validar que el formato del torneo se valida antes de llegar al delegate. Response 400
+TEST_F(TournamentControllerTest, CreateTournament_InvalidFormat) {
+  nlohmann::json jsonBody;
+  jsonBody["name"] = "Test Tournament";
+  jsonBody["format"] = {{"numberOfGroups", 0}};
+  crow::request request;
+  request.body = jsonBody.dump();
+
+  EXPECT_CALL(*tournamentDelegateMock, CreateTournament(testing::_)).Times(0);
+
+  auto response = tournamentController->CreateTournament(request);
+
+  EXPECT_EQ(response.code, crow::BAD_REQUEST);
+  EXPECT_EQ(response.body, "format.numberOfGroups must be a positive integer");
+}
+
 // Tests de GetTournament
 
 // Validar respuesta exitosa y contenido completo. Response 200
@@ -73,7 +91,7 @@ TEST_F(TournamentControllerTest, GetTournamentById_Ok) {
   EXPECT_CALL(*tournamentDelegateMock, GetTournament(tournamentId))
       .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>(tournament)));
 
-  auto response = tournamentController->getTournament(tournamentId);
+  auto response = tournamentController->getTournament(crow::request{}, tournamentId);
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
@@ -87,7 +105,7 @@ TEST_F(TournamentControllerTest, GetTournamentById_NotFound) {
   EXPECT_CALL(*tournamentDelegateMock, GetTournament(tournamentId))
       .WillOnce(testing::Return(std::expected<std::shared_ptr<domain::Tournament>, Error>(std::unexpected(Error::NOT_FOUND))));
 
-  auto response = tournamentController->getTournament(tournamentId);
+  auto response = tournamentController->getTournament(crow::request{}, tournamentId);
 
   EXPECT_EQ(response.code, crow::NOT_FOUND);
 }
@@ -100,12 +118,12 @@ TEST_F(TournamentControllerTest, GetAllTournaments_Ok) {
   tournament1->Id() = "tournament-1";
   auto tournament2 = std::make_shared<domain::Tournament>("Tournament 2");
   tournament2->Id() = "tournament-2";
-  std::vector<std::shared_ptr<domain::Tournament>> tournaments = {tournament1, tournament2};
+  std::vector<domain::Tournament> tournaments = {*tournament1, *tournament2};
 
   EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-      .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>(tournaments)));
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(tournaments)));
 
-  auto response = tournamentController->ReadAll();
+  auto response = tournamentController->ReadAll(crow::request{});
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
@@ -114,18 +132,59 @@ TEST_F(TournamentControllerTest, GetAllTournaments_Ok) {
 
 // Validar respuesta exitosa con lista vacia. Response 200
 TEST_F(TournamentControllerTest, GetAllTournaments_Empty) {
-  std::vector<std::shared_ptr<domain::Tournament>> emptyTournaments;
+  std::vector<domain::Tournament> emptyTournaments;
 
   EXPECT_CALL(*tournamentDelegateMock, ReadAll())
-      .WillOnce(testing::Return(std::expected<std::vector<std::shared_ptr<domain::Tournament>>, Error>(emptyTournaments)));
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(emptyTournaments)));
 
-  auto response = tournamentController->ReadAll();
+  auto response = tournamentController->ReadAll(crow::request{});
 
   EXPECT_EQ(response.code, crow::OK);
   auto jsonResponse = nlohmann::json::parse(response.body);
   EXPECT_EQ(jsonResponse.size(), 0);
 }
 
+// Validar que ?q= y limit lleguen a la busqueda por nombre. Response 200
+TEST_F(TournamentControllerTest, GetAllTournaments_Search) {
+  std::vector<domain::Tournament> tournaments = {domain::Tournament("Copa Norte")};
+
+  EXPECT_CALL(*tournamentDelegateMock, ReadAll()).Times(0);
+  EXPECT_CALL(*tournamentDelegateMock, SearchTournaments(std::string_view("copa"), 5))
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(tournaments)));
+
+  crow::request request;
+  request.url_params = crow::query_string("?q=copa&limit=5");
+  auto response = tournamentController->ReadAll(request);
+
+  EXPECT_EQ(response.code, crow::OK);
+  auto jsonResponse = nlohmann::json::parse(response.body);
+  EXPECT_EQ(jsonResponse.size(), 1);
+}
+
+// Validar que una busqueda invalida se traduzca a 400. Response 400
+TEST_F(TournamentControllerTest, GetAllTournaments_SearchInvalid) {
+  EXPECT_CALL(*tournamentDelegateMock, SearchTournaments(testing::_, testing::_))
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(std::unexpected(Error::INVALID_FORMAT))));
+
+  crow::request request;
+  request.url_params = crow::query_string("?q=");
+  auto response = tournamentController->ReadAll(request);
+
+  EXPECT_EQ(response.code, crow::BAD_REQUEST);
+}
+
+// Validar que sin ?q= el limit no se valida y se devuelve la lista completa. Response 200
+TEST_F(TournamentControllerTest, GetAllTournaments_LimitIgnoredWithoutSearch) {
+  EXPECT_CALL(*tournamentDelegateMock, ReadAll())
+      .WillOnce(testing::Return(std::expected<std::vector<domain::Tournament>, Error>(std::vector<domain::Tournament>{})));
+
+  crow::request request;
+  request.url_params = crow::query_string("?limit=-1");
+  auto response = tournamentController->ReadAll(request);
+
+  EXPECT_EQ(response.code, crow::OK);
+}
+
 // Tests de UpdateTournament
 
 // Validacion del JSON y actualizacion exitosa. Response 204
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "resilience/AdmissionController.hpp"
+
+using resilience::AdmissionController;
+using resilience::Priority;
+using resilience::Rejection;
+using resilience::RouteGate;
+
+class AdmissionControllerTest : public ::testing::Test {
+protected:
+    static constexpr std::chrono::milliseconds TARGET{5};
+    AdmissionController admission{{10, 2, 20, std::chrono::milliseconds{5}}};
+    RouteGate uncapped{0};
+};
+
+// Validar que el limite por ruta rechaza con ROUTE_LIMIT y libera el cupo al terminar
+TEST_F(AdmissionControllerTest, RouteLimit_Rejects) {
+    RouteGate gate{1};
+    {
+        auto first = admission.TryAdmit(Priority::BULK, gate);
+        ASSERT_TRUE(first.has_value());
+
+        auto second = admission.TryAdmit(Priority::BULK, gate);
+        ASSERT_FALSE(second.has_value());
+        EXPECT_EQ(second.error(), Rejection::ROUTE_LIMIT);
+    }
+    EXPECT_TRUE(admission.TryAdmit(Priority::BULK, gate).has_value());
+}
+
+// Validar que las listas masivas se rechazan antes que las escrituras criticas
+TEST_F(AdmissionControllerTest, Bulk_ShedBeforeCritical) {
+    std::vector<AdmissionController::Permit> permits;
+    while (true) {
+        auto permit = admission.TryAdmit(Priority::BULK, uncapped);
+        if (!permit) {
+            EXPECT_EQ(permit.error(), Rejection::OVERLOADED);
+            break;
+        }
+        permits.push_back(std::move(*permit));
+    }
+    EXPECT_EQ(permits.size(), 5);
+
+    EXPECT_TRUE(admission.TryAdmit(Priority::STANDARD, uncapped).has_value());
+    EXPECT_TRUE(admission.TryAdmit(Priority::CRITICAL, uncapped).has_value());
+
+    const auto snapshot = admission.Snapshot();
+    EXPECT_EQ(snapshot.rejected[static_cast<size_t>(Priority::BULK)], 1);
+    EXPECT_EQ(snapshot.inFlight, 5);
+}
+
+// Validar que la latencia por encima del objetivo reduce el limite
+TEST_F(AdmissionControllerTest, SlowRequests_DecreaseLimit) {
+    {
+        auto permit = admission.TryAdmit(Priority::STANDARD, uncapped, TARGET);
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    EXPECT_LT(admission.Snapshot().limit, 10);
+}
+
+// Validar que las rutas sin objetivo de latencia (masivas) no reducen el limite
+TEST_F(AdmissionControllerTest, SlowBulkRequests_LeaveLimit) {
+    {
+        auto permit = admission.TryAdmit(Priority::BULK, uncapped);
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(admission.Snapshot().limit, 10);
+}
+
+// Validar que cada ruta se compara con su propio objetivo de latencia
+TEST_F(AdmissionControllerTest, Latency_JudgedAgainstRouteTarget) {
+    {
+        auto permit = admission.TryAdmit(Priority::STANDARD, uncapped, std::chrono::milliseconds{500});
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+    EXPECT_EQ(admission.Snapshot().limit, 10);
+}
+
+// Validar que el limite queda por debajo de los workers HTTP, dejando workers libres para rechazar
+TEST(AdmissionConfigurationTest, FitToWorkers_KeepsSpareWorkers) {
+    const auto fitted = resilience::FitToWorkers({64, 4, 256, std::chrono::milliseconds{250}}, 16);
+    EXPECT_EQ(fitted.maxLimit, 12);
+    EXPECT_EQ(fitted.initialLimit, 12);
+    EXPECT_EQ(fitted.minLimit, 4);
+
+    const auto single = resilience::FitToWorkers({8, 2, 12, std::chrono::milliseconds{250}}, 1);
+    EXPECT_EQ(single.maxLimit, 1);
+    EXPECT_EQ(single.minLimit, 1);
+}
+
+// Validar que el limite nunca baja del minimo configurado
+TEST_F(AdmissionControllerTest, Limit_NeverBelowMinimum) {
+    for (int i = 0; i < 30; ++i) {
+        auto permit = admission.TryAdmit(Priority::CRITICAL, uncapped, TARGET);
+        std::this_thread::sleep_for(std::chrono::milliseconds{6});
+    }
+    EXPECT_GE(admission.Snapshot().limit, 2);
+}
+
+// Validar que con carga y latencia baja el limite crece
+TEST_F(AdmissionControllerTest, FastRequestsUnderLoad_IncreaseLimit) {
+    std::vector<AdmissionController::Permit> permits;
+    for (int i = 0; i < 6; ++i) {
+        permits.push_back(std::move(*admission.TryAdmit(Priority::CRITICAL, uncapped, TARGET)));
+    }
+    permits.clear();
+
+    EXPECT_GT(admission.Snapshot().limit, 10);
+}
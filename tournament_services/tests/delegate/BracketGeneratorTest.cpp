@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <vector>
+#include <set>
 #include <unordered_set>
 #include <algorithm>
 
@@ -228,3 +229,44 @@ TEST_F(BracketGeneratorTest, ThrowsExceptionForWrongNumberOfTeams) {
     
     EXPECT_THROW(generator->GenerateMatches(tournamentId, wrongTeams), std::invalid_argument);
 }
+
+TEST_F(BracketGeneratorTest, GroupStagePlaysEveryPairOnce) {
+    std::vector<domain::Team> group(teams.begin(), teams.begin() + 5);
+    auto matches = generator->GenerateGroupStage(tournamentId, "group-1", group);
+
+    EXPECT_EQ(matches.size(), 10) << "5 teams play 5 * 4 / 2 matches";
+
+    std::set<std::pair<std::string, std::string>> pairs;
+    std::unordered_set<std::string> names;
+    for (const auto& match : matches) {
+        EXPECT_EQ(match.GroupId(), "group-1");
+        EXPECT_NE(match.HomeTeamId(), match.VisitorTeamId());
+        pairs.insert(std::minmax(match.HomeTeamId(), match.VisitorTeamId()));
+        names.insert(match.Name());
+    }
+    EXPECT_EQ(pairs.size(), 10) << "No pairing should repeat";
+    EXPECT_EQ(names.size(), 10) << "Match names should be unique within the group";
+}
+
+TEST_F(BracketGeneratorTest, SeededBracketKeepsTopSeedsApart) {
+    auto matches = generator->GenerateSeededBracket(tournamentId);
+
+    ASSERT_EQ(matches.size(), 63);
+    std::unordered_set<std::string> seeds;
+    for (const auto& match : matches) {
+        if (match.Name() == "W0") {
+            EXPECT_EQ(match.HomeTeamId(), "1");
+            EXPECT_EQ(match.VisitorTeamId(), "32");
+        }
+        if (match.Name() == "W8") {
+            EXPECT_EQ(match.HomeTeamId(), "2") << "Seed 2 starts in the other half of the winners bracket";
+        }
+        if (!match.HomeTeamId().empty()) {
+            seeds.insert(match.HomeTeamId());
+            seeds.insert(match.VisitorTeamId());
+            // each first round pairing adds up to 33
+            EXPECT_EQ(std::stoi(match.HomeTeamId()) + std::stoi(match.VisitorTeamId()), 33);
+        }
+    }
+    EXPECT_EQ(seeds.size(), 32);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+#include "persistence/configuration/BulkheadConnectionProvider.hpp"
+#include "persistence/configuration/CircuitBreakingConnectionProvider.hpp"
+
+// Pool de prueba que solo cuenta cuantas conexiones entrego
+class CountingConnectionProvider : public IDbConnectionProvider {
+public:
+    int borrowed = 0;
+    using IDbConnectionProvider::Connection;
+
+    PooledConnection Connection() override {
+        ++borrowed;
+        return PooledConnection(nullptr, [](IDbConnection*) {});
+    }
+};
+
+class BulkheadConnectionProviderTest : public ::testing::Test {
+protected:
+    std::shared_ptr<CountingConnectionProvider> interactive = std::make_shared<CountingConnectionProvider>();
+    std::shared_ptr<CountingConnectionProvider> bulk = std::make_shared<CountingConnectionProvider>();
+};
+
+// Validar que cada carga de trabajo usa su propio pool
+TEST_F(BulkheadConnectionProviderTest, Workload_UsesOwnPool) {
+    BulkheadConnectionProvider provider({{Workload::INTERACTIVE, interactive}, {Workload::BULK, bulk}});
+
+    provider.Connection(Workload::BULK);
+    provider.Connection(Workload::BULK);
+    provider.Connection(Workload::INTERACTIVE);
+
+    EXPECT_EQ(bulk->borrowed, 2);
+    EXPECT_EQ(interactive->borrowed, 1);
+}
+
+// Validar que una carga sin pool propio comparte el interactivo
+TEST_F(BulkheadConnectionProviderTest, WorkloadWithoutPool_UsesInteractive) {
+    BulkheadConnectionProvider provider({{Workload::INTERACTIVE, interactive}, {Workload::BULK, bulk}});
+
+    provider.Connection(Workload::WRITE);
+    provider.Connection();
+
+    EXPECT_EQ(interactive->borrowed, 2);
+    EXPECT_EQ(bulk->borrowed, 0);
+}
+
+// Validar que el pool interactivo es obligatorio
+TEST_F(BulkheadConnectionProviderTest, MissingInteractive_Throws) {
+    EXPECT_THROW(BulkheadConnectionProvider({{Workload::BULK, bulk}}), std::invalid_argument);
+}
+
+// Pool de prueba cuyo checkout siempre falla, como un pool saturado
+class SaturatedConnectionProvider : public IDbConnectionProvider {
+public:
+    using IDbConnectionProvider::Connection;
+
+    PooledConnection Connection() override {
+        throw std::runtime_error("pool wait exceeded");
+    }
+};
+
+// Validar que los fallos del pool masivo abren solo su interruptor y no el de las escrituras
+TEST_F(BulkheadConnectionProviderTest, BreakerPerPool_BulkFailuresStayInBulk) {
+    const resilience::CircuitBreakerConfiguration settings{1, std::chrono::milliseconds{10000}};
+    auto bulkBreaker = std::make_shared<resilience::CircuitBreaker>("postgres.bulk", settings);
+    auto interactiveBreaker = std::make_shared<resilience::CircuitBreaker>("postgres.interactive", settings);
+    BulkheadConnectionProvider provider({
+        {Workload::INTERACTIVE, std::make_shared<CircuitBreakingConnectionProvider>(interactive, interactiveBreaker)},
+        {Workload::BULK, std::make_shared<CircuitBreakingConnectionProvider>(std::make_shared<SaturatedConnectionProvider>(), bulkBreaker)}});
+
+    EXPECT_THROW(provider.Connection(Workload::BULK), std::runtime_error);
+    EXPECT_THROW(provider.Connection(Workload::BULK), CircuitOpenException);
+
+    EXPECT_EQ(bulkBreaker->Snapshot().state, resilience::CircuitState::OPEN);
+    EXPECT_EQ(interactiveBreaker->Snapshot().state, resilience::CircuitState::CLOSED);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "resilience/CircuitBreakerRegistry.hpp"
+
+class CircuitBreakerTest : public ::testing::Test {
+protected:
+    resilience::CircuitBreaker circuitBreaker{"postgres", {2, std::chrono::milliseconds{20}}};
+
+    void fail() {
+        EXPECT_THROW(circuitBreaker.Execute([] { throw std::runtime_error("connection refused"); }), std::runtime_error);
+    }
+};
+
+// Validar que el circuito se abre al alcanzar el umbral de fallos consecutivos
+TEST_F(CircuitBreakerTest, ConsecutiveFailures_Opens) {
+    fail();
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::CLOSED);
+    fail();
+
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::OPEN);
+    EXPECT_EQ(circuitBreaker.Snapshot().opened, 1);
+}
+
+// Validar que con el circuito abierto la llamada falla rapido sin llegar a la dependencia
+TEST_F(CircuitBreakerTest, Open_FailsFast) {
+    fail();
+    fail();
+    resilience::CircuitBreaker::TakeRejected();
+
+    bool called = false;
+    EXPECT_THROW(circuitBreaker.Execute([&] { called = true; }), CircuitOpenException);
+
+    EXPECT_FALSE(called);
+    EXPECT_EQ(circuitBreaker.Snapshot().rejected, 1);
+    EXPECT_TRUE(resilience::CircuitBreaker::TakeRejected());
+    EXPECT_FALSE(resilience::CircuitBreaker::TakeRejected());
+}
+
+// Validar que un exito intermedio reinicia el conteo de fallos
+TEST_F(CircuitBreakerTest, Success_ResetsFailures) {
+    fail();
+    circuitBreaker.Execute([] {});
+    fail();
+
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::CLOSED);
+}
+
+// Validar que tras el tiempo de apertura una sola prueba pasa y su exito cierra el circuito
+TEST_F(CircuitBreakerTest, HalfOpen_ProbeSuccess_Closes) {
+    fail();
+    fail();
+    std::this_thread::sleep_for(std::chrono::milliseconds{30});
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::HALF_OPEN);
+
+    const auto probe = circuitBreaker.Acquire();
+    EXPECT_EQ(probe, resilience::Admission::PROBE);
+    EXPECT_THROW((void) circuitBreaker.Acquire(), CircuitOpenException);
+    circuitBreaker.RecordSuccess(probe);
+
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::CLOSED);
+}
+
+// Validar que el exito o fallo de una llamada admitida antes de abrir no decide el circuito semiabierto
+TEST_F(CircuitBreakerTest, HalfOpen_StaleOutcome_Ignored) {
+    const auto stale = circuitBreaker.Acquire();
+    fail();
+    fail();
+    std::this_thread::sleep_for(std::chrono::milliseconds{30});
+    const auto probe = circuitBreaker.Acquire();
+
+    circuitBreaker.RecordSuccess(stale);
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::HALF_OPEN);
+    circuitBreaker.RecordFailure(stale);
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::HALF_OPEN);
+
+    circuitBreaker.RecordSuccess(probe);
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::CLOSED);
+}
+
+// Validar que si la prueba falla el circuito vuelve a abrirse
+TEST_F(CircuitBreakerTest, HalfOpen_ProbeFailure_Reopens) {
+    fail();
+    fail();
+    std::this_thread::sleep_for(std::chrono::milliseconds{30});
+
+    fail();
+
+    EXPECT_EQ(circuitBreaker.Snapshot().state, resilience::CircuitState::OPEN);
+    EXPECT_EQ(circuitBreaker.Snapshot().opened, 2);
+}
+
+// Validar que la configuracion se toma por nombre y usa valores por defecto si falta
+TEST(CircuitBreakerRegistryTest, Create_ReadsConfigurationByName) {
+    resilience::CircuitBreakerRegistry registry;
+    const auto configuration = nlohmann::json::parse(R"({"postgres":{"failureThreshold":1}})");
+    auto postgres = registry.Create("postgres", configuration);
+    registry.Create("activemq", configuration);
+
+    EXPECT_THROW(postgres->Execute([] { throw std::runtime_error("down"); }), std::runtime_error);
+
+    const auto snapshots = registry.Snapshots();
+    ASSERT_EQ(snapshots.size(), 2);
+    EXPECT_EQ(snapshots[0].name, "postgres");
+    EXPECT_EQ(snapshots[0].state, resilience::CircuitState::OPEN);
+    EXPECT_EQ(snapshots[1].name, "activemq");
+    EXPECT_EQ(snapshots[1].state, resilience::CircuitState::CLOSED);
+}
+
+// Validar que un interruptor por pool toma la configuracion de su familia si no tiene entrada propia
+TEST(CircuitBreakerRegistryTest, Create_FallsBackToFamily) {
+    resilience::CircuitBreakerRegistry registry;
+    const auto configuration = nlohmann::json::parse(R"({"postgres":{"failureThreshold":1},"postgres.bulk":{"failureThreshold":3}})");
+    auto write = registry.Create("postgres.write", configuration);
+    auto bulk = registry.Create("postgres.bulk", configuration);
+
+    EXPECT_THROW(bulk->Execute([] { throw std::runtime_error("pool wait"); }), std::runtime_error);
+    EXPECT_THROW(write->Execute([] { throw std::runtime_error("down"); }), std::runtime_error);
+
+    EXPECT_EQ(write->Snapshot().state, resilience::CircuitState::OPEN);
+    EXPECT_EQ(bulk->Snapshot().state, resilience::CircuitState::CLOSED);
+}
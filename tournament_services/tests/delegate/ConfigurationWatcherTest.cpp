@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "configuration/ConfigurationWatcher.hpp"
+
+class ConfigurationWatcherTest : public ::testing::Test {
+protected:
+    std::filesystem::path path;
+
+    void SetUp() override {
+        path = std::filesystem::temp_directory_path() / ("configuration_watcher_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".json");
+        write(R"({"admission": {"maxLimit": 256}, "idempotency": {"cacheSize": 10}})");
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    void write(const std::string& content) const {
+        std::ofstream(path) << content;
+    }
+};
+
+// Validar que solo se notifica la seccion que cambio
+TEST_F(ConfigurationWatcherTest, Reload_NotifiesChangedSection) {
+    config::ConfigurationWatcher watcher(path);
+    std::vector<nlohmann::json> admission;
+    std::vector<nlohmann::json> idempotency;
+    watcher.Subscribe("/admission", [&](const nlohmann::json& section) { admission.push_back(section); });
+    watcher.Subscribe("/idempotency/cacheSize", [&](const nlohmann::json& section) { idempotency.push_back(section); });
+
+    write(R"({"admission": {"maxLimit": 512}, "idempotency": {"cacheSize": 10}})");
+    auto reloaded = watcher.Reload();
+
+    ASSERT_TRUE(reloaded.has_value());
+    EXPECT_TRUE(*reloaded);
+    ASSERT_EQ(admission.size(), 1);
+    EXPECT_EQ(admission[0]["maxLimit"], 512);
+    EXPECT_TRUE(idempotency.empty());
+    EXPECT_EQ((*watcher.Current())["admission"]["maxLimit"], 512);
+    EXPECT_EQ(watcher.Status()["generation"], 2);
+}
+
+// Validar que un archivo invalido conserva la configuracion activa
+TEST_F(ConfigurationWatcherTest, Reload_MalformedKeepsSnapshot) {
+    config::ConfigurationWatcher watcher(path);
+    const auto before = watcher.Current();
+
+    write(R"({"admission": )");
+    auto reloaded = watcher.Reload();
+
+    EXPECT_FALSE(reloaded.has_value());
+    EXPECT_EQ(watcher.Current(), before);
+    EXPECT_FALSE(watcher.Status()["lastError"].is_null());
+}
+
+// Validar que un archivo sin cambios no instala una nueva generacion
+TEST_F(ConfigurationWatcherTest, Reload_UnchangedIsNoop) {
+    config::ConfigurationWatcher watcher(path);
+
+    auto reloaded = watcher.Reload();
+
+    ASSERT_TRUE(reloaded.has_value());
+    EXPECT_FALSE(*reloaded);
+    EXPECT_EQ(watcher.Status()["generation"], 1);
+}
+
+// Validar que un listener que falla no impide aplicar los demas
+TEST_F(ConfigurationWatcherTest, Reload_FailingListenerIsolated) {
+    config::ConfigurationWatcher watcher(path);
+    bool applied = false;
+    watcher.Subscribe("/admission", [](const nlohmann::json&) { throw std::runtime_error("bad value"); });
+    watcher.Subscribe("/idempotency", [&](const nlohmann::json&) { applied = true; });
+
+    write(R"({"admission": {"maxLimit": 1}, "idempotency": {"cacheSize": 20}})");
+    watcher.Reload();
+
+    EXPECT_TRUE(applied);
+    EXPECT_NE(watcher.Status()["lastError"].get<std::string>().find("bad value"), std::string::npos);
+}
+
+// Validar que las credenciales no se exponen en el endpoint de administracion
+TEST_F(ConfigurationWatcherTest, Redacted_MasksSecrets) {
+    const auto redacted = config::ConfigurationWatcher::Redacted({
+        {"databaseConfig", {{"connectionString", "postgresql://svc:secret@db:5432/tournaments"}}},
+        {"admin", {{"token", "abc"}}},
+    });
+
+    EXPECT_EQ(redacted["databaseConfig"]["connectionString"], "postgresql://svc:***@db:5432/tournaments");
+    EXPECT_EQ(redacted["admin"]["token"], "***");
+}
+
+// Validar que una seccion eliminada vuelve a los valores por defecto
+TEST_F(ConfigurationWatcherTest, Reload_RemovedSectionGetsFallback) {
+    config::ConfigurationWatcher watcher(path);
+    std::vector<nlohmann::json> admission;
+    std::vector<nlohmann::json> idempotency;
+    watcher.Subscribe("/admission", [&](const nlohmann::json& section) { admission.push_back(section); });
+    watcher.Subscribe("/idempotency/cacheSize", [&](const nlohmann::json& section) { idempotency.push_back(section); }, 4096);
+
+    write(R"({})");
+    watcher.Reload();
+
+    ASSERT_EQ(admission.size(), 1);
+    EXPECT_EQ(admission[0], nlohmann::json::object());
+    ASSERT_EQ(idempotency.size(), 1);
+    EXPECT_EQ(idempotency[0], 4096);
+}
+
+// Validar que un listener en curso no bloquea la consulta del estado
+TEST_F(ConfigurationWatcherTest, Reload_ListenerDoesNotBlockStatus) {
+    config::ConfigurationWatcher watcher(path);
+    nlohmann::json status;
+    watcher.Subscribe("/admission", [&](const nlohmann::json&) { status = watcher.Status(); });
+
+    write(R"({"admission": {"maxLimit": 1}, "idempotency": {"cacheSize": 10}})");
+    watcher.Reload();
+
+    EXPECT_EQ(status["generation"], 2);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "persistence/decoder/DocumentDecoders.hpp"
+#include "domain/Group.hpp"
+#include "domain/Match.hpp"
+#include "domain/Tournament.hpp"
+
+class DocumentDecoderTest : public ::testing::Test {
+protected:
+    std::shared_ptr<IDocumentDecoder> simdDecoder = std::make_shared<SimdDocumentDecoder>();
+    std::shared_ptr<IDocumentDecoder> jsonDecoder = std::make_shared<JsonDocumentDecoder>();
+};
+
+// Validar que ambos decodificadores producen el mismo grupo, incluyendo los equipos embebidos
+TEST_F(DocumentDecoderTest, Group_SameAsJson) {
+    const std::string document = R"({"name":"Group A","tournamentId":"550e8400-e29b-41d4-a716-446655440000","teams":[{"id":"550e8400-e29b-41d4-a716-446655440001","name":"Team \"One\""},{"id":"550e8400-e29b-41d4-a716-446655440002","name":"Team Two"}]})";
+
+    domain::Group simdGroup;
+    domain::Group jsonGroup;
+    simdDecoder->Decode(document, simdGroup);
+    jsonDecoder->Decode(document, jsonGroup);
+
+    EXPECT_EQ(simdGroup.Name(), jsonGroup.Name());
+    EXPECT_EQ(simdGroup.TournamentId(), jsonGroup.TournamentId());
+    ASSERT_EQ(simdGroup.Teams().size(), 2);
+    ASSERT_EQ(jsonGroup.Teams().size(), 2);
+    EXPECT_EQ(simdGroup.Teams()[0].Id, jsonGroup.Teams()[0].Id);
+    EXPECT_EQ(simdGroup.Teams()[0].Name, "Team \"One\"");
+    EXPECT_EQ(simdGroup.Teams()[1].Name, jsonGroup.Teams()[1].Name);
+}
+
+// Validar el marcador y los equipos de un match
+TEST_F(DocumentDecoderTest, Match_Ok) {
+    const std::string document = R"({"name":"W0","tournamentId":"t-1","homeTeamId":"home","visitorTeamId":"visitor","score":{"homeTeamScore":3,"visitorTeamScore":1}})";
+
+    domain::Match match;
+    simdDecoder->Decode(document, match);
+
+    EXPECT_EQ(match.Name(), "W0");
+    EXPECT_EQ(match.HomeTeamId(), "home");
+    EXPECT_EQ(match.VisitorTeamId(), "visitor");
+    EXPECT_EQ(match.MatchScore().homeTeamScore, 3);
+    EXPECT_EQ(match.MatchScore().visitorTeamScore, 1);
+}
+
+// Validar que el formato del torneo se lee completo
+TEST_F(DocumentDecoderTest, Tournament_Ok) {
+    const std::string document = R"({"name":"Cup","format":{"maxTeamsPerGroup":8,"numberOfGroups":4,"type":"DOUBLE_ELIMINATION"}})";
+
+    domain::Tournament tournament;
+    simdDecoder->Decode(document, tournament);
+
+    EXPECT_EQ(tournament.Name(), "Cup");
+    EXPECT_EQ(tournament.Format().MaxTeamsPerGroup(), 8);
+    EXPECT_EQ(tournament.Format().NumberOfGroups(), 4);
+}
+
+// Validar la seleccion por repositorio desde la configuracion
+TEST_F(DocumentDecoderTest, SelectedPerRepository) {
+    const nlohmann::json databaseConfig = {{"documentDecoder", {{"default", "simdjson"}, {"teams", "nlohmann"}}}};
+
+    EXPECT_NE(dynamic_cast<SimdDocumentDecoder*>(config::documentDecoder(databaseConfig, "groups").get()), nullptr);
+    EXPECT_NE(dynamic_cast<JsonDocumentDecoder*>(config::documentDecoder(databaseConfig, "teams").get()), nullptr);
+    EXPECT_NE(dynamic_cast<JsonDocumentDecoder*>(config::documentDecoder(nlohmann::json::object(), "groups").get()), nullptr);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <expected>
+#include <string>
+
+#include "domain/Tournament.hpp"
+#include "delegate/ExportDelegate.hpp"
+#include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/IExportRepository.hpp"
+#include "exception/Error.hpp"
+
+class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
+public:
+    MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
+    MOCK_METHOD(void, Delete, (std::string id), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
+};
+
+class MockExportRepository : public IExportRepository {
+public:
+    MOCK_METHOD(void, ExportTournament, (const std::string_view& tournamentId, ExportFormat format, const ExportSink& sink), (override));
+    MOCK_METHOD(void, ExportAll, (ExportFormat format, const ExportSink& sink), (override));
+};
+
+class ExportDelegateTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockTournamentRepository> mockTournamentRepository;
+    std::shared_ptr<MockExportRepository> mockExportRepository;
+    std::shared_ptr<ExportDelegate> exportDelegate;
+
+    void SetUp() override {
+        mockTournamentRepository = std::make_shared<MockTournamentRepository>();
+        mockExportRepository = std::make_shared<MockExportRepository>();
+        exportDelegate = std::make_shared<ExportDelegate>(mockTournamentRepository, mockExportRepository);
+    }
+};
+
+// Validar que las filas del repositorio llegan al sink sin transformaciones
+TEST_F(ExportDelegateTest, ExportTournament_Ok) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+    auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
+    tournament->Id() = tournamentId;
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*mockExportRepository, ExportTournament(testing::Eq(tournamentId), ExportFormat::NDJSON, testing::_))
+        .WillOnce([](const std::string_view&, ExportFormat, const ExportSink& sink) {
+            sink("{\"type\":\"tournament\"}\n");
+            sink("{\"type\":\"match\"}\n");
+        });
+
+    std::string exported;
+    auto result = exportDelegate->ExportTournament(tournamentId, ExportFormat::NDJSON, [&exported](std::string_view line) {
+        exported.append(line);
+    });
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(exported, "{\"type\":\"tournament\"}\n{\"type\":\"match\"}\n");
+}
+
+// Validar que no se exporta un torneo inexistente
+TEST_F(ExportDelegateTest, ExportTournament_NotFound) {
+    std::string tournamentId = "550e8400-e29b-41d4-a716-446655440000";
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
+        .WillOnce(testing::Return(nullptr));
+    EXPECT_CALL(*mockExportRepository, ExportTournament(testing::_, testing::_, testing::_)).Times(0);
+
+    auto result = exportDelegate->ExportTournament(tournamentId, ExportFormat::CSV, [](std::string_view) {});
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::NOT_FOUND);
+}
+
+// Validar que un ID invalido nunca llega a la sentencia COPY
+TEST_F(ExportDelegateTest, ExportTournament_InvalidFormat) {
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::_)).Times(0);
+    EXPECT_CALL(*mockExportRepository, ExportTournament(testing::_, testing::_, testing::_)).Times(0);
+
+    auto result = exportDelegate->ExportTournament("1'; drop table matches; --", ExportFormat::NDJSON, [](std::string_view) {});
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::INVALID_FORMAT);
+}
+
+// Validar error de base de datos durante la exportacion completa
+TEST_F(ExportDelegateTest, ExportAll_Error) {
+    EXPECT_CALL(*mockExportRepository, ExportAll(ExportFormat::NDJSON, testing::_))
+        .WillOnce(testing::Throw(std::runtime_error("connection lost")));
+
+    auto result = exportDelegate->ExportAll(ExportFormat::NDJSON, [](std::string_view) {});
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::UNKNOWN_ERROR);
+}
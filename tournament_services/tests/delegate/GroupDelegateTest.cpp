@@ -12,7 +12,9 @@
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/TeamRepository.hpp"
+#include "persistence/repository/ITeamDictionary.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/decoder/JsonDocumentDecoder.hpp"
 #include "cms/IQueueMessageProducer.hpp"
 #include "exception/Error.hpp"
 
@@ -23,35 +25,41 @@ public:
 
 class MockGroupRepository : public IGroupRepository {
     public:
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, FindByTournamentId, (const std::string_view& tournamentId), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Group& entity), (override));
+    MOCK_METHOD(std::vector<domain::Group>, FindByTournamentId, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Group& entity), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, ReadById, (std::string id), (override));
     MOCK_METHOD(std::string, Update, (const domain::Group& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Group>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Group>, ReadAll, (), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndGroupId, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByTournamentIdAndTeamId, (const std::string_view& tournamentId, const std::string_view& teamId), (override));   
     MOCK_METHOD(std::shared_ptr<domain::Group>, FindByGroupIdAndTeamId, (const std::string_view& groupId, const std::string_view& teamId), (override));
     MOCK_METHOD(void, UpdateGroupAddTeam, (const std::string_view& groupId, const std::shared_ptr<domain::Team> & team), (override));
 };
 
+class MockTeamDictionary : public ITeamDictionary {
+public:
+    MOCK_METHOD((std::unordered_map<std::string, std::string>), Names, (const std::vector<std::string>& teamIds), (override));
+    MOCK_METHOD(void, Invalidate, (std::string_view teamId), (override));
+};
+
 // Solo implementan Interfaces
 class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
 };
 
 class MockTeamRepository : public IRepository<domain::Team, std::string_view> {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string_view id), (override));
-    MOCK_METHOD(std::string_view, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Team& entity), (override));
     MOCK_METHOD(std::string_view, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string_view id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadAll, (), (override));
 };
 
 // Necesario para que puedan ser usadas por GroupDeleagate
@@ -72,13 +80,13 @@ private:
 
 public:
     TournamentRepositoryAdapter(std::shared_ptr<IRepository<domain::Tournament, std::string>> mockRepo) 
-        : TournamentRepository(CreateDummyProvider()), mock(mockRepo) {}
+        : TournamentRepository(CreateDummyProvider(), std::make_shared<JsonDocumentDecoder>()), mock(mockRepo) {}
     
     std::shared_ptr<domain::Tournament> ReadById(std::string id) override { return mock->ReadById(id); }
-    std::string Create(const domain::Tournament& entity) override { return mock->Create(entity); }
+    std::expected<std::string, Error> Create(const domain::Tournament& entity) override { return mock->Create(entity); }
     std::string Update(const domain::Tournament& entity) override { return mock->Update(entity); }
     void Delete(std::string id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Tournament> ReadAll() override { return mock->ReadAll(); }
 };
 
 class TeamRepositoryAdapter : public TeamRepository {
@@ -98,13 +106,13 @@ private:
 
 public:
     TeamRepositoryAdapter(std::shared_ptr<IRepository<domain::Team, std::string_view>> mockRepo) 
-        : TeamRepository(CreateDummyProvider()), mock(mockRepo) {}
+        : TeamRepository(CreateDummyProvider(), std::make_shared<JsonDocumentDecoder>()), mock(mockRepo) {}
     
     std::shared_ptr<domain::Team> ReadById(std::string_view id) override { return mock->ReadById(id); }
-    std::string_view Create(const domain::Team& entity) override { return mock->Create(entity); }
+    std::expected<std::string, Error> Create(const domain::Team& entity) override { return mock->Create(entity); }
     std::string_view Update(const domain::Team& entity) override { return mock->Update(entity); }
     void Delete(std::string_view id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Team>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Team> ReadAll() override { return mock->ReadAll(); }
 };
 
 class GroupDelegateTest : public ::testing::Test {
@@ -113,6 +121,7 @@ class GroupDelegateTest : public ::testing::Test {
     std::shared_ptr<MockGroupRepository> mockGroupRepository;
     std::shared_ptr<MockTeamRepository> mockTeamRepository;
     std::shared_ptr<MockQueueMessageProducer> mockMessageProducer;
+    std::shared_ptr<MockTeamDictionary> mockTeamDictionary;
     std::shared_ptr<TournamentRepositoryAdapter> tournamentAdapter;
     std::shared_ptr<TeamRepositoryAdapter> teamAdapter;
     std::shared_ptr<GroupDelegate> groupDelegate;
@@ -126,11 +135,12 @@ class GroupDelegateTest : public ::testing::Test {
         mockGroupRepository = std::make_shared<MockGroupRepository>();
         mockTeamRepository = std::make_shared<MockTeamRepository>();
         mockMessageProducer = std::make_shared<MockQueueMessageProducer>();
+        mockTeamDictionary = std::make_shared<MockTeamDictionary>();
         
         tournamentAdapter = std::make_shared<TournamentRepositoryAdapter>(mockTournamentRepository);
         teamAdapter = std::make_shared<TeamRepositoryAdapter>(mockTeamRepository);
         
-        groupDelegate = std::make_shared<GroupDelegate>(tournamentAdapter, mockGroupRepository, teamAdapter, mockMessageProducer);
+        groupDelegate = std::make_shared<GroupDelegate>(tournamentAdapter, mockGroupRepository, teamAdapter, mockMessageProducer, mockTeamDictionary);
     }
 };
 
@@ -169,17 +179,13 @@ TEST_F(GroupDelegateTest, CreateGroup_Error) {
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(validTournamentId)))
         .WillOnce(testing::Return(tournament));
     
-    auto create_unique_violation = []() -> pqxx::unique_violation {
-        return pqxx::unique_violation("duplicate key value violates unique constraint", "", "23505");
-    };
-    
     EXPECT_CALL(*mockGroupRepository, Create(testing::_))
         .WillOnce(testing::DoAll(
             testing::WithArg<0>(testing::Invoke([&](const domain::Group& g) {
                 EXPECT_EQ(g.TournamentId(), validTournamentId);
                 EXPECT_EQ(g.Name(), "Test Group");
             })),
-            testing::Throw(create_unique_violation())
+            testing::Return(std::unexpected(Error::DUPLICATE))
         ));
 
     auto result = groupDelegate->CreateGroup(validTournamentId, group);
@@ -228,7 +234,6 @@ TEST_F(GroupDelegateTest, GetGroup_Ok) {
     EXPECT_CALL(*mockGroupRepository, FindByTournamentIdAndGroupId(
         testing::Eq(validTournamentId), 
         testing::Eq(validGroupId)))
-        .WillOnce(testing::Return(group))
         .WillOnce(testing::Return(group));
 
     auto result = groupDelegate->GetGroup(validTournamentId, validGroupId);
@@ -239,6 +244,31 @@ TEST_F(GroupDelegateTest, GetGroup_Ok) {
     EXPECT_EQ((*result)->TournamentId(), validTournamentId);
 }
 
+// Validar que los nombres de los equipos se resuelven desde el diccionario en una sola consulta
+TEST_F(GroupDelegateTest, GetGroups_ResolvesTeamNames) {
+    auto tournament = std::make_shared<domain::Tournament>(domain::Tournament{"Tournament Name"});
+    tournament->Id() = validTournamentId;
+    domain::Group first{"Group A", validGroupId};
+    first.Teams().push_back(domain::Team{validTeamId, ""});
+    domain::Group second{"Group B", "11111111-2222-3333-4444-555555555555"};
+    second.Teams().push_back(domain::Team{"66666666-7777-8888-9999-000000000000", ""});
+
+    EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(validTournamentId)))
+        .WillOnce(testing::Return(tournament));
+    EXPECT_CALL(*mockGroupRepository, FindByTournamentId(testing::Eq(validTournamentId)))
+        .WillOnce(testing::Return(std::vector<domain::Group>{first, second}));
+    EXPECT_CALL(*mockTeamDictionary, Names(testing::SizeIs(2)))
+        .WillOnce(testing::Return(std::unordered_map<std::string, std::string>{{validTeamId, "Renamed Team"}}));
+
+    auto result = groupDelegate->GetGroups(validTournamentId);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 2);
+    EXPECT_EQ((*result)[0].Teams()[0].Name, "Renamed Team");
+    // Un equipo borrado conserva su id sin nombre
+    EXPECT_EQ((*result)[1].Teams()[0].Name, "");
+}
+
 // Validar busqueda con resultado nulo
 TEST_F(GroupDelegateTest, GetGroup_NotFound) {
     auto tournament = std::make_shared<domain::Tournament>(domain::Tournament{"Tournament Name"});
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <memory>
+#include <expected>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "delegate/ImportDelegate.hpp"
+#include "persistence/repository/IImportRepository.hpp"
+#include "exception/Error.hpp"
+
+class MockImportRepository : public IImportRepository {
+public:
+    MOCK_METHOD(ImportSummary, Import, (const ImportSource& source), (override));
+};
+
+class ImportDelegateTest : public ::testing::Test {
+protected:
+    std::shared_ptr<MockImportRepository> mockImportRepository;
+    std::shared_ptr<ImportDelegate> importDelegate;
+
+    void SetUp() override {
+        mockImportRepository = std::make_shared<MockImportRepository>();
+        importDelegate = std::make_shared<ImportDelegate>(mockImportRepository);
+    }
+};
+
+// Validar que el cuerpo se entrega al repositorio linea por linea
+TEST_F(ImportDelegateTest, Import_Ok) {
+    std::vector<std::string> lines;
+    EXPECT_CALL(*mockImportRepository, Import(testing::_))
+        .WillOnce([&lines](const ImportSource& source) {
+            std::string line;
+            while (source(line)) {
+                lines.push_back(line);
+            }
+            ImportSummary summary;
+            summary.lines = lines.size();
+            summary.staged = lines.size();
+            summary.teamsCreated = 2;
+            return summary;
+        });
+
+    auto result = importDelegate->Import("{\"type\":\"team\",\"name\":\"A\"}\n{\"type\":\"team\",\"name\":\"B\"}");
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->teamsCreated, 2);
+    ASSERT_EQ(lines.size(), 2);
+    EXPECT_EQ(lines[0], "{\"type\":\"team\",\"name\":\"A\"}");
+    EXPECT_EQ(lines[1], "{\"type\":\"team\",\"name\":\"B\"}");
+}
+
+// Validar que un cuerpo vacio se rechaza sin tocar el repositorio
+TEST_F(ImportDelegateTest, Import_EmptyBody) {
+    EXPECT_CALL(*mockImportRepository, Import(testing::_)).Times(0);
+
+    auto result = importDelegate->Import("");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::INVALID_FORMAT);
+}
+
+// Validar que un error de base de datos se reporta como UNKNOWN_ERROR
+TEST_F(ImportDelegateTest, Import_RepositoryFailure) {
+    EXPECT_CALL(*mockImportRepository, Import(testing::_))
+        .WillOnce(testing::Throw(std::runtime_error("connection lost")));
+
+    auto result = importDelegate->Import("{\"type\":\"team\",\"name\":\"A\"}\n");
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), Error::UNKNOWN_ERROR);
+}
@@ -9,6 +9,7 @@
 #include "persistence/repository/TournamentRepository.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "persistence/configuration/IDbConnectionProvider.hpp"
+#include "persistence/decoder/JsonDocumentDecoder.hpp"
 #include "cms/IQueueMessageProducer.hpp"
 #include "exception/Error.hpp"
 
@@ -17,24 +18,34 @@ class MockMatchRepository : public IMatchRepository {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndMatchId,
                 (const std::string_view& tournamentId, const std::string_view& matchId), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Match>>, FindByTournamentId,
+    MOCK_METHOD(std::vector<domain::Match>, FindByTournamentId,
                 (const std::string_view& tournamentId), (override));
     MOCK_METHOD(std::shared_ptr<domain::Match>, FindByTournamentIdAndName,
                 (const std::string_view& tournamentId, const std::string_view& name), (override));
     MOCK_METHOD(std::vector<std::string>, CreateBulk, (const std::vector<domain::Match>& matches), (override));
-    MOCK_METHOD(void, Update, (const std::string_view& matchId, const domain::Match& match), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateBracket, (const std::string_view& tournamentId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<std::string>, CreateGroupMatches,
+                (const std::string_view& tournamentId, const std::string_view& groupId, const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(void, Update, (const std::string_view& matchId, const domain::Match& match, Durability durability), (override));
+    MOCK_METHOD(bool, AdvanceTeam, (const std::string_view& tournamentId, const std::string_view& matchName, const std::string_view& teamId, Durability durability),
+                (override));
     MOCK_METHOD(void, UpdateMatchScore, (const std::string_view& matchId, const domain::Score& score), (override));
     MOCK_METHOD(bool, MatchesExistForTournament, (const std::string_view& tournamentId), (override));
+    MOCK_METHOD(void, UpdateSchedules, (const std::vector<domain::Match>& matches), (override));
+    MOCK_METHOD(std::vector<domain::Schedule>, FindVenueBookings, (const std::string_view& tournamentId, int64_t from), (override));
+    MOCK_METHOD(bool, MatchesExistForGroup, (const std::string_view& tournamentId, const std::string_view& groupId), (override));
+    MOCK_METHOD(std::vector<std::string>, StartKnockoutStage,
+                (const std::string_view& tournamentId, int qualifiersPerGroup, const std::vector<domain::Match>& bracket), (override));
 };
 
 // Mock del repositorio de Tournaments
 class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
 };
 
 // Adapter para que TournamentRepository pueda usar el mock
@@ -55,13 +66,13 @@ private:
 
 public:
     TournamentRepositoryAdapter(std::shared_ptr<IRepository<domain::Tournament, std::string>> mockRepo) 
-        : TournamentRepository(CreateDummyProvider()), mock(mockRepo) {}
+        : TournamentRepository(CreateDummyProvider(), std::make_shared<JsonDocumentDecoder>()), mock(mockRepo) {}
     
     std::shared_ptr<domain::Tournament> ReadById(std::string id) override { return mock->ReadById(id); }
-    std::string Create(const domain::Tournament& entity) override { return mock->Create(entity); }
+    std::expected<std::string, Error> Create(const domain::Tournament& entity) override { return mock->Create(entity); }
     std::string Update(const domain::Tournament& entity) override { return mock->Update(entity); }
     void Delete(std::string id) override { mock->Delete(id); }
-    std::vector<std::shared_ptr<domain::Tournament>> ReadAll() override { return mock->ReadAll(); }
+    std::vector<domain::Tournament> ReadAll() override { return mock->ReadAll(); }
 };
 
 // Mock del productor de mensajes
@@ -111,7 +122,7 @@ TEST_F(MatchDelegateTest, GetMatches_Ok) {
     match2->Id() = "770e8400-e29b-41d4-a716-446655440002";
     match2->TournamentId() = tournamentId;
 
-    std::vector<std::shared_ptr<domain::Match>> matches = {match1, match2};
+    std::vector<domain::Match> matches = {*match1, *match2};
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
         .WillOnce(testing::Return(tournament));
@@ -155,7 +166,7 @@ TEST_F(MatchDelegateTest, GetMatches_Empty) {
     auto tournament = std::make_shared<domain::Tournament>("Test Tournament");
     tournament->Id() = tournamentId;
 
-    std::vector<std::shared_ptr<domain::Match>> emptyMatches;
+    std::vector<domain::Match> emptyMatches;
 
     EXPECT_CALL(*mockTournamentRepository, ReadById(testing::Eq(tournamentId)))
         .WillOnce(testing::Return(tournament));
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "profiling/CaptureDuration.hpp"
+#include "profiling/CpuProfiler.hpp"
+#include "profiling/LockProfiler.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+    // Trabajo de CPU que el optimizador no puede eliminar
+    void burn(std::atomic<bool>& running) {
+        volatile uint64_t accumulator = 0;
+        while (running) {
+            for (int i = 0; i < 10000; ++i) {
+                accumulator = accumulator + i * i;
+            }
+        }
+    }
+}
+
+// Validar que el perfil de CPU muestrea un hilo ocupado y entrega pilas colapsadas
+TEST(ProfilerTest, CpuCapture_SamplesBusyThread) {
+    std::atomic<bool> running{true};
+    std::thread worker(burn, std::ref(running));
+
+    const auto profile = profiling::CpuProfiler::Capture(1s, 199);
+    running = false;
+    worker.join();
+
+    ASSERT_TRUE(profile.has_value());
+    EXPECT_GT(profile->samples, 0);
+    EXPECT_FALSE(profile->stacks.empty());
+    const auto rendered = profiling::Render(profile->stacks);
+    EXPECT_NE(rendered.find(' '), std::string::npos);
+}
+
+// Validar que solo se permite una captura de CPU a la vez
+TEST(ProfilerTest, CpuCapture_OnlyOneAtATime) {
+    auto first = std::async(std::launch::async, [] { return profiling::CpuProfiler::Capture(1s); });
+    std::this_thread::sleep_for(200ms);
+
+    const auto second = profiling::CpuProfiler::Capture(1s);
+
+    EXPECT_FALSE(second.has_value());
+    EXPECT_TRUE(first.get().has_value());
+}
+
+// Validar que la espera en un mutex disputado se cuenta y aparece en la captura con su nombre
+TEST(ProfilerTest, ProfiledMutex_RecordsContention) {
+    profiling::ProfiledMutex mutex{"test.contended"};
+    auto capture = std::async(std::launch::async, [] { return profiling::LockProfiler::Instance().Capture(1s); });
+    std::this_thread::sleep_for(100ms);
+
+    std::unique_lock holder(mutex);
+    std::thread waiter([&] { std::lock_guard lock(mutex); });
+    std::this_thread::sleep_for(50ms);
+    holder.unlock();
+    waiter.join();
+
+    const auto stacks = capture.get();
+    ASSERT_TRUE(stacks.has_value());
+    bool found = false;
+    for (const auto& [stack, micros] : *stacks) {
+        found = found || (stack.ends_with("[lock test.contended]") && micros >= 10000);
+    }
+    EXPECT_TRUE(found);
+
+    const auto statistics = profiling::LockProfiler::Instance().Statistics();
+    const auto site = std::ranges::find(statistics, "test.contended", &profiling::LockStatistics::name);
+    ASSERT_NE(site, statistics.end());
+    EXPECT_EQ(site->acquisitions, 2);
+    EXPECT_EQ(site->contended, 1);
+    EXPECT_GE(site->maxWaitMillis, 10.0);
+}
+
+// Validar el parametro seconds: ausente usa el valor por defecto y fuera de rango es invalido
+TEST(ProfilerTest, CaptureDuration_Validates) {
+    EXPECT_EQ(profiling::CaptureDuration(nullptr), profiling::DEFAULT_CAPTURE);
+    EXPECT_EQ(profiling::CaptureDuration("5"), 5s);
+    EXPECT_FALSE(profiling::CaptureDuration("0").has_value());
+    EXPECT_FALSE(profiling::CaptureDuration("61").has_value());
+    EXPECT_FALSE(profiling::CaptureDuration("5s").has_value());
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+
+#include "deadline/RequestDeadline.hpp"
+
+// Validar que fuera de una peticion no hay deadline
+TEST(RequestDeadlineTest, NoScope_NoDeadline) {
+    EXPECT_FALSE(deadline::RequestDeadline::Current().has_value());
+    EXPECT_FALSE(deadline::RequestDeadline::Remaining().has_value());
+    EXPECT_FALSE(deadline::RequestDeadline::Expired());
+}
+
+// Validar que el tiempo restante queda acotado por el presupuesto de la ruta
+TEST(RequestDeadlineTest, Scope_RemainingWithinBudget) {
+    {
+        deadline::RequestDeadline requestDeadline(std::chrono::milliseconds{500});
+
+        const auto remaining = deadline::RequestDeadline::Remaining();
+        ASSERT_TRUE(remaining.has_value());
+        EXPECT_LE(remaining->count(), 500);
+        EXPECT_GT(remaining->count(), 0);
+        EXPECT_FALSE(deadline::RequestDeadline::Expired());
+    }
+    EXPECT_FALSE(deadline::RequestDeadline::Current().has_value());
+}
+
+// Validar que un scope interno conserva el deadline de la peticion
+TEST(RequestDeadlineTest, NestedScope_KeepsOuterDeadline) {
+    deadline::RequestDeadline outer(std::chrono::milliseconds{100});
+    const auto expected = deadline::RequestDeadline::Current();
+    {
+        deadline::RequestDeadline inner(std::chrono::minutes{5});
+        EXPECT_EQ(deadline::RequestDeadline::Current(), expected);
+    }
+    EXPECT_EQ(deadline::RequestDeadline::Current(), expected);
+}
+
+// Validar que el deadline vence
+TEST(RequestDeadlineTest, Scope_Expires) {
+    deadline::RequestDeadline requestDeadline(std::chrono::milliseconds{1});
+    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+
+    EXPECT_TRUE(deadline::RequestDeadline::Expired());
+    EXPECT_LE(deadline::RequestDeadline::Remaining()->count(), 0);
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "persistence/configuration/SlowQueryLog.hpp"
+
+using namespace std::chrono_literals;
+
+// Validar que una ejecucion bajo el umbral solo suma a las estadisticas
+TEST(SlowQueryLogTest, BelowThreshold_IsFast) {
+    SlowQueryLog log({.threshold = 100ms, .capacity = 4});
+
+    EXPECT_EQ(log.Observe("select_team_by_id", 10ms), SlowQueryLog::Verdict::FAST);
+    EXPECT_EQ(log.Observe("select_team_by_id", 30ms), SlowQueryLog::Verdict::FAST);
+
+    const auto statements = log.Statements();
+    ASSERT_TRUE(statements.contains("select_team_by_id"));
+    EXPECT_EQ(statements.at("select_team_by_id").calls, 2);
+    EXPECT_EQ(statements.at("select_team_by_id").slow, 0);
+    EXPECT_DOUBLE_EQ(statements.at("select_team_by_id").maxMillis, 30.0);
+    EXPECT_TRUE(log.Recent().empty());
+}
+
+// Validar que una ejecucion sobre el umbral cuenta como lenta
+TEST(SlowQueryLogTest, OverThreshold_IsSlow) {
+    SlowQueryLog log({.threshold = 100ms, .capacity = 4});
+
+    EXPECT_EQ(log.Observe("insert_team", 150ms), SlowQueryLog::Verdict::SLOW);
+    EXPECT_EQ(log.Observe("insert_team", 50ms), SlowQueryLog::Verdict::FAST);
+    EXPECT_EQ(log.Observe("insert_team", 100ms), SlowQueryLog::Verdict::SLOW);
+    EXPECT_EQ(log.Statements().at("insert_team").slow, 2);
+}
+
+// Validar que el buffer conserva las mas recientes primero y respeta la capacidad
+TEST(SlowQueryLogTest, Recent_IsBoundedNewestFirst) {
+    SlowQueryLog log({.threshold = 100ms, .capacity = 2});
+
+    log.Record("insert_team", 110ms);
+    log.Record("insert_group", 120ms);
+    log.Record("update_match", 130ms);
+
+    const auto recent = log.Recent();
+    ASSERT_EQ(recent.size(), 2);
+    EXPECT_EQ(recent[0].statement, "update_match");
+    EXPECT_EQ(recent[1].statement, "insert_group");
+}
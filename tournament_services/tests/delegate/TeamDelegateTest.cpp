@@ -6,27 +6,45 @@
 
 #include "domain/Team.hpp"
 #include "delegate/TeamDelegate.hpp"
+#include "domain/Constants.hpp"
+#include "persistence/repository/INameSearch.hpp"
 #include "persistence/repository/IRepository.hpp"
+#include "persistence/repository/ITeamDictionary.hpp"
 #include "exception/Error.hpp"
 
 // Mock del repositorio
 class MockTeamRepository : public IRepository<domain::Team, std::string_view> {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Team>, ReadById, (std::string_view id), (override));
-    MOCK_METHOD(std::string_view, Create, (const domain::Team& entity), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Team& entity), (override));
     MOCK_METHOD(std::string_view, Update, (const domain::Team& entity), (override));
     MOCK_METHOD(void, Delete, (std::string_view id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Team>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Team>, ReadAll, (), (override));
+};
+
+class MockTeamDictionary : public ITeamDictionary {
+public:
+    MOCK_METHOD((std::unordered_map<std::string, std::string>), Names, (const std::vector<std::string>& teamIds), (override));
+    MOCK_METHOD(void, Invalidate, (std::string_view teamId), (override));
+};
+
+class MockTeamSearch : public INameSearch<domain::Team> {
+public:
+    MOCK_METHOD(std::vector<domain::Team>, SearchByName, (std::string_view query, size_t limit), (override));
 };
 
 class TeamDelegateTest : public ::testing::Test {
 protected:
     std::shared_ptr<MockTeamRepository> mockRepository;
+    std::shared_ptr<testing::NiceMock<MockTeamDictionary>> mockTeamDictionary;
+    std::shared_ptr<MockTeamSearch> mockTeamSearch;
     std::shared_ptr<TeamDelegate> teamDelegate;
 
     void SetUp() override {
         mockRepository = std::make_shared<MockTeamRepository>();
-        teamDelegate = std::make_shared<TeamDelegate>(mockRepository);
+        mockTeamDictionary = std::make_shared<testing::NiceMock<MockTeamDictionary>>();
+        mockTeamSearch = std::make_shared<MockTeamSearch>();
+        teamDelegate = std::make_shared<TeamDelegate>(mockRepository, mockTeamDictionary, mockTeamSearch);
     }
 };
 
@@ -40,7 +58,7 @@ TEST_F(TeamDelegateTest, CreateTeam_Id) {
   std::string_view expectedId = "550e8400-e29b-41d4-a716-446655440000";
 
   EXPECT_CALL(*mockRepository, Create(testing::Field(&domain::Team::Name, "New Team")))
-    .WillOnce(testing::Return(expectedId));
+    .WillOnce(testing::Return(std::string(expectedId)));
 
   auto result = teamDelegate->CreateTeam(newTeam);
 
@@ -48,14 +66,14 @@ TEST_F(TeamDelegateTest, CreateTeam_Id) {
   EXPECT_EQ(result.value(), expectedId);
 }
 
-// Validar creacion fallida: error de duplicado usando std::expected
+// Validar creacion fallida: el repositorio reporta duplicado (ON CONFLICT) usando std::expected
 TEST_F(TeamDelegateTest, CreateTeam_Error) {
   domain::Team duplicateTeam;
   duplicateTeam.Id = "";
   duplicateTeam.Name = "Duplicate Team";
 
   EXPECT_CALL(*mockRepository, Create(testing::Field(&domain::Team::Name, "Duplicate Team")))
-    .WillOnce(testing::Throw(pqxx::unique_violation("duplicate key value violates unique constraint", "", "23505")));
+    .WillOnce(testing::Return(std::unexpected(Error::DUPLICATE)));
 
   auto result = teamDelegate->CreateTeam(duplicateTeam);
 
@@ -100,7 +118,7 @@ TEST_F(TeamDelegateTest, GetTeam_NotFound) {
 
 // Validar lista con objetos
 TEST_F(TeamDelegateTest, GetAllTeams_Ok) {
-  std::vector<std::shared_ptr<domain::Team>> teams;
+  std::vector<domain::Team> teams;
   
   auto team1 = std::make_shared<domain::Team>();
   team1->Id = "550e8400-e29b-41d4-a716-446655440001";
@@ -114,9 +132,9 @@ TEST_F(TeamDelegateTest, GetAllTeams_Ok) {
   team3->Id = "550e8400-e29b-41d4-a716-446655440003";
   team3->Name = "Team Three";
   
-  teams.push_back(team1);
-  teams.push_back(team2);
-  teams.push_back(team3);
+  teams.push_back(*team1);
+  teams.push_back(*team2);
+  teams.push_back(*team3);
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(teams));
@@ -126,17 +144,17 @@ TEST_F(TeamDelegateTest, GetAllTeams_Ok) {
   ASSERT_TRUE(result.has_value());
   auto retrievedTeams = result.value();
   ASSERT_EQ(retrievedTeams.size(), 3);
-  EXPECT_EQ(retrievedTeams[0]->Id, "550e8400-e29b-41d4-a716-446655440001");
-  EXPECT_EQ(retrievedTeams[0]->Name, "Team One");
-  EXPECT_EQ(retrievedTeams[1]->Id, "550e8400-e29b-41d4-a716-446655440002");
-  EXPECT_EQ(retrievedTeams[1]->Name, "Team Two");
-  EXPECT_EQ(retrievedTeams[2]->Id, "550e8400-e29b-41d4-a716-446655440003");
-  EXPECT_EQ(retrievedTeams[2]->Name, "Team Three");
+  EXPECT_EQ(retrievedTeams[0].Id, "550e8400-e29b-41d4-a716-446655440001");
+  EXPECT_EQ(retrievedTeams[0].Name, "Team One");
+  EXPECT_EQ(retrievedTeams[1].Id, "550e8400-e29b-41d4-a716-446655440002");
+  EXPECT_EQ(retrievedTeams[1].Name, "Team Two");
+  EXPECT_EQ(retrievedTeams[2].Id, "550e8400-e29b-41d4-a716-446655440003");
+  EXPECT_EQ(retrievedTeams[2].Name, "Team Three");
 }
 
 // Validar lista vacia
 TEST_F(TeamDelegateTest, GetAllTeams_Empty) {
-  std::vector<std::shared_ptr<domain::Team>> emptyTeams;
+  std::vector<domain::Team> emptyTeams;
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(emptyTeams));
@@ -148,6 +166,35 @@ TEST_F(TeamDelegateTest, GetAllTeams_Empty) {
   EXPECT_TRUE(retrievedTeams.empty());
 }
 
+// Tests de SearchTeams
+
+// Validar que la busqueda llegue al repositorio con la consulta y el limite
+TEST_F(TeamDelegateTest, SearchTeams_Ok) {
+  domain::Team team;
+  team.Id = "550e8400-e29b-41d4-a716-446655440001";
+  team.Name = "Tigres";
+
+  EXPECT_CALL(*mockTeamSearch, SearchByName(std::string_view("tig"), 10))
+    .WillOnce(testing::Return(std::vector{team}));
+
+  auto result = teamDelegate->SearchTeams("tig", 10);
+
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->size(), 1);
+  EXPECT_EQ(result->at(0).Name, "Tigres");
+}
+
+// Validar que consultas vacias, demasiado largas o limites fuera de rango no lleguen a la base de datos
+TEST_F(TeamDelegateTest, SearchTeams_Invalid) {
+  EXPECT_CALL(*mockTeamSearch, SearchByName(testing::_, testing::_)).Times(0);
+
+  EXPECT_EQ(teamDelegate->SearchTeams("", 10).error(), Error::INVALID_FORMAT);
+  EXPECT_EQ(teamDelegate->SearchTeams("ti", 10).error(), Error::INVALID_FORMAT);
+  EXPECT_EQ(teamDelegate->SearchTeams(std::string(MAX_SEARCH_QUERY_LENGTH + 1, 'a'), 10).error(), Error::INVALID_FORMAT);
+  EXPECT_EQ(teamDelegate->SearchTeams("tig", 0).error(), Error::INVALID_FORMAT);
+  EXPECT_EQ(teamDelegate->SearchTeams("tig", MAX_SEARCH_LIMIT + 1).error(), Error::INVALID_FORMAT);
+}
+
 // Tests de UpdateTeam
 
 // Validar actualizacion exitosa: busqueda por ID, transferencia de valor, resultado exitoso
@@ -162,6 +209,8 @@ TEST_F(TeamDelegateTest, UpdateTeam_Ok) {
     testing::Field(&domain::Team::Name, "Updated Team Name")
   )))
     .WillOnce(testing::Return(expectedResult));
+  // Validar que el nombre en cache se descarta para que los grupos muestren el nuevo
+  EXPECT_CALL(*mockTeamDictionary, Invalidate(std::string_view("550e8400-e29b-41d4-a716-446655440000")));
 
   auto result = teamDelegate->UpdateTeam(updatedTeam);
 
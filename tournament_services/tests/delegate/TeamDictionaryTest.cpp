@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "persistence/repository/TeamDictionary.hpp"
+
+// Sustituye la consulta a la base de datos y cuenta los viajes
+class CountingTeamDictionary : public TeamDictionary {
+public:
+    std::unordered_map<std::string, std::string> teams;
+    std::vector<std::vector<std::string>> fetches;
+
+    explicit CountingTeamDictionary(TeamDictionaryConfiguration configuration) : TeamDictionary(nullptr, configuration) {}
+
+protected:
+    std::unordered_map<std::string, std::string> Fetch(const std::vector<std::string>& teamIds) override {
+        fetches.push_back(teamIds);
+        std::unordered_map<std::string, std::string> names;
+        for (const auto& teamId : teamIds) {
+            if (const auto team = teams.find(teamId); team != teams.end()) {
+                names.emplace(teamId, team->second);
+            }
+        }
+        return names;
+    }
+};
+
+class TeamDictionaryTest : public ::testing::Test {
+protected:
+    std::unique_ptr<CountingTeamDictionary> dictionary;
+
+    void SetUp() override {
+        dictionary = std::make_unique<CountingTeamDictionary>(TeamDictionaryConfiguration{std::chrono::seconds(60), 16});
+        dictionary->teams = {{"a", "Team A"}, {"b", "Team B"}};
+    }
+};
+
+// Validar que los ids faltantes se piden en una sola consulta y sin repetidos
+TEST_F(TeamDictionaryTest, Names_BatchesMisses) {
+    auto names = dictionary->Names({"a", "b", "a"});
+
+    ASSERT_EQ(dictionary->fetches.size(), 1);
+    EXPECT_EQ(dictionary->fetches[0].size(), 2);
+    EXPECT_EQ(names["a"], "Team A");
+    EXPECT_EQ(names["b"], "Team B");
+}
+
+// Validar que una segunda lectura se responde desde cache
+TEST_F(TeamDictionaryTest, Names_ServedFromCache) {
+    dictionary->Names({"a", "b"});
+    auto names = dictionary->Names({"b"});
+
+    EXPECT_EQ(dictionary->fetches.size(), 1);
+    EXPECT_EQ(names["b"], "Team B");
+}
+
+// Validar que un id desconocido no aparece en el resultado
+TEST_F(TeamDictionaryTest, Names_UnknownIdAbsent) {
+    auto names = dictionary->Names({"missing"});
+
+    EXPECT_FALSE(names.contains("missing"));
+}
+
+// Validar que Invalidate obliga a releer el nombre renombrado
+TEST_F(TeamDictionaryTest, Invalidate_ReadsRename) {
+    dictionary->Names({"a"});
+    dictionary->teams["a"] = "Renamed";
+    dictionary->Invalidate("a");
+
+    auto names = dictionary->Names({"a"});
+
+    EXPECT_EQ(dictionary->fetches.size(), 2);
+    EXPECT_EQ(names["a"], "Renamed");
+}
+
+// Validar que una entrada vencida se vuelve a consultar
+TEST_F(TeamDictionaryTest, Names_ExpiredEntryRefetched) {
+    CountingTeamDictionary expiring(TeamDictionaryConfiguration{std::chrono::seconds(0), 16});
+    expiring.teams = {{"a", "Team A"}};
+
+    expiring.Names({"a"});
+    expiring.Names({"a"});
+
+    EXPECT_EQ(expiring.fetches.size(), 2);
+}
@@ -6,6 +6,7 @@
 
 #include "domain/Tournament.hpp"
 #include "delegate/TournamentDelegate.hpp"
+#include "persistence/repository/INameSearch.hpp"
 #include "persistence/repository/IRepository.hpp"
 #include "exception/Error.hpp"
 
@@ -13,20 +14,27 @@
 class MockTournamentRepository : public IRepository<domain::Tournament, std::string> {
 public:
     MOCK_METHOD(std::shared_ptr<domain::Tournament>, ReadById, (std::string id), (override));
-    MOCK_METHOD(std::string, Create, (const domain::Tournament& entity), (override));
+    MOCK_METHOD((std::expected<std::string, Error>), Create, (const domain::Tournament& entity), (override));
     MOCK_METHOD(std::string, Update, (const domain::Tournament& entity), (override));
     MOCK_METHOD(void, Delete, (std::string id), (override));
-    MOCK_METHOD(std::vector<std::shared_ptr<domain::Tournament>>, ReadAll, (), (override));
+    MOCK_METHOD(std::vector<domain::Tournament>, ReadAll, (), (override));
+};
+
+class MockTournamentSearch : public INameSearch<domain::Tournament> {
+public:
+    MOCK_METHOD(std::vector<domain::Tournament>, SearchByName, (std::string_view query, size_t limit), (override));
 };
 
 class TournamentDelegateTest : public ::testing::Test {
 protected:
     std::shared_ptr<MockTournamentRepository> mockRepository;
+    std::shared_ptr<MockTournamentSearch> mockSearch;
     std::shared_ptr<TournamentDelegate> tournamentDelegate;
 
     void SetUp() override {
         mockRepository = std::make_shared<MockTournamentRepository>();
-        tournamentDelegate = std::make_shared<TournamentDelegate>(mockRepository);
+        mockSearch = std::make_shared<MockTournamentSearch>();
+        tournamentDelegate = std::make_shared<TournamentDelegate>(mockRepository, mockSearch);
     }
 };
 
@@ -46,12 +54,12 @@ TEST_F(TournamentDelegateTest, CreateTournament_Id) {
   EXPECT_EQ(result.value(), expectedId);
 }
 
-// Validar creacion fallida: error de duplicado usando std::expected
+// Validar creacion fallida: el repositorio reporta duplicado (ON CONFLICT) usando std::expected
 TEST_F(TournamentDelegateTest, CreateTournament_Error) {
   domain::Tournament duplicateTournament("Duplicate Tournament");
 
   EXPECT_CALL(*mockRepository, Create(testing::_))
-    .WillOnce(testing::Throw(pqxx::unique_violation("duplicate key value violates unique constraint", "", "23505")));
+    .WillOnce(testing::Return(std::unexpected(Error::DUPLICATE)));
 
   auto result = tournamentDelegate->CreateTournament(duplicateTournament);
 
@@ -59,6 +67,31 @@ TEST_F(TournamentDelegateTest, CreateTournament_Error) {
   EXPECT_EQ(result.error(), Error::DUPLICATE);
 }
 
+// Validar creacion fallida: la fase de grupos no llena el bracket de 32 equipos, no llega al repositorio
+TEST_F(TournamentDelegateTest, CreateTournament_InvalidGroupStageFormat) {
+  domain::Tournament tournament("Group Cup", domain::TournamentFormat(6, 4, domain::TournamentType::GROUP_STAGE_KNOCKOUT, 2));
+
+  EXPECT_CALL(*mockRepository, Create(testing::_)).Times(0);
+
+  auto result = tournamentDelegate->CreateTournament(tournament);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), Error::INVALID_FORMAT);
+}
+
+// Validar creacion exitosa: 8 grupos de 4 con 4 clasificados llenan el bracket
+TEST_F(TournamentDelegateTest, CreateTournament_GroupStageFormat) {
+  domain::Tournament tournament("Group Cup", domain::TournamentFormat(8, 4, domain::TournamentType::GROUP_STAGE_KNOCKOUT, 4));
+  std::string expectedId = "550e8400-e29b-41d4-a716-446655440000";
+
+  EXPECT_CALL(*mockRepository, Create(testing::_)).WillOnce(testing::Return(expectedId));
+
+  auto result = tournamentDelegate->CreateTournament(tournament);
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(result.value(), expectedId);
+}
+
 // Tests de GetTournament (busqueda por ID)
 
 // Validar busqueda exitosa: transferencia del ID y retorno del objeto con validacion de valores
@@ -95,7 +128,7 @@ TEST_F(TournamentDelegateTest, GetTournament_NotFound) {
 
 // Validar lista con objetos
 TEST_F(TournamentDelegateTest, ReadAll_Ok) {
-  std::vector<std::shared_ptr<domain::Tournament>> tournaments;
+  std::vector<domain::Tournament> tournaments;
   
   auto tournament1 = std::make_shared<domain::Tournament>("Tournament One");
   tournament1->Id() = "550e8400-e29b-41d4-a716-446655440001";
@@ -106,9 +139,9 @@ TEST_F(TournamentDelegateTest, ReadAll_Ok) {
   auto tournament3 = std::make_shared<domain::Tournament>("Tournament Three");
   tournament3->Id() = "550e8400-e29b-41d4-a716-446655440003";
   
-  tournaments.push_back(tournament1);
-  tournaments.push_back(tournament2);
-  tournaments.push_back(tournament3);
+  tournaments.push_back(*tournament1);
+  tournaments.push_back(*tournament2);
+  tournaments.push_back(*tournament3);
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(tournaments));
@@ -118,17 +151,17 @@ TEST_F(TournamentDelegateTest, ReadAll_Ok) {
   ASSERT_TRUE(result.has_value());
   auto retrievedTournaments = result.value();
   ASSERT_EQ(retrievedTournaments.size(), 3);
-  EXPECT_EQ(retrievedTournaments[0]->Id(), "550e8400-e29b-41d4-a716-446655440001");
-  EXPECT_EQ(retrievedTournaments[0]->Name(), "Tournament One");
-  EXPECT_EQ(retrievedTournaments[1]->Id(), "550e8400-e29b-41d4-a716-446655440002");
-  EXPECT_EQ(retrievedTournaments[1]->Name(), "Tournament Two");
-  EXPECT_EQ(retrievedTournaments[2]->Id(), "550e8400-e29b-41d4-a716-446655440003");
-  EXPECT_EQ(retrievedTournaments[2]->Name(), "Tournament Three");
+  EXPECT_EQ(retrievedTournaments[0].Id(), "550e8400-e29b-41d4-a716-446655440001");
+  EXPECT_EQ(retrievedTournaments[0].Name(), "Tournament One");
+  EXPECT_EQ(retrievedTournaments[1].Id(), "550e8400-e29b-41d4-a716-446655440002");
+  EXPECT_EQ(retrievedTournaments[1].Name(), "Tournament Two");
+  EXPECT_EQ(retrievedTournaments[2].Id(), "550e8400-e29b-41d4-a716-446655440003");
+  EXPECT_EQ(retrievedTournaments[2].Name(), "Tournament Three");
 }
 
 // Validar lista vacia
 TEST_F(TournamentDelegateTest, ReadAll_Empty) {
-  std::vector<std::shared_ptr<domain::Tournament>> emptyTournaments;
+  std::vector<domain::Tournament> emptyTournaments;
 
   EXPECT_CALL(*mockRepository, ReadAll())
     .WillOnce(testing::Return(emptyTournaments));
@@ -140,6 +173,37 @@ TEST_F(TournamentDelegateTest, ReadAll_Empty) {
   EXPECT_TRUE(retrievedTournaments.empty());
 }
 
+// Tests de SearchTournaments
+
+// Validar que la busqueda llegue al repositorio y que un error de base de datos se reporte
+TEST_F(TournamentDelegateTest, SearchTournaments_Ok) {
+  EXPECT_CALL(*mockSearch, SearchByName(std::string_view("copa"), 5))
+    .WillOnce(testing::Return(std::vector{domain::Tournament("Copa Norte")}))
+    .WillOnce(testing::Throw(std::runtime_error("connection lost")));
+
+  auto result = tournamentDelegate->SearchTournaments("copa", 5);
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result->size(), 1);
+  EXPECT_EQ(result->at(0).Name(), "Copa Norte");
+
+  auto failed = tournamentDelegate->SearchTournaments("copa", 5);
+  ASSERT_FALSE(failed.has_value());
+  EXPECT_EQ(failed.error(), Error::UNKNOWN_ERROR);
+}
+
+// Validar que una consulta vacia o sin un trigrama se rechace sin consultar el repositorio
+TEST_F(TournamentDelegateTest, SearchTournaments_Invalid) {
+  EXPECT_CALL(*mockSearch, SearchByName(testing::_, testing::_)).Times(0);
+
+  auto result = tournamentDelegate->SearchTournaments("", 5);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error(), Error::INVALID_FORMAT);
+  EXPECT_EQ(tournamentDelegate->SearchTournaments("co", 5).error(), Error::INVALID_FORMAT);
+  // dos caracteres en UTF-8 ocupan mas de dos bytes
+  EXPECT_EQ(tournamentDelegate->SearchTournaments("ñú", 5).error(), Error::INVALID_FORMAT);
+}
+
 // Tests de UpdateTournament
 
 // Validar actualizacion exitosa: busqueda por ID, transferencia de valor, resultado exitoso